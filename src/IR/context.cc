@@ -6,6 +6,7 @@
 #include "../parser/parser.hpp"
 #include "../sitter.hpp"
 #include "../utils/qat_region.hpp"
+#include "./prerun_profile.hpp"
 #include "./qat_module.hpp"
 #include "./value.hpp"
 
@@ -126,7 +127,8 @@ void Ctx::write_json_result(bool status) const {
 	    ._("compilationTime", qatCompileTimeInMs.has_value() ? qatCompileTimeInMs.value() : JsonValue())
 	    ._("linkingTime", clangAndLinkTimeInMs.has_value() ? clangAndLinkTimeInMs.value() : JsonValue())
 	    ._("binarySizes", binarySizesJson)
-	    ._("hasMain", hasMain);
+	    ._("hasMain", hasMain)
+	    ._("prerunProfile", ir::PrerunProfile::is_enabled() ? ir::PrerunProfile::to_json() : JsonValue());
 	SHOW("Creating compilation result file")
 	std::ofstream output;
 	auto          outPath = cli::Config::get()->get_output_path() / "QatCompilationResult.json";
@@ -179,7 +181,7 @@ void Ctx::add_error(ir::Mod* activeMod, String const& message, Maybe<FileRange>
 		std::cerr << "\n"
 		          << cli::get_bg_color(cli::Color::red) << " ERROR " << cli::get_color(cli::Color::reset)
 		          << cli::get_color(cli::Color::cyan) << " --> " << cli::get_color(cli::Color::reset)
-		          << get_active_generic().fileRange.file.string() << ":" << get_active_generic().fileRange.start << "\n"
+		          << get_active_generic().fileRange.get_path().string() << ":" << get_active_generic().fileRange.start << "\n"
 		          << "Errors while creating generic variant: " << color(get_active_generic().name) << "\n"
 		          << "\n";
 	}
@@ -191,7 +193,7 @@ void Ctx::add_error(ir::Mod* activeMod, String const& message, Maybe<FileRange>
 	          << cli::get_color(cli::Color::reset) << "\n";
 	if (fileRange) {
 		std::cerr << cli::get_color(cli::Color::cyan) << " --> " << cli::get_color(cli::Color::reset)
-		          << fileRange.value().file.string() << ":" << fileRange.value().start << " to "
+		          << fileRange.value().get_path().string() << ":" << fileRange.value().start << " to "
 		          << fileRange.value().end;
 		print_range_content(fileRange.value(), true, true);
 	}
@@ -199,7 +201,7 @@ void Ctx::add_error(ir::Mod* activeMod, String const& message, Maybe<FileRange>
 		std::cerr << (fileRange.has_value() ? "" : "\n") << cli::get_color(cli::Color::white) << pointTo.value().first
 		          << cli::get_color(cli::Color::reset) << "\n"
 		          << cli::get_color(cli::Color::cyan) << " --> " << cli::get_color(cli::Color::reset)
-		          << pointTo.value().second.file.string() << ":" << pointTo.value().second.start << " to "
+		          << pointTo.value().second.get_path().string() << ":" << pointTo.value().second.start << " to "
 		          << pointTo.value().second.end;
 		print_range_content(pointTo.value().second, true, false);
 	}
@@ -216,7 +218,7 @@ void Ctx::add_error(ir::Mod* activeMod, String const& message, Maybe<FileRange>
 }
 
 void Ctx::print_range_content(FileRange const& fileRange, bool isError, bool isContentError) const {
-	if (not fs::is_regular_file(fileRange.file)) {
+	if (not fs::is_regular_file(fileRange.get_path())) {
 		return;
 	}
 	auto  lines       = get_range_content(fileRange);
@@ -261,6 +263,45 @@ void Ctx::add_exe_path(fs::path path) { executablePaths.push_back(path); }
 
 void Ctx::add_binary_size(usize size) { binarySizes.push_back(size); }
 
+llvm::GlobalVariable* Ctx::get_text_constant(String const& value, llvm::Module* mod) {
+	auto& moduleTexts = textConstants[mod];
+	auto  existing    = moduleTexts.find(value);
+	if (existing != moduleTexts.end()) {
+		mergedTextCount++;
+		return existing->second;
+	}
+	auto* data   = llvm::ConstantDataArray::getString(llctx, value, true);
+	auto* result = new llvm::GlobalVariable(*mod, data->getType(), true, llvm::GlobalValue::PrivateLinkage, data,
+	                                        get_global_string_name(), nullptr, llvm::GlobalValue::NotThreadLocal,
+	                                        dataLayout.getDefaultGlobalsAddressSpace());
+	// Private null terminated constants with an alignment of 1 and an unnamed address are placed in the mergeable
+	// string sections of the object file
+	result->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+	result->setAlignment(llvm::Align(1));
+	moduleTexts.emplace(value, result);
+	return result;
+}
+
+void Ctx::remove_unused_text_constant(llvm::GlobalVariable* global) {
+	global->removeDeadConstantUsers();
+	if (not global->use_empty()) {
+		return;
+	}
+	auto moduleTexts = textConstants.find(global->getParent());
+	if (moduleTexts != textConstants.end()) {
+		std::erase_if(moduleTexts->second, [&](auto const& text) { return text.second == global; });
+	}
+	global->eraseFromParent();
+}
+
+usize Ctx::get_text_constant_count() const {
+	usize result = 0;
+	for (auto const& moduleTexts : textConstants) {
+		result += moduleTexts.second.size();
+	}
+	return result;
+}
+
 void Ctx::finalise_errors() {
 	write_json_result(false);
 	sitter->destroy();
@@ -296,7 +337,7 @@ void Ctx::Errors(Vec<QatError> errors) {
 Pair<usize, Vec<std::tuple<String, u64, u64>>> Ctx::get_range_content(FileRange const& _range) const {
 	Vec<std::tuple<String, u64, u64>> result;
 
-	std::ifstream file(_range.file);
+	std::ifstream file(_range.get_path());
 	String        line;
 	u64           lineCount = 0;
 	const usize   startLine = _range.start.line;
@@ -349,7 +390,7 @@ void Ctx::Warning(const String& message, const FileRange& fileRange) {
 	std::cout << "\n"
 	          << cli::get_bg_color(cli::Color::purple) << " WARNING " << cli::get_bg_color(cli::Color::reset)
 	          << cli::get_color(cli::Color::cyan) << " --> " << cli::get_color(cli::Color::reset)
-	          << fileRange.file.string() << ":" << fileRange.start.line << ":" << fileRange.start.character
+	          << fileRange.get_path().string() << ":" << fileRange.start.line << ":" << fileRange.start.character
 	          << cli::get_color(cli::Color::white) << "\n"
 	          << (has_active_generic() ? ("Creating " + joinActiveGenericNames(true) + " => ") : "") << message
 	          << cli::get_color(cli::Color::reset) << "\n";
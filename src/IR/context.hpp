@@ -147,6 +147,9 @@ class Ctx {
 	mutable Maybe<u64>               qatCompileTimeInMs;
 	mutable Maybe<u64>               clangAndLinkTimeInMs;
 
+	Map<llvm::Module*, Map<String, llvm::GlobalVariable*>> textConstants;
+	u64                                                    mergedTextCount = 0;
+
 	useit bool has_active_generic() const { return not allActiveGenerics.empty(); }
 
 	useit GenericEntityMarker& get_active_generic() const { return allActiveGenerics.back(); }
@@ -189,6 +192,16 @@ class Ctx {
 		return res;
 	}
 
+	/// Provides the null terminated data of a text in the module. Identical text in a module uses the same constant,
+	/// which is also marked as unnamed_addr so that the linker can merge it with identical text from other objects
+	useit llvm::GlobalVariable* get_text_constant(String const& value, llvm::Module* mod);
+
+	/// Removes a text constant that is no longer used by anything in its module
+	void remove_unused_text_constant(llvm::GlobalVariable* global);
+
+	useit usize get_text_constant_count() const;
+	useit u64   get_merged_text_count() const { return mergedTextCount; }
+
 	useit llvm::GlobalValue::LinkageTypes getGlobalLinkageForVisibility(VisibilityInfo const& visibInfo) const;
 
 	void add_exe_path(fs::path path);
@@ -1,6 +1,7 @@
 #include "./function.hpp"
 #include "../ast/function.hpp"
 #include "../ast/types/generic_abstract.hpp"
+#include "../cli/config.hpp"
 #include "../show.hpp"
 #include "./context.hpp"
 #include "./control_flow.hpp"
@@ -362,15 +363,6 @@ void Function::update_overview() {
 
 String Function::get_full_name() const { return mod->get_fullname_with_child(name.value); }
 
-ir::LocalValue* Function::get_str_comparison_index() {
-	if (not strComparisonIndex) {
-		strComparisonIndex = get_first_block()->new_local("qat'strCmpInd",
-		                                                  // NOLINTNEXTLINE(readability-magic-numbers)
-		                                                  ir::UnsignedType::create(64u, ctx), true, name.range);
-	}
-	return strComparisonIndex;
-}
-
 GenericFunction::GenericFunction(Identifier _name, Vec<ast::GenericAbstractType*> _generics,
                                  ast::PrerunExpression* _constraint, ast::FunctionPrototype* _functionDef, Mod* _parent,
                                  const VisibilityInfo& _visibInfo)
@@ -424,18 +416,10 @@ Function* GenericFunction::fill_generics(Vec<ir::GenericToFill*> types, Ctx* irC
 	}
 	ir::fill_generics(ast::EmitCtx::get(irCtx, parent), generics, types, fileRange);
 	if (constraint != nullptr) {
-		auto emitCtx  = ast::EmitCtx::get(irCtx, parent)->with_generics(generics);
-		auto checkVal = constraint->emit(emitCtx);
-		if (checkVal->get_ir_type()->is_bool()) {
-			if (not llvm::cast<llvm::ConstantInt>(checkVal->get_llvm_constant())->getValue().getBoolValue()) {
-				irCtx->Error("The provided generic parameters for the generic function do not satisfy the constraints",
-				             fileRange,
-				             Pair<String, FileRange>{"The constraint can be found here", constraint->fileRange});
-			}
-		} else {
-			irCtx->Error("The constraints for generic parameters should be of " + irCtx->color("bool") +
-			                 " type. Got an expression of " + irCtx->color(checkVal->get_ir_type()->to_string()),
-			             constraint->fileRange);
+		auto emitCtx = ast::EmitCtx::get(irCtx, parent)->with_generics(generics);
+		if (not ir::evaluate_constraint(emitCtx, constraint, parent, name)) {
+			irCtx->Error("The provided generic parameters for the generic function do not satisfy the constraints",
+			             fileRange, Pair<String, FileRange>{"The constraint can be found here", constraint->fileRange});
 		}
 	}
 	auto variantName = ir::Logic::get_generic_variant_name(name.value, types);
@@ -556,7 +540,7 @@ void destructor_caller(ir::Ctx* irCtx, ir::Function* fun) {
 				}
 			}
 			auto freeName = fun->get_module()->link_internal_dependency(
-			    InternalDependency::free, irCtx,
+			    Mod::heap_dependency(InternalDependency::free), irCtx,
 			    fun->has_definition_range() ? fun->get_definition_range() : fun->get_name().range);
 			auto* freeFn = fun->get_module()->get_llvm_module()->getFunction(freeName);
 			irCtx->builder.CreateCall(
@@ -666,7 +650,7 @@ void method_handler(ir::Ctx* irCtx, ir::Function* fun) {
 						}
 					}
 					auto freeName = fun->get_module()->link_internal_dependency(
-					    InternalDependency::free, irCtx,
+					    Mod::heap_dependency(InternalDependency::free), irCtx,
 					    fun->has_definition_range() ? fun->get_definition_range() : fun->get_name().range);
 					auto* freeFn = fun->get_module()->get_llvm_module()->getFunction(freeName);
 					irCtx->builder.CreateCall(
@@ -694,6 +678,17 @@ void method_handler(ir::Ctx* irCtx, ir::Function* fun) {
 }
 
 void function_return_handler(ir::Ctx* irCtx, ir::Function* fun, const FileRange& fileRange) {
+	handle_function_end(irCtx, fun, fileRange);
+	// Checking only needs the diagnostics from the body, so the instructions are dropped as soon as the function is
+	// complete, instead of keeping them alive for an output that is never written
+	if (cli::Config::get()->is_workflow_check()) {
+		irCtx->builder.ClearInsertionPoint();
+		fun->get_llvm_function()->deleteBody();
+		fun->clear_blocks();
+	}
+}
+
+void handle_function_end(ir::Ctx* irCtx, ir::Function* fun, const FileRange& fileRange) {
 	SHOW("Starting function return handle for: " << fun->get_full_name())
 	// FIXME - Support destructors for types besides struct types
 	auto* block = fun->get_block();
@@ -180,7 +180,6 @@ class Function : public Value, public Uniq, public EntityOverview {
 	bool                  hasVariadicArguments;
 	bool                  isInline;
 	Vec<Block*>           blocks;
-	ir::LocalValue*       strComparisonIndex = nullptr;
 	Maybe<MetaInfo>       metaInfo;
 	Ctx*                  ctx;
 
@@ -226,7 +225,11 @@ class Function : public Value, public Uniq, public EntityOverview {
 
 	useit bool is_inline() const { return isInline; }
 
-	useit LocalValue* get_str_comparison_index();
+	/// Whether indexing is checked against the length at runtime. Audited code can disable this with the
+	/// `boundsChecks` meta key of the function
+	useit bool has_bound_checks() const {
+		return not metaInfo.has_value() || metaInfo->get_value_as_bool(MetaInfo::boundsChecksKey).value_or(true);
+	}
 
 	useit bool is_generic() const { return !generics.empty(); }
 
@@ -259,6 +262,12 @@ class Function : public Value, public Uniq, public EntityOverview {
 
 	void set_active_block(usize index) const { activeBlock = index; }
 
+	/// Forgets the blocks of the function, once the basic blocks they refer to have been deleted
+	void clear_blocks() {
+		blocks.clear();
+		activeBlock = 0;
+	}
+
 	void update_overview() override;
 
 	~Function() override;
@@ -304,6 +313,7 @@ class GenericFunction : public Uniq, public EntityOverview {
 };
 
 void function_return_handler(ir::Ctx* irCtx, ir::Function* fun, const FileRange& fileRange);
+void handle_function_end(ir::Ctx* irCtx, ir::Function* fun, const FileRange& fileRange);
 void destructor_caller(ir::Ctx* irCtx, ir::Function* fun);
 void method_handler(ir::Ctx* irCtx, ir::Function* fun);
 void destroy_locals_from(ir::Ctx* irCtx, ir::Block* block);
@@ -1,12 +1,17 @@
 #include "./generics.hpp"
+#include "../ast/expression.hpp"
 #include "../ast/types/generic_abstract.hpp"
 #include "../ast/types/prerun_generic.hpp"
 #include "../ast/types/typed_generic.hpp"
 #include "../utils/qat_region.hpp"
 #include "../utils/utils.hpp"
+#include "./prerun_profile.hpp"
+#include "./qat_module.hpp"
 #include "./types/typed.hpp"
 #include "./value.hpp"
 
+#include <llvm/IR/Constants.h>
+
 namespace qat::ir {
 
 void fill_generics(ast::EmitCtx* ctx, Vec<ast::GenericAbstractType*>& generics, Vec<GenericToFill*>& types,
@@ -70,18 +75,32 @@ void fill_generics(ast::EmitCtx* ctx, Vec<ast::GenericAbstractType*>& generics,
 	}
 }
 
+bool evaluate_constraint(ast::EmitCtx* ctx, ast::PrerunExpression* constraint, Mod* parent,
+                         Identifier const& entityName) {
+	PrerunProfileScope profileScope(PrerunProfile::get_entry(
+	    constraint, PrerunProfileKind::constraint,
+	    [&]() { return "constraint of " + parent->get_fullname_with_child(entityName.value); }, constraint->fileRange));
+	auto* checkVal = constraint->emit(ctx);
+	if (not checkVal->get_ir_type()->is_bool()) {
+		ctx->Error("The constraints for generic parameters should be of " + ctx->color("bool") +
+		               " type. Got an expression of " + ctx->color(checkVal->get_ir_type()->to_string()),
+		           constraint->fileRange);
+	}
+	return llvm::cast<llvm::ConstantInt>(checkVal->get_llvm_constant())->getValue().getBoolValue();
+}
+
 GenericToFill::GenericToFill(void* _data, GenericKind _kind, FileRange _range)
     : data(_data), kind(_kind), range(std::move(_range)) {}
 
 GenericToFill* GenericToFill::GetPrerun(ir::PrerunValue* constVal, FileRange _range) {
-	return std::construct_at(OwnNormal(GenericToFill), constVal, GenericKind::prerunGeneric, std::move(_range));
+	return std::construct_at(OwnGeneric(GenericToFill), constVal, GenericKind::prerunGeneric, std::move(_range));
 }
 
 GenericToFill* GenericToFill::GetType(ir::Type* type, FileRange _range) {
 	SHOW("GenericToFill of type is created")
 	SHOW("Type is: " << type)
 	SHOW("TypeKind is: " << (int)type->type_kind());
-	return std::construct_at(OwnNormal(GenericToFill), type, GenericKind::typedGeneric, std::move(_range));
+	return std::construct_at(OwnGeneric(GenericToFill), type, GenericKind::typedGeneric, std::move(_range));
 }
 
 bool GenericToFill::is_type() const { return kind == GenericKind::typedGeneric; }
@@ -161,7 +180,7 @@ TypedGeneric::TypedGeneric(Identifier _name, ir::Type* _type, FileRange _range)
     : GenericArgument(std::move(_name), GenericKind::typedGeneric, std::move(_range)), type(_type) {}
 
 TypedGeneric* TypedGeneric::get(Identifier name, ir::Type* type, FileRange range) {
-	return std::construct_at(OwnNormal(TypedGeneric), std::move(name), type, std::move(range));
+	return std::construct_at(OwnGeneric(TypedGeneric), std::move(name), type, std::move(range));
 }
 
 ir::Type* TypedGeneric::get_type() const { return type; }
@@ -179,7 +198,7 @@ PrerunGeneric::PrerunGeneric(Identifier _name, ir::PrerunValue* _val, FileRange
     : GenericArgument(std::move(_name), GenericKind::prerunGeneric, std::move(_range)), constant(_val) {}
 
 PrerunGeneric* PrerunGeneric::get(Identifier name, ir::PrerunValue* val, FileRange range) {
-	return std::construct_at(OwnNormal(PrerunGeneric), std::move(name), val, std::move(range));
+	return std::construct_at(OwnGeneric(PrerunGeneric), std::move(name), val, std::move(range));
 }
 
 ir::PrerunValue* PrerunGeneric::get_expression() const { return constant; }
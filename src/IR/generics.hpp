@@ -6,6 +6,7 @@
 
 namespace qat::ast {
 class GenericAbstractType;
+class PrerunExpression;
 struct EmitCtx;
 } // namespace qat::ast
 
@@ -16,6 +17,7 @@ enum class GenericKind {
 	prerunGeneric,
 };
 
+class Mod;
 class TypedGeneric;
 class PrerunGeneric;
 class PrerunValue;
@@ -24,6 +26,11 @@ class GenericToFill;
 void fill_generics(ast::EmitCtx* irCtx, Vec<ast::GenericAbstractType*>& genAbs, Vec<GenericToFill*>& fills,
                    FileRange const& fileRange);
 
+/// Evaluates the constraint of a generic entity after the generics have been filled. Reports an error if the constraint
+/// does not give a bool
+useit bool evaluate_constraint(ast::EmitCtx* ctx, ast::PrerunExpression* constraint, Mod* parent,
+                               Identifier const& entityName);
+
 class GenericToFill {
 	void*       data = nullptr;
 	GenericKind kind;
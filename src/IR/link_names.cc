@@ -3,14 +3,28 @@
 
 namespace qat {
 
+std::unordered_set<String> LinkNames::namePool{};
+u64                        LinkNames::builtCount  = 0;
+u64                        LinkNames::reusedCount = 0;
+
+String const& LinkNames::intern(String name) { return *namePool.insert(std::move(name)).first; }
+
 LinkNames::LinkNames() : units(), foreignID(), parentMod(nullptr) {}
 
 LinkNames::LinkNames(Vec<LinkNameUnit> _units, Maybe<String> _foreignID, ir::Mod* _mod)
     : units(_units), foreignID(_foreignID), parentMod(_mod) {}
 
-void LinkNames::setLinkAlias(Maybe<String> _linkAlias) { linkAlias = _linkAlias; }
+void LinkNames::setLinkAlias(Maybe<String> _linkAlias) {
+	linkAlias  = _linkAlias;
+	cachedName = nullptr;
+}
 
 void LinkNames::addUnit(LinkNameUnit unit, Maybe<String> entityForeignID) {
+	// The name computed so far is kept as the prefix of the new name, unless the foreign ID changes how the
+	// name is mangled
+	prefixName      = entityForeignID ? nullptr : cachedName;
+	prefixUnitCount = units.size();
+	cachedName      = nullptr;
 	units.push_back(unit);
 	if (entityForeignID) {
 		foreignID = entityForeignID;
@@ -23,7 +37,164 @@ LinkNames LinkNames::newWith(LinkNameUnit unit, Maybe<String> entityForeignID) {
 	return result;
 }
 
-String LinkNames::toName() const {
+static void append_link_unit(String& result, LinkNameUnit const& unit) {
+	switch (unit.unitType) {
+		case LinkUnitType::lib: {
+			result += "lib_";
+			result += unit.name;
+			break;
+		}
+		case LinkUnitType::type: {
+			result += "type_";
+			result += unit.name;
+			break;
+		}
+		case LinkUnitType::choice: {
+			result += "type_choice_";
+			result += unit.name;
+			break;
+		}
+		case LinkUnitType::mix: {
+			result += "type_mix_";
+			result += unit.name;
+			break;
+		}
+		case LinkUnitType::staticField: {
+			result += "static_";
+			result += unit.name;
+			break;
+		}
+		case LinkUnitType::region: {
+			result += "region_";
+			result += unit.name;
+			break;
+		}
+		case LinkUnitType::doType: {
+			result += "do_type:[" + unit.subNames.front().toName() + "]";
+			break;
+		}
+		case LinkUnitType::skill: {
+			result += "skill_";
+			result += unit.name;
+			break;
+		}
+		case LinkUnitType::doSkill: {
+			result += "do_skill:[" + unit.name + "]:for_type:[" + unit.subNames.front().toName() + "]";
+			break;
+		}
+		case LinkUnitType::function: {
+			result += "fn_" + unit.name;
+			break;
+		}
+		case LinkUnitType::staticFunction: {
+			result += "staticfn_" + unit.name;
+			break;
+		}
+		case LinkUnitType::variationMethod: {
+			result += "variation_" + unit.name;
+			break;
+		}
+		case LinkUnitType::method: {
+			result += "method_" + unit.name;
+			break;
+		}
+		case LinkUnitType::value_method: {
+			result += "valuedfn_" + unit.name;
+			break;
+		}
+		case LinkUnitType::defaultConstructor: {
+			result += "constructor_default";
+			break;
+		}
+		case LinkUnitType::fromConvertor: {
+			result += "convertor_from:[" + unit.name + "]";
+			break;
+		}
+		case LinkUnitType::toConvertor: {
+			result += "convertor_to:[" + unit.name + "]";
+			break;
+		}
+		case LinkUnitType::constructor: {
+			result += "constructor_from:[";
+			for (usize j = 0; j < unit.subNames.size(); j++) {
+				result += unit.subNames.at(j).toName();
+				if (j != (unit.subNames.size() - 1)) {
+					result += ",";
+				}
+			}
+			result += "]";
+			break;
+		}
+		case LinkUnitType::copyConstructor: {
+			result += "constructor_copy";
+			break;
+		}
+		case LinkUnitType::copyAssignment: {
+			result += "operator_copy";
+			break;
+		}
+		case LinkUnitType::moveConstructor: {
+			result += "constructor_move";
+			break;
+		}
+		case LinkUnitType::moveAssignment: {
+			result += "operator_move";
+			break;
+		}
+		case LinkUnitType::normalBinaryOperator: {
+			result += "operator_binary(" + unit.name + "):[" + unit.subNames.front().toName() + "]";
+			break;
+		}
+		case LinkUnitType::variationBinaryOperator: {
+			result += "operator_binary_variation(" + unit.name + "):[" + unit.subNames.front().toName() + "]";
+			break;
+		}
+		case LinkUnitType::unaryOperator: {
+			result += "operator_unary(" + unit.name + ")";
+		}
+		case LinkUnitType::destructor: {
+			result += "destructor";
+			break;
+		}
+		case LinkUnitType::global: {
+			result += "global_" + unit.name;
+			break;
+		}
+		case LinkUnitType::genericList: {
+			result += ":[";
+			for (usize j = 0; j < unit.subNames.size(); j++) {
+				result += unit.subNames.at(j).toName();
+				if (j != (unit.subNames.size() - 1)) {
+					result += ",";
+				}
+			}
+			result += "]";
+			break;
+		}
+		case LinkUnitType::name:
+		case LinkUnitType::typeName:
+		case LinkUnitType::genericPrerunValue:
+		case LinkUnitType::genericTypeValue: {
+			result += unit.name;
+			break;
+		}
+		case LinkUnitType::toggle:
+			result += "type_toggle_" + unit.name;
+			break;
+	}
+}
+
+String const& LinkNames::toName() const {
+	if (cachedName != nullptr) {
+		reusedCount++;
+		return *cachedName;
+	}
+	builtCount++;
+	cachedName = &LinkNames::intern(build_name());
+	return *cachedName;
+}
+
+String LinkNames::build_name() const {
 	auto isForeign = [&](String const& id) {
 		if (foreignID.has_value()) {
 			return (foreignID.value() == id);
@@ -44,6 +215,14 @@ String LinkNames::toName() const {
 		String result("");
 		// FIXME - Implement C++ name mangling
 		return result;
+	} else if ((prefixName != nullptr) && (prefixUnitCount > 0) && ((prefixUnitCount + 1) == units.size())) {
+		// The name of all the units except the last one is already known, so only the last unit is mangled
+		String result = *prefixName;
+		if (units.back().unitType != LinkUnitType::genericList) {
+			result += ":";
+		}
+		append_link_unit(result, units.back());
+		return result;
 	} else {
 		String result = ((not units.empty()) && (units.front().unitType == LinkUnitType::name ||
 		                                         units.front().unitType == LinkUnitType::genericTypeValue ||
@@ -55,150 +234,7 @@ String LinkNames::toName() const {
 			if (i != 0 && unit.unitType != LinkUnitType::genericList) {
 				result += ":";
 			}
-			switch (unit.unitType) {
-				case LinkUnitType::lib: {
-					result += "lib_";
-					result += unit.name;
-					break;
-				}
-				case LinkUnitType::type: {
-					result += "type_";
-					result += unit.name;
-					break;
-				}
-				case LinkUnitType::choice: {
-					result += "type_choice_";
-					result += unit.name;
-					break;
-				}
-				case LinkUnitType::mix: {
-					result += "type_mix_";
-					result += unit.name;
-					break;
-				}
-				case LinkUnitType::staticField: {
-					result += "static_";
-					result += unit.name;
-					break;
-				}
-				case LinkUnitType::region: {
-					result += "region_";
-					result += unit.name;
-					break;
-				}
-				case LinkUnitType::doType: {
-					result += "do_type:[" + unit.subNames.front().toName() + "]";
-					break;
-				}
-				case LinkUnitType::skill: {
-					result += "skill_";
-					result += unit.name;
-					break;
-				}
-				case LinkUnitType::doSkill: {
-					result += "do_skill:[" + unit.name + "]:for_type:[" + unit.subNames.front().toName() + "]";
-					break;
-				}
-				case LinkUnitType::function: {
-					result += "fn_" + unit.name;
-					break;
-				}
-				case LinkUnitType::staticFunction: {
-					result += "staticfn_" + unit.name;
-					break;
-				}
-				case LinkUnitType::variationMethod: {
-					result += "variation_" + unit.name;
-					break;
-				}
-				case LinkUnitType::method: {
-					result += "method_" + unit.name;
-					break;
-				}
-				case LinkUnitType::value_method: {
-					result += "valuedfn_" + unit.name;
-					break;
-				}
-				case LinkUnitType::defaultConstructor: {
-					result += "constructor_default";
-					break;
-				}
-				case LinkUnitType::fromConvertor: {
-					result += "convertor_from:[" + unit.name + "]";
-					break;
-				}
-				case LinkUnitType::toConvertor: {
-					result += "convertor_to:[" + unit.name + "]";
-					break;
-				}
-				case LinkUnitType::constructor: {
-					result += "constructor_from:[";
-					for (usize j = 0; j < unit.subNames.size(); j++) {
-						result += unit.subNames.at(j).toName();
-						if (j != (unit.subNames.size() - 1)) {
-							result += ",";
-						}
-					}
-					result += "]";
-					break;
-				}
-				case LinkUnitType::copyConstructor: {
-					result += "constructor_copy";
-					break;
-				}
-				case LinkUnitType::copyAssignment: {
-					result += "operator_copy";
-					break;
-				}
-				case LinkUnitType::moveConstructor: {
-					result += "constructor_move";
-					break;
-				}
-				case LinkUnitType::moveAssignment: {
-					result += "operator_move";
-					break;
-				}
-				case LinkUnitType::normalBinaryOperator: {
-					result += "operator_binary(" + unit.name + "):[" + unit.subNames.front().toName() + "]";
-					break;
-				}
-				case LinkUnitType::variationBinaryOperator: {
-					result += "operator_binary_variation(" + unit.name + "):[" + unit.subNames.front().toName() + "]";
-					break;
-				}
-				case LinkUnitType::unaryOperator: {
-					result += "operator_unary(" + unit.name + ")";
-				}
-				case LinkUnitType::destructor: {
-					result += "destructor";
-					break;
-				}
-				case LinkUnitType::global: {
-					result += "global_" + unit.name;
-					break;
-				}
-				case LinkUnitType::genericList: {
-					result += ":[";
-					for (usize j = 0; j < unit.subNames.size(); j++) {
-						result += unit.subNames.at(j).toName();
-						if (j != (unit.subNames.size() - 1)) {
-							result += ",";
-						}
-					}
-					result += "]";
-					break;
-				}
-				case LinkUnitType::name:
-				case LinkUnitType::typeName:
-				case LinkUnitType::genericPrerunValue:
-				case LinkUnitType::genericTypeValue: {
-					result += unit.name;
-					break;
-				}
-				case LinkUnitType::toggle:
-					result += "type_toggle_" + unit.name;
-					break;
-			}
+			append_link_unit(result, unit);
 		}
 		return result;
 	}
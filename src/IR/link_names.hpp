@@ -4,6 +4,8 @@
 #include "../utils/helpers.hpp"
 #include "../utils/macros.hpp"
 
+#include <unordered_set>
+
 namespace qat::ir {
 class Mod;
 }
@@ -49,19 +51,35 @@ enum class LinkUnitType {
 class LinkNameUnit;
 
 class LinkNames {
+	static std::unordered_set<String> namePool;
+
+	/** Mangled name of these units, interned in namePool once computed */
+	mutable String const* cachedName = nullptr;
+
+	/** Mangled name of the first prefixUnitCount units, if that was already computed before adding a unit */
+	String const* prefixName      = nullptr;
+	usize         prefixUnitCount = 0;
+
+	useit String build_name() const;
+
   public:
 	Vec<LinkNameUnit> units;
 	Maybe<String>     linkAlias;
 	Maybe<String>     foreignID;
 	ir::Mod*          parentMod;
 
+	static u64 builtCount;
+	static u64 reusedCount;
+
 	LinkNames();
 	LinkNames(Vec<LinkNameUnit> _units, Maybe<String> _foreignID, ir::Mod* _mod);
 
-	void            setLinkAlias(Maybe<String> _linkAlias);
-	void            addUnit(LinkNameUnit unit, Maybe<String> foreignID);
-	useit LinkNames newWith(LinkNameUnit unit, Maybe<String> foreignID);
-	useit String    toName() const;
+	useit static String const& intern(String name);
+
+	void                setLinkAlias(Maybe<String> _linkAlias);
+	void                addUnit(LinkNameUnit unit, Maybe<String> foreignID);
+	useit LinkNames     newWith(LinkNameUnit unit, Maybe<String> foreignID);
+	useit String const& toName() const;
 };
 
 class LinkNameUnit {
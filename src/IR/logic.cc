@@ -5,7 +5,9 @@
 #include "./control_flow.hpp"
 #include "./function.hpp"
 #include "./generics.hpp"
+#include "./number_text.hpp"
 #include "./qat_module.hpp"
+#include "./say_runtime.hpp"
 #include "./stdlib.hpp"
 #include "./type_id.hpp"
 #include "./types/array.hpp"
@@ -14,16 +16,20 @@
 #include "./types/native_type.hpp"
 #include "./types/pointer.hpp"
 #include "./types/reference.hpp"
+#include "./types/region.hpp"
 #include "./types/text.hpp"
 #include "./types/tuple.hpp"
 #include "./types/unsigned.hpp"
 #include "./value.hpp"
 
+#include <llvm/ADT/StringExtras.h>
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/GlobalVariable.h>
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/LLVMContext.h>
 
+#define INLINE_TEXT_COMPARE_LIMIT 16u
+
 namespace qat::ir {
 
 ir::Value* Logic::handle_pass_semantics(ast::EmitCtx* ctx, ir::Type* expectedType, ir::Value* value,
@@ -148,6 +154,108 @@ ir::Value* Logic::int_to_std_string(bool isSigned, ast::EmitCtx* ctx, ir::Value*
 	return nullptr;
 }
 
+ir::Value* Logic::number_to_text(ast::EmitCtx* ctx, ir::Value* value, ir::Region* region, FileRange fileRange) {
+	auto* valTy = value->get_ir_type()->is_ref() ? value->get_ir_type()->as_ref()->get_subtype() : value->get_ir_type();
+	if (valTy->is_native_type()) {
+		valTy = valTy->as_native_type()->get_subtype();
+	}
+	if (valTy->is_float()) {
+		auto floatKind = valTy->as_float()->get_float_kind();
+		if ((floatKind != ir::FloatTypeKind::_brain) && (floatKind != ir::FloatTypeKind::_16) &&
+		    (floatKind != ir::FloatTypeKind::_32) && (floatKind != ir::FloatTypeKind::_64)) {
+			ctx->Error("Conversion of " + ctx->color(valTy->to_string()) + " to " + ctx->color("text") +
+			               " is not supported. Only floats of 64 bits or less can be converted to text",
+			           fileRange);
+		}
+	}
+	if (value->is_prerun_value()) {
+		auto* constVal = value->get_llvm_constant();
+		if (valTy->is_float()) {
+			return ir::TextType::create_value(
+			    ctx->irCtx, ctx->mod,
+			    NumberText::float_to_text(llvm::cast<llvm::ConstantFP>(constVal)->getValueAPF()));
+		}
+		return ir::TextType::create_value(
+		    ctx->irCtx, ctx->mod,
+		    llvm::toString(llvm::cast<llvm::ConstantInt>(constVal)->getValue(), 10, valTy->is_integer()));
+	}
+	if (region == nullptr) {
+		ctx->Error("The characters of the text converted from a value that is not prerun need storage. Provide a region "
+		           "for the characters, like " +
+		               ctx->color("value'to:[text]'in:region(RegionName)"),
+		           fileRange);
+	}
+	if (value->is_ref() || value->is_ghost_ref()) {
+		if (value->is_ref()) {
+			value->load_ghost_ref(ctx->irCtx->builder);
+		}
+		value = ir::Value::get(ctx->irCtx->builder.CreateLoad(valTy->get_llvm_type(), value->get_llvm()), valTy, false);
+	}
+	auto*              Ty64Int  = llvm::Type::getInt64Ty(ctx->irCtx->llctx);
+	auto*              numVal   = value->get_llvm();
+	u64                maxChars = 0u;
+	InternalDependency converter;
+	if (valTy->is_float()) {
+		switch (valTy->as_float()->get_float_kind()) {
+			case ir::FloatTypeKind::_32: {
+				converter = InternalDependency::f32ToText;
+				break;
+			}
+			case ir::FloatTypeKind::_16: {
+				converter = InternalDependency::f16ToText;
+				break;
+			}
+			case ir::FloatTypeKind::_brain: {
+				converter = InternalDependency::bf16ToText;
+				break;
+			}
+			default: {
+				converter = InternalDependency::f64ToText;
+				break;
+			}
+		}
+		maxChars = NumberText::maxFloatLength;
+	} else {
+		auto isSigned = valTy->is_integer();
+		auto bitwidth = isSigned ? valTy->as_integer()->get_bitwidth() : valTy->as_unsigned()->get_bitwidth();
+		if (bitwidth > 64u) {
+			ctx->Error("Conversion of integers wider than 64 bits to " + ctx->color("text") +
+			               " is only supported for prerun values",
+			           fileRange);
+		}
+		numVal    = ctx->irCtx->builder.CreateIntCast(numVal, Ty64Int, isSigned);
+		converter = isSigned ? InternalDependency::signedToText : InternalDependency::unsignedToText;
+		maxChars  = isSigned ? NumberText::maxSignedLength : NumberText::maxUnsignedLength;
+	}
+	auto* convertFn =
+	    ctx->mod->get_llvm_module()->getFunction(ctx->mod->link_internal_dependency(converter, ctx->irCtx, fileRange));
+	// Every conversion owns new characters in the region, so that the text lives as long as the region. The text is
+	// empty if the region could not allocate
+	auto* buffer =
+	    region
+	        ->ownData(ir::UnsignedType::create(8u, ctx->irCtx), llvm::ConstantInt::get(Ty64Int, maxChars), ctx->irCtx)
+	        ->get_llvm();
+	auto* startBlock   = ctx->get_fn()->get_block();
+	auto* convertBlock = ir::Block::create(ctx->get_fn(), startBlock);
+	auto* restBlock    = ir::Block::create(ctx->get_fn(), startBlock->get_parent());
+	restBlock->link_previous_block(startBlock);
+	ctx->irCtx->builder.CreateCondBr(ctx->irCtx->builder.CreateIsNotNull(buffer), convertBlock->get_bb(),
+	                                 restBlock->get_bb());
+	convertBlock->set_active(ctx->irCtx->builder);
+	auto* convertedLength = ctx->irCtx->builder.CreateCall(convertFn->getFunctionType(), convertFn, {numVal, buffer});
+	(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
+	restBlock->set_active(ctx->irCtx->builder);
+	auto* length = ctx->irCtx->builder.CreatePHI(Ty64Int, 2u);
+	length->addIncoming(llvm::ConstantInt::get(Ty64Int, 0u), startBlock->get_bb());
+	length->addIncoming(convertedLength, convertBlock->get_bb());
+	auto* textTy    = ir::TextType::get(ctx->irCtx);
+	auto* lengthVal = ctx->irCtx->builder.CreateZExtOrTrunc(
+	    length, llvm::cast<llvm::StructType>(textTy->get_llvm_type())->getElementType(1u));
+	auto* result = ctx->irCtx->builder.CreateInsertValue(llvm::UndefValue::get(textTy->get_llvm_type()), buffer, {0u});
+	result       = ctx->irCtx->builder.CreateInsertValue(result, lengthVal, {1u});
+	return ir::Value::get(result, textTy, false);
+}
+
 Pair<String, Vec<llvm::Value*>> Logic::format_values(ast::EmitCtx* ctx, Vec<ir::Value*> values, Vec<FileRange> ranges,
                                                      FileRange fileRange) {
 	Vec<llvm::Value*> printVals;
@@ -290,9 +398,9 @@ Pair<String, Vec<llvm::Value*>> Logic::format_values(ast::EmitCtx* ctx, Vec<ir::
 					floatVal = val->get_llvm();
 				}
 				if (floatTy->get_float_kind() != ir::FloatTypeKind::_64) {
-					floatVal = ctx->irCtx->builder.CreateFPCast(floatVal, llvm::Type::getInt64Ty(ctx->irCtx->llctx));
+					floatVal = ctx->irCtx->builder.CreateFPCast(floatVal, llvm::Type::getDoubleTy(ctx->irCtx->llctx));
 				}
-				formatString += "%u";
+				formatString += "%f";
 				printVals.push_back(floatVal);
 			}
 		} else if (valTy->is_ptr() || (valTy->is_native_type() && valTy->as_native_type()->get_subtype()->is_ptr())) {
@@ -463,6 +571,78 @@ Pair<String, Vec<llvm::Value*>> Logic::format_values(ast::EmitCtx* ctx, Vec<ir::
 	return {formatString, printVals};
 }
 
+void Logic::write_formatted(ast::EmitCtx* ctx, String const& formatString, Vec<llvm::Value*> const& values,
+                            FileRange fileRange) {
+	auto* mod     = ctx->mod;
+	auto* Ty64Int = llvm::Type::getInt64Ty(ctx->irCtx->llctx);
+	auto* i8PtrTy =
+	    llvm::Type::getInt8Ty(ctx->irCtx->llctx)->getPointerTo(ctx->irCtx->dataLayout.getProgramAddressSpace());
+
+	auto callWriter = [&](InternalDependency writer, Vec<llvm::Value*> args) {
+		auto  writerName = mod->link_internal_dependency(writer, ctx->irCtx, fileRange);
+		auto* writerFn   = mod->get_llvm_module()->getFunction(writerName);
+		ctx->irCtx->builder.CreateCall(writerFn->getFunctionType(), writerFn, args);
+	};
+	String pendingText;
+	auto   writePendingText = [&]() {
+		if (not pendingText.empty()) {
+			callWriter(InternalDependency::sayText, {ctx->irCtx->get_text_constant(pendingText, mod->get_llvm_module()),
+			                                         llvm::ConstantInt::get(Ty64Int, pendingText.size())});
+			pendingText.clear();
+		}
+	};
+	// The specifiers are the ones produced by format_values, and text between them is written in one call
+	usize valueIndex = 0;
+	for (usize i = 0; i < formatString.size(); i++) {
+		if (formatString[i] != '%') {
+			pendingText += formatString[i];
+			continue;
+		}
+		writePendingText();
+		auto specifier = formatString.substr(i + 1, formatString.substr(i + 1, 3) == ".*s" ? 3 : 1);
+		i += specifier.size();
+		if (specifier == ".*s") {
+			callWriter(InternalDependency::sayText,
+			           {ctx->irCtx->builder.CreatePointerCast(values[valueIndex + 1], i8PtrTy),
+			            ctx->irCtx->builder.CreateZExtOrTrunc(values[valueIndex], Ty64Int)});
+			valueIndex += 2;
+		} else if (specifier == "s") {
+			callWriter(InternalDependency::sayCString,
+			           {ctx->irCtx->builder.CreatePointerCast(values[valueIndex++], i8PtrTy)});
+		} else if (specifier == "i") {
+			// FIXME - Support integers wider than 64 bits
+			callWriter(InternalDependency::saySigned,
+			           {ctx->irCtx->builder.CreateSExtOrTrunc(values[valueIndex++], Ty64Int)});
+		} else if (specifier == "u") {
+			callWriter(InternalDependency::sayUnsigned,
+			           {ctx->irCtx->builder.CreateZExtOrTrunc(values[valueIndex++], Ty64Int)});
+		} else if (specifier == "f") {
+			// Floats are widened to a double for printf, and the writer is told the original kind so that it writes
+			// the digits of that kind
+			auto* floatVal  = values[valueIndex++];
+			auto  floatKind = SayRuntime::floatKind64;
+			if (auto* widened = llvm::dyn_cast<llvm::FPExtInst>(floatVal)) {
+				auto* sourceTy = widened->getSrcTy();
+				if (sourceTy->isFloatTy()) {
+					floatKind = SayRuntime::floatKind32;
+				} else if (sourceTy->isHalfTy()) {
+					floatKind = SayRuntime::floatKind16;
+				} else if (sourceTy->isBFloatTy()) {
+					floatKind = SayRuntime::floatKindBrain;
+				}
+			}
+			callWriter(InternalDependency::sayFloat,
+			           {floatVal, llvm::ConstantInt::get(llvm::Type::getInt8Ty(ctx->irCtx->llctx), floatKind)});
+		} else if (specifier == "p") {
+			callWriter(InternalDependency::sayPointer,
+			           {ctx->irCtx->builder.CreatePointerCast(values[valueIndex++], i8PtrTy)});
+		} else {
+			pendingText += "%" + specifier;
+		}
+	}
+	writePendingText();
+}
+
 void Logic::exit_thread(ir::Function* fun, ast::EmitCtx* ctx, FileRange rangeVal) {
 	auto triple = ctx->irCtx->clangTargetInfo->getTriple();
 	if (triple.isWindowsMSVCEnvironment()) {
@@ -485,6 +665,12 @@ void Logic::exit_thread(ir::Function* fun, ast::EmitCtx* ctx, FileRange rangeVal
 }
 
 void Logic::exit_program(ir::Function* fun, ast::EmitCtx* ctx, FileRange rangeVal) {
+	if (SayRuntime::is_supported(ctx->irCtx)) {
+		// Output of say sentences that is still buffered in any thread is written before the program exits
+		auto  flushAllName = ctx->mod->link_internal_dependency(InternalDependency::sayFlushAll, ctx->irCtx, rangeVal);
+		auto* flushAllFn   = ctx->mod->get_llvm_module()->getFunction(flushAllName);
+		ctx->irCtx->builder.CreateCall(flushAllFn->getFunctionType(), flushAllFn, {});
+	}
 	auto exitFnName = ctx->mod->link_internal_dependency(InternalDependency::exitProgram, ctx->irCtx, rangeVal);
 	auto exitFun    = ctx->mod->get_llvm_module()->getFunction(exitFnName);
 	ctx->irCtx->builder.CreateCall(exitFun->getFunctionType(), exitFun,
@@ -493,24 +679,35 @@ void Logic::exit_program(ir::Function* fun, ast::EmitCtx* ctx, FileRange rangeVa
 
 void Logic::panic_in_function(ir::Function* fun, Vec<ir::Value*> values, Vec<FileRange> ranges, FileRange fileRange,
                               ast::EmitCtx* ctx) {
-	fileRange.file     = fs::absolute(fileRange.file);
+	fileRange          = FileRange(fs::absolute(fileRange.get_path()), fileRange.start, fileRange.end);
 	auto  startMessage = ir::TextType::create_value(ctx->irCtx, ctx->mod,
 	                                                "\nFunction " + fun->get_full_name() + " panicked at " +
 	                                                    fileRange.start_to_string() + " => ");
 	auto* mod          = fun->get_module();
-	auto  printfName   = mod->link_internal_dependency(InternalDependency::printf, ctx->irCtx, fileRange);
-	auto  printFn      = mod->get_llvm_module()->getFunction(printfName);
 	auto  formatRes    = format_values(ctx, values, ranges, fileRange);
 
-	Vec<llvm::Value*> printVals{ctx->irCtx->builder.CreateGlobalStringPtr(
-	                                "%.*s" + formatRes.first + "\n\n", ctx->irCtx->get_global_string_name(),
-	                                ctx->irCtx->dataLayout.getDefaultGlobalsAddressSpace()),
+	Vec<llvm::Value*> printVals{ctx->irCtx->get_text_constant("%.*s" + formatRes.first + "\n\n",
+	                                                          ctx->irCtx->builder.GetInsertBlock()->getModule()),
 	                            startMessage->get_llvm_constant()->getAggregateElement(1u),
 	                            startMessage->get_llvm_constant()->getAggregateElement(0u)};
 	for (auto* val : formatRes.second) {
 		printVals.push_back(val);
 	}
-	ctx->irCtx->builder.CreateCall(printFn->getFunctionType(), printFn, printVals);
+	if (SayRuntime::is_supported(ctx->irCtx)) {
+		// Output of say sentences that is still buffered is written first, and the message is not buffered
+		auto  flushName = mod->link_internal_dependency(InternalDependency::sayFlush, ctx->irCtx, fileRange);
+		auto* flushFn   = mod->get_llvm_module()->getFunction(flushName);
+		auto* nullPtr   = llvm::ConstantPointerNull::get(
+		    llvm::Type::getInt8Ty(ctx->irCtx->llctx)->getPointerTo(ctx->irCtx->dataLayout.getProgramAddressSpace()));
+		ctx->irCtx->builder.CreateCall(flushFn->getFunctionType(), flushFn, {nullPtr});
+		Vec<llvm::Value*> messageVals(printVals.begin() + 1, printVals.end());
+		write_formatted(ctx, "%.*s" + formatRes.first + "\n\n", messageVals, fileRange);
+		ctx->irCtx->builder.CreateCall(flushFn->getFunctionType(), flushFn, {nullPtr});
+	} else {
+		auto  printfName = mod->link_internal_dependency(InternalDependency::printf, ctx->irCtx, fileRange);
+		auto* printFn    = mod->get_llvm_module()->getFunction(printfName);
+		ctx->irCtx->builder.CreateCall(printFn->getFunctionType(), printFn, printVals);
+	}
 	auto cfg = cli::Config::get();
 	if (cfg->is_freestanding()) {
 		switch (cfg->get_panic_strategy()) {
@@ -663,72 +860,82 @@ useit ir::Value* Logic::compare_text(bool isEquality, ir::Value* lhsEmit, ir::Va
 	}
 	auto* curr              = ctx->get_fn()->get_block();
 	auto* lenCheckTrueBlock = ir::Block::create(ctx->get_fn(), curr);
-	auto* strCmpTrueBlock   = ir::Block::create(ctx->get_fn(), curr);
-	auto* strCmpFalseBlock  = ir::Block::create(ctx->get_fn(), curr);
-	auto* iterCondBlock     = ir::Block::create(ctx->get_fn(), lenCheckTrueBlock);
-	auto* iterTrueBlock     = ir::Block::create(ctx->get_fn(), lenCheckTrueBlock);
-	auto* iterIncrBlock     = ir::Block::create(ctx->get_fn(), iterTrueBlock);
-	auto* iterFalseBlock    = ir::Block::create(ctx->get_fn(), lenCheckTrueBlock);
 	auto* restBlock         = ir::Block::create(ctx->get_fn(), curr->get_parent());
 	restBlock->link_previous_block(curr);
-	auto* qatStrCmpIndex = ctx->get_fn()->get_str_comparison_index();
-	// NOTE - Length equality check
+	auto* lenCheckBB = ctx->irCtx->builder.GetInsertBlock();
 	ctx->irCtx->builder.CreateCondBr(ctx->irCtx->builder.CreateICmpEQ(lhsCount, rhsCount), lenCheckTrueBlock->get_bb(),
-	                                 strCmpFalseBlock->get_bb());
-	//
-	// NOTE - Length matches
+	                                 restBlock->get_bb());
 	lenCheckTrueBlock->set_active(ctx->irCtx->builder);
-	ctx->irCtx->builder.CreateStore(llvm::ConstantInt::get(int64Type, 0u), qatStrCmpIndex->get_llvm());
-	(void)ir::add_branch(ctx->irCtx->builder, iterCondBlock->get_bb());
-	//
-	// NOTE - Checking the iteration count
-	iterCondBlock->set_active(ctx->irCtx->builder);
-	ctx->irCtx->builder.CreateCondBr(
-	    ctx->irCtx->builder.CreateICmpULT(ctx->irCtx->builder.CreateLoad(int64Type, qatStrCmpIndex->get_llvm()),
-	                                      lhsCount),
-	    iterTrueBlock->get_bb(), iterFalseBlock->get_bb());
-	//
-	// NOTE - Iteration check is true
-	iterTrueBlock->set_active(ctx->irCtx->builder);
-	ctx->irCtx->builder.CreateCondBr(
-	    ctx->irCtx->builder.CreateICmpEQ(
-	        ctx->irCtx->builder.CreateLoad(
-	            int8Type,
-	            ctx->irCtx->builder.CreateInBoundsGEP(
-	                int8Type, lhsBuff, {ctx->irCtx->builder.CreateLoad(int64Type, qatStrCmpIndex->get_llvm())})),
-	        ctx->irCtx->builder.CreateLoad(
-	            int8Type,
-	            ctx->irCtx->builder.CreateInBoundsGEP(
-	                int8Type, rhsBuff, {ctx->irCtx->builder.CreateLoad(int64Type, qatStrCmpIndex->get_llvm())}))),
-	    iterIncrBlock->get_bb(), iterFalseBlock->get_bb());
-	//
-	// NOTE - Increment text iteration count
-	iterIncrBlock->set_active(ctx->irCtx->builder);
-	ctx->irCtx->builder.CreateStore(
-	    ctx->irCtx->builder.CreateAdd(ctx->irCtx->builder.CreateLoad(int64Type, qatStrCmpIndex->get_llvm()),
-	                                  llvm::ConstantInt::get(int64Type, 1u)),
-	    qatStrCmpIndex->get_llvm());
-	(void)ir::add_branch(ctx->irCtx->builder, iterCondBlock->get_bb());
-	//
-	// NOTE - Iteration check is false, time to check if the count matches
-	iterFalseBlock->set_active(ctx->irCtx->builder);
-	ctx->irCtx->builder.CreateCondBr(
-	    ctx->irCtx->builder.CreateICmpEQ(lhsCount,
-	                                     ctx->irCtx->builder.CreateLoad(int64Type, qatStrCmpIndex->get_llvm())),
-	    strCmpTrueBlock->get_bb(), strCmpFalseBlock->get_bb());
-	//
-	// NOTE - Merging branches to the resume block
-	strCmpTrueBlock->set_active(ctx->irCtx->builder);
-	(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
-	strCmpFalseBlock->set_active(ctx->irCtx->builder);
+	// The lengths are the same here, so the length of a constant text applies to both sides
+	auto* bytesEqual = compare_text_bytes(lhsBuff, rhsBuff, isConstantRHS ? rhsCount : lhsCount, ctx, fileRange);
+	auto* bytesBB    = ctx->irCtx->builder.GetInsertBlock();
 	(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
-	//
-	// NOTE - Control flow resumes
 	restBlock->set_active(ctx->irCtx->builder);
 	auto* strCmpRes = ctx->irCtx->builder.CreatePHI(boolType, 2);
-	strCmpRes->addIncoming(llvm::ConstantInt::get(boolType, isEquality ? 1u : 0u), strCmpTrueBlock->get_bb());
-	strCmpRes->addIncoming(llvm::ConstantInt::get(boolType, isEquality ? 0u : 1u), strCmpFalseBlock->get_bb());
-	return ir::Value::get(strCmpRes, boolIRType, false)->with_range(fileRange);
+	strCmpRes->addIncoming(llvm::ConstantInt::getFalse(ctx->irCtx->llctx), lenCheckBB);
+	strCmpRes->addIncoming(bytesEqual, bytesBB);
+	return ir::Value::get(isEquality ? (llvm::Value*)strCmpRes : ctx->irCtx->builder.CreateNot(strCmpRes), boolIRType,
+	                      false)
+	    ->with_range(fileRange);
+}
+
+llvm::Value* Logic::compare_text_bytes(llvm::Value* lhsBuff, llvm::Value* rhsBuff, llvm::Value* count,
+                                       ast::EmitCtx* ctx, FileRange fileRange) {
+	auto* int64Type     = llvm::Type::getInt64Ty(ctx->irCtx->llctx);
+	auto* int8Type      = llvm::Type::getInt8Ty(ctx->irCtx->llctx);
+	auto* constantCount = llvm::dyn_cast<llvm::ConstantInt>(count);
+	if ((constantCount != nullptr) && (constantCount->getZExtValue() <= INLINE_TEXT_COMPARE_LIMIT)) {
+		auto length = constantCount->getZExtValue();
+		// The bytes of a text constant are used as immediate values, so that only the other side is loaded. Globals
+		// that can be written to, or whose initializer can be replaced at link time, are loaded like any other buffer
+		auto constantBytes = [](llvm::Value* buff) -> Maybe<String> {
+			auto* global = llvm::dyn_cast<llvm::GlobalVariable>(buff);
+			if ((global != nullptr) && global->isConstant() && global->hasDefinitiveInitializer()) {
+				if (auto* data = llvm::dyn_cast<llvm::ConstantDataArray>(global->getInitializer())) {
+					return data->getRawDataValues().str();
+				}
+			}
+			return None;
+		};
+		auto lhsBytes = constantBytes(lhsBuff);
+		auto rhsBytes = constantBytes(rhsBuff);
+		auto isLittle = ctx->irCtx->dataLayout.isLittleEndian();
+		u64  offset   = 0;
+		// Provides the word of the provided width at the current offset
+		auto getWord = [&](llvm::Value* buff, Maybe<String> const& bytes, u64 width) -> llvm::Value* {
+			auto* wordType = llvm::Type::getIntNTy(ctx->irCtx->llctx, width * 8u);
+			if (bytes.has_value() && (bytes->size() >= (offset + width))) {
+				u64 word = 0;
+				for (u64 i = 0; i < width; i++) {
+					u64 byte = (u8)bytes->at(offset + (isLittle ? (width - 1 - i) : i));
+					word     = (word << 8u) | byte;
+				}
+				return llvm::ConstantInt::get(wordType, word);
+			}
+			return ctx->irCtx->builder.CreateAlignedLoad(
+			    wordType,
+			    ctx->irCtx->builder.CreateInBoundsGEP(int8Type, buff, {llvm::ConstantInt::get(int64Type, offset)}),
+			    llvm::MaybeAlign(1u));
+		};
+		llvm::Value* difference = llvm::ConstantInt::get(int64Type, 0u);
+		while (offset < length) {
+			u64 width = 8u;
+			while (width > (length - offset)) {
+				width /= 2u;
+			}
+			auto* wordDifference =
+			    ctx->irCtx->builder.CreateXor(getWord(lhsBuff, lhsBytes, width), getWord(rhsBuff, rhsBytes, width));
+			difference =
+			    ctx->irCtx->builder.CreateOr(difference, ctx->irCtx->builder.CreateZExt(wordDifference, int64Type));
+			offset += width;
+		}
+		return ctx->irCtx->builder.CreateICmpEQ(difference, llvm::ConstantInt::get(int64Type, 0u));
+	}
+	auto  memcmpName = ctx->mod->link_internal_dependency(InternalDependency::memcmp, ctx->irCtx, std::move(fileRange));
+	auto* memcmpFn   = ctx->mod->get_llvm_module()->getFunction(memcmpName);
+	return ctx->irCtx->builder.CreateICmpEQ(
+	    ctx->irCtx->builder.CreateCall(memcmpFn->getFunctionType(), memcmpFn, {lhsBuff, rhsBuff, count}),
+	    llvm::ConstantInt::get(llvm::Type::getInt32Ty(ctx->irCtx->llctx), 0u));
 }
 
 } // namespace qat::ir
@@ -21,12 +21,22 @@ class Logic {
 	useit static bool compare_prerun_text(llvm::Constant* lhsBuff, llvm::Constant* lhsCount, llvm::Constant* rhsBuff,
 	                                      llvm::Constant* rhsCount, llvm::LLVMContext& llCtx);
 
+	/// Compares the bytes of two texts that are known to have the same length. Short constant lengths are compared
+	/// inline a word at a time, and other lengths use memcmp
+	useit static llvm::Value* compare_text_bytes(llvm::Value* lhsBuff, llvm::Value* rhsBuff, llvm::Value* count,
+	                                             ast::EmitCtx* ctx, FileRange fileRange);
+
 	useit static ir::Value* compare_text(bool isEquality, ir::Value* lhs, ir::Value* rhs, FileRange lhsRange,
 	                                     FileRange rhsRange, FileRange fileRange, ast::EmitCtx* ctx);
 
 	useit static Pair<String, Vec<llvm::Value*>> format_values(ast::EmitCtx* ctx, Vec<ir::Value*> values,
 	                                                           Vec<FileRange> ranges, FileRange fileRange);
 
+	/// Writes values formatted by format_values to the standard output with the say runtime, calling the writer of
+	/// every value instead of printf
+	static void write_formatted(ast::EmitCtx* ctx, String const& formatString, Vec<llvm::Value*> const& values,
+	                            FileRange fileRange);
+
 	static void panic_in_function(ir::Function* fun, Vec<ir::Value*> values, Vec<FileRange> ranges, FileRange fileRange,
 	                              ast::EmitCtx* ctx);
 
@@ -35,6 +45,11 @@ class Logic {
 
 	useit static ir::Value* int_to_std_string(bool isSigned, ast::EmitCtx* ctx, ir::Value* value, FileRange fileRange);
 
+	/// Converts an integer or a float to text. Prerun values become constant text, and the characters of other values
+	/// are owned by the provided region, which is required for them
+	useit static ir::Value* number_to_text(ast::EmitCtx* ctx, ir::Value* value, ir::Region* region,
+	                                       FileRange fileRange);
+
 	/// NOTE - This function should ideally control copy & move semantics behaviour for the entire language
 	useit static ir::Value* handle_pass_semantics(ast::EmitCtx* ctx, ir::Type* expectedType, ir::Value* value,
 	                                              FileRange valueRange, bool restricLocalRefs = false);
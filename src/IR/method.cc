@@ -303,6 +303,9 @@ Method::Method(MethodType _fnType, bool _isVariation, MethodParent* _parent, con
 			break;
 		}
 	}
+	if (parent->is_expanded() && parent->as_expanded()->hasMethodIndex) {
+		parent->as_expanded()->index_method(this);
+	}
 }
 
 String method_type_to_string(MethodType type) { return Method::methodTypes[type]; }
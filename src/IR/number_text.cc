@@ -0,0 +1,594 @@
+#include "./number_text.hpp"
+#include "../show.hpp"
+#include "./context.hpp"
+#include "./qat_module.hpp"
+
+#include <llvm/ADT/APInt.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/GlobalVariable.h>
+
+#include <charconv>
+#include <cmath>
+
+namespace qat::ir {
+
+namespace {
+
+template <typename T> String shortest_float_text(T value) {
+	if (std::isnan(value)) {
+		return "nan";
+	} else if (std::isinf(value)) {
+		return value < 0 ? "-inf" : "inf";
+	} else if (value == 0) {
+		return std::signbit(value) ? "-0.0" : "0.0";
+	}
+	// The shortest round trip form of to_chars has the same digits as the Schubfach algorithm
+	char   buffer[32];
+	auto   result = std::to_chars(buffer, buffer + sizeof(buffer), std::fabs(value), std::chars_format::scientific);
+	String scientific(buffer, result.ptr);
+	auto   exponentPos = scientific.find('e');
+	String digits;
+	for (usize i = 0; i < exponentPos; i++) {
+		if (scientific[i] != '.') {
+			digits += scientific[i];
+		}
+	}
+	auto exponent = std::stoll(scientific.substr(exponentPos + 1)) - (i64)(digits.size() - 1);
+	return NumberText::layout_float(std::signbit(value), digits, exponent);
+}
+
+/// The shortest digits of floats narrower than single precision, which are not supported by the standard library.
+/// The digits are searched for directly, and the nearest candidate of the least number of digits that converts back to
+/// the same value is used. This is the same choice made by the Schubfach algorithm
+String narrow_float_text(llvm::APFloat const& value) {
+	if (value.isNaN()) {
+		return "nan";
+	} else if (value.isInfinity()) {
+		return value.isNegative() ? "-inf" : "inf";
+	} else if (value.isZero()) {
+		return value.isNegative() ? "-0.0" : "0.0";
+	}
+	auto absolute  = llvm::abs(value);
+	auto wide      = absolute;
+	bool losesInfo = false;
+	(void)wide.convert(llvm::APFloat::IEEEdouble(), llvm::APFloat::rmNearestTiesToEven, &losesInfo);
+	// Every narrow float is exact in double precision, and has less than a hundred significant digits
+	char   buffer[160];
+	auto   result = std::to_chars(buffer, buffer + sizeof(buffer), wide.convertToDouble(),
+	                              std::chars_format::scientific, 120);
+	String scientific(buffer, result.ptr);
+	auto   exponentPos  = scientific.find('e');
+	String exact        = scientific.substr(0, 1) + scientific.substr(2, exponentPos - 2);
+	auto   leadExponent = std::stoll(scientific.substr(exponentPos + 1));
+	auto   roundTrips   = [&](String const& digits, i64 exponent) {
+		llvm::APFloat candidate(absolute.getSemantics());
+		auto status = candidate.convertFromString(digits + "e" + std::to_string(exponent),
+		                                          llvm::APFloat::rmNearestTiesToEven);
+		if (not status) {
+			llvm::consumeError(status.takeError());
+			return false;
+		}
+		return candidate.bitwiseIsEqual(absolute);
+	};
+	for (usize count = 1; count < exact.size(); count++) {
+		String lower    = exact.substr(0, count);
+		String rest     = exact.substr(count);
+		auto   exponent = leadExponent - (i64)(count - 1);
+		if (rest.find_first_not_of('0') == String::npos) {
+			return NumberText::layout_float(value.isNegative(), lower, exponent);
+		}
+		String upper = lower;
+		auto   pos   = upper.size();
+		while ((pos > 0) && (upper[pos - 1] == '9')) {
+			upper[pos - 1] = '0';
+			pos--;
+		}
+		if (pos == 0) {
+			upper.insert(upper.begin(), '1');
+		} else {
+			upper[pos - 1]++;
+		}
+		auto lowerFits = roundTrips(lower, exponent);
+		auto upperFits = roundTrips(upper, exponent);
+		if (lowerFits && upperFits) {
+			// The nearest candidate, or the one with an even last digit if the value is halfway between them
+			auto order = rest.compare("5" + String(rest.size() - 1, '0'));
+			auto useLower = (order < 0) || ((order == 0) && (((lower.back() - '0') % 2) == 0));
+			return NumberText::layout_float(value.isNegative(), useLower ? lower : upper, exponent);
+		} else if (lowerFits || upperFits) {
+			return NumberText::layout_float(value.isNegative(), lowerFits ? lower : upper, exponent);
+		}
+	}
+	return NumberText::layout_float(value.isNegative(), exact, leadExponent - (i64)(exact.size() - 1));
+}
+
+} // namespace
+
+String NumberText::layout_float(bool isNegative, String digits, i64 exponent) {
+	while ((digits.size() > 1) && (digits.back() == '0')) {
+		digits.pop_back();
+		exponent++;
+	}
+	String result       = isNegative ? "-" : "";
+	auto   count        = (i64)digits.size();
+	auto   leadExponent = count + exponent - 1;
+	if ((leadExponent >= minPlainExponent) && (leadExponent < maxPlainExponent)) {
+		auto point = count + exponent;
+		if (point <= 0) {
+			result += "0." + String(-point, '0') + digits;
+		} else if (point < count) {
+			result += digits.substr(0, point) + "." + digits.substr(point);
+		} else {
+			result += digits + String(point - count, '0') + ".0";
+		}
+	} else {
+		result += digits.substr(0, 1);
+		if (count > 1) {
+			result += "." + digits.substr(1);
+		}
+		result += (leadExponent < 0) ? "e-" : "e+";
+		auto absExponent = (leadExponent < 0) ? -leadExponent : leadExponent;
+		if (absExponent < 10) {
+			result += "0";
+		}
+		result += std::to_string(absExponent);
+	}
+	return result;
+}
+
+String NumberText::float_to_text(llvm::APFloat const& value) {
+	auto const& semantics = value.getSemantics();
+	if (&semantics == &llvm::APFloat::IEEEdouble()) {
+		return shortest_float_text(value.convertToDouble());
+	} else if (&semantics == &llvm::APFloat::IEEEsingle()) {
+		return shortest_float_text(value.convertToFloat());
+	}
+	return narrow_float_text(value);
+}
+
+void NumberText::define(Mod* mod, Ctx* irCtx, FileRange const& fileRange) {
+	auto* llvmModule = mod->get_llvm_module();
+	if (llvmModule->getFunction(internal_dependency_to_string(InternalDependency::unsignedToText))) {
+		return;
+	}
+	SHOW("Defining the number to text conversions in module " << mod->get_full_name())
+	auto& llCtx        = irCtx->llctx;
+	auto* Ty1Int       = llvm::Type::getInt1Ty(llCtx);
+	auto* Ty8Int       = llvm::Type::getInt8Ty(llCtx);
+	auto* Ty16Int      = llvm::Type::getInt16Ty(llCtx);
+	auto* Ty64Int      = llvm::Type::getInt64Ty(llCtx);
+	auto* Ty128Int     = llvm::Type::getInt128Ty(llCtx);
+	auto  addressSpace = irCtx->dataLayout.getProgramAddressSpace();
+	auto* i8PtrTy      = Ty8Int->getPointerTo(addressSpace);
+	auto* decimalType  = llvm::StructType::get(llCtx, {Ty64Int, Ty64Int});
+
+	auto const64 = [&](i64 value) { return llvm::ConstantInt::get(Ty64Int, value, true); };
+	auto char8   = [&](char value) { return llvm::ConstantInt::get(Ty8Int, value); };
+	auto newFunction = [&](llvm::Type* resultType, Vec<llvm::Type*> const& params, String const& name) {
+		return llvm::Function::Create(llvm::FunctionType::get(resultType, params, false),
+		                              llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage, name, llvmModule);
+	};
+	auto newTable = [&](llvm::Constant* data, String const& name) {
+		auto* result = new llvm::GlobalVariable(*llvmModule, data->getType(), true,
+		                                        llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage, data, name);
+		result->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+		return result;
+	};
+	String pairsText;
+	for (usize i = 0; i < 100; i++) {
+		pairsText += (char)('0' + (i / 10));
+		pairsText += (char)('0' + (i % 10));
+	}
+	auto* digitPairs = newTable(llvm::ConstantDataArray::getString(llCtx, pairsText, false), "qat_digit_pairs");
+	// Every power 10^-k is stored as the 126 bit integer g = floor(10^-k * 2^-r) + 1, where r is chosen so that
+	// 2^125 <= g < 2^126. The upper 63 bits are stored first, followed by the lower 63 bits
+	constexpr u32 powerBitwidth = 1400u;
+
+	auto powerOfTen = [&](i64 exponent) {
+		llvm::APInt result(powerBitwidth, 1u);
+		for (i64 i = 0; i < exponent; i++) {
+			result *= 10u;
+		}
+		return result;
+	};
+	Vec<u64> powerWords;
+	for (i64 k = minPowerExponent; k <= maxPowerExponent; k++) {
+		i64 exponent = -k;
+		i64 shift    = ((exponent * log2Pow10Factor) >> log2Pow10Shift) - 125;
+		llvm::APInt power(powerBitwidth, 0u);
+		if (exponent >= 0) {
+			power = (shift <= 0) ? powerOfTen(exponent).shl(-shift) : powerOfTen(exponent).lshr(shift);
+		} else {
+			power = llvm::APInt::getOneBitSet(powerBitwidth, -shift).udiv(powerOfTen(-exponent));
+		}
+		power += 1u;
+		powerWords.push_back(power.lshr(63u).getZExtValue());
+		powerWords.push_back(power.getLoBits(63u).getZExtValue());
+	}
+	auto* powers = newTable(llvm::ConstantDataArray::get(llCtx, powerWords), "qat_float_text_powers");
+
+	auto* unsignedFn = newFunction(Ty64Int, {Ty64Int, i8PtrTy},
+	                               internal_dependency_to_string(InternalDependency::unsignedToText));
+	auto* signedFn   = newFunction(Ty64Int, {Ty64Int, i8PtrTy},
+	                               internal_dependency_to_string(InternalDependency::signedToText));
+	auto* f64Fn      = newFunction(Ty64Int, {llvm::Type::getDoubleTy(llCtx), i8PtrTy},
+	                               internal_dependency_to_string(InternalDependency::f64ToText));
+	auto* f32Fn      = newFunction(Ty64Int, {llvm::Type::getFloatTy(llCtx), i8PtrTy},
+	                               internal_dependency_to_string(InternalDependency::f32ToText));
+	auto* f16Fn      = newFunction(Ty64Int, {llvm::Type::getHalfTy(llCtx), i8PtrTy},
+	                               internal_dependency_to_string(InternalDependency::f16ToText));
+	auto* bf16Fn     = newFunction(Ty64Int, {llvm::Type::getBFloatTy(llCtx), i8PtrTy},
+	                               internal_dependency_to_string(InternalDependency::bf16ToText));
+	auto* decimalFn  = newFunction(decimalType, {Ty64Int, Ty64Int, Ty1Int}, "qat_float_to_decimal");
+	auto* layoutFn   = newFunction(Ty64Int, {Ty1Int, Ty64Int, Ty64Int, i8PtrTy}, "qat_float_layout");
+	// The conversions are defined when they are first used, which is in the middle of the body of some other function
+	auto savedIP = irCtx->builder.saveIP();
+	auto bytePtr = [&](llvm::Value* base, llvm::Value* offset) {
+		return irCtx->builder.CreateInBoundsGEP(Ty8Int, base, {offset});
+	};
+	auto storeChar = [&](llvm::Value* base, llvm::Value* offset, llvm::Value* charVal) {
+		irCtx->builder.CreateStore(charVal, bytePtr(base, offset));
+	};
+	auto storeText = [&](llvm::Value* base, String const& value) {
+		for (usize i = 0; i < value.size(); i++) {
+			storeChar(base, const64(i), char8(value[i]));
+		}
+	};
+	{
+		SHOW("Creating the unsigned integer conversion")
+		auto* value       = unsignedFn->getArg(0u);
+		auto* output      = unsignedFn->getArg(1u);
+		auto* entry       = llvm::BasicBlock::Create(llCtx, "entry", unsignedFn);
+		auto* pairCond    = llvm::BasicBlock::Create(llCtx, "pairCond", unsignedFn);
+		auto* pairBody    = llvm::BasicBlock::Create(llCtx, "pairBody", unsignedFn);
+		auto* tailBlock   = llvm::BasicBlock::Create(llCtx, "tail", unsignedFn);
+		auto* tailPair    = llvm::BasicBlock::Create(llCtx, "tailPair", unsignedFn);
+		auto* tailSingle  = llvm::BasicBlock::Create(llCtx, "tailSingle", unsignedFn);
+		auto* doneBlock   = llvm::BasicBlock::Create(llCtx, "done", unsignedFn);
+		auto* digitsType  = llvm::ArrayType::get(Ty8Int, maxUnsignedLength);
+		// Copies the two digits of a value below 100, as one unaligned load and store
+		auto copyPairFor = [&](llvm::Value* digits, llvm::Value* pairValue, llvm::Value* position) {
+			auto* pairVal = irCtx->builder.CreateAlignedLoad(
+			    Ty16Int, bytePtr(digitPairs, irCtx->builder.CreateShl(pairValue, 1u)), llvm::MaybeAlign(1u));
+			irCtx->builder.CreateAlignedStore(pairVal, bytePtr(digits, position), llvm::MaybeAlign(1u));
+		};
+		irCtx->builder.SetInsertPoint(entry);
+		auto* digits = irCtx->builder.CreateAlloca(digitsType);
+		irCtx->builder.CreateBr(pairCond);
+		// The digits are produced from the end of the local buffer, two at a time
+		irCtx->builder.SetInsertPoint(pairCond);
+		auto* remaining = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		auto* position  = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		remaining->addIncoming(value, entry);
+		position->addIncoming(const64(maxUnsignedLength), entry);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpUGE(remaining, const64(100)), pairBody, tailBlock);
+		irCtx->builder.SetInsertPoint(pairBody);
+		auto* pairPosition = irCtx->builder.CreateSub(position, const64(2));
+		copyPairFor(digits, irCtx->builder.CreateURem(remaining, const64(100)), pairPosition);
+		remaining->addIncoming(irCtx->builder.CreateUDiv(remaining, const64(100)), pairBody);
+		position->addIncoming(pairPosition, pairBody);
+		irCtx->builder.CreateBr(pairCond);
+		irCtx->builder.SetInsertPoint(tailBlock);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpUGE(remaining, const64(10)), tailPair, tailSingle);
+		irCtx->builder.SetInsertPoint(tailPair);
+		auto* lastPairPosition = irCtx->builder.CreateSub(position, const64(2));
+		copyPairFor(digits, remaining, lastPairPosition);
+		irCtx->builder.CreateBr(doneBlock);
+		irCtx->builder.SetInsertPoint(tailSingle);
+		auto* singlePosition = irCtx->builder.CreateSub(position, const64(1));
+		storeChar(digits, singlePosition,
+		          irCtx->builder.CreateAdd(irCtx->builder.CreateTrunc(remaining, Ty8Int), char8('0')));
+		irCtx->builder.CreateBr(doneBlock);
+		irCtx->builder.SetInsertPoint(doneBlock);
+		auto* start = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		start->addIncoming(lastPairPosition, tailPair);
+		start->addIncoming(singlePosition, tailSingle);
+		auto* length = irCtx->builder.CreateSub(const64(maxUnsignedLength), start);
+		irCtx->builder.CreateMemCpy(output, llvm::MaybeAlign(1u), bytePtr(digits, start), llvm::MaybeAlign(1u), length);
+		irCtx->builder.CreateRet(length);
+	}
+	{
+		SHOW("Creating the signed integer conversion")
+		auto* value         = signedFn->getArg(0u);
+		auto* output        = signedFn->getArg(1u);
+		auto* entry         = llvm::BasicBlock::Create(llCtx, "entry", signedFn);
+		auto* negativeBlock = llvm::BasicBlock::Create(llCtx, "negative", signedFn);
+		auto* positiveBlock = llvm::BasicBlock::Create(llCtx, "positive", signedFn);
+		irCtx->builder.SetInsertPoint(entry);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpSLT(value, const64(0)), negativeBlock, positiveBlock);
+		// The negation is interpreted as unsigned, so that the smallest value is also converted correctly
+		irCtx->builder.SetInsertPoint(negativeBlock);
+		storeText(output, "-");
+		auto* magnitude       = irCtx->builder.CreateNeg(value);
+		auto* magnitudeLength = irCtx->builder.CreateCall(unsignedFn->getFunctionType(), unsignedFn,
+		                                                  {magnitude, bytePtr(output, const64(1))});
+		irCtx->builder.CreateRet(irCtx->builder.CreateAdd(magnitudeLength, const64(1)));
+		irCtx->builder.SetInsertPoint(positiveBlock);
+		irCtx->builder.CreateRet(irCtx->builder.CreateCall(unsignedFn->getFunctionType(), unsignedFn, {value, output}));
+	}
+	{
+		SHOW("Creating the decimal conversion of floats")
+		// This is the core of the Schubfach algorithm. The value is c * 2^q, and the result is the digits and the
+		// exponent of the shortest decimal in the rounding interval of the value, that is closest to the value
+		auto* exponent   = decimalFn->getArg(0u);
+		auto* mantissa   = decimalFn->getArg(1u);
+		auto* irregular  = decimalFn->getArg(2u);
+		auto* entry      = llvm::BasicBlock::Create(llCtx, "entry", decimalFn);
+		auto* tenCheck   = llvm::BasicBlock::Create(llCtx, "tenCheck", decimalFn);
+		auto* tenDone    = llvm::BasicBlock::Create(llCtx, "tenDone", decimalFn);
+		auto* unitCheck  = llvm::BasicBlock::Create(llCtx, "unitCheck", decimalFn);
+		auto* unitDone   = llvm::BasicBlock::Create(llCtx, "unitDone", decimalFn);
+		auto* closest    = llvm::BasicBlock::Create(llCtx, "closest", decimalFn);
+		auto* lowBitMask = const64((i64)((1ull << 63u) - 1u));
+
+		auto mulHigh = [&](llvm::Value* lhs, llvm::Value* rhs) {
+			auto* product = irCtx->builder.CreateMul(irCtx->builder.CreateZExt(lhs, Ty128Int),
+			                                         irCtx->builder.CreateZExt(rhs, Ty128Int));
+			return irCtx->builder.CreateTrunc(irCtx->builder.CreateLShr(product, 64u), Ty64Int);
+		};
+		auto makeDecimal = [&](llvm::Value* digits, llvm::Value* decimalExponent) {
+			auto* result = irCtx->builder.CreateInsertValue(llvm::PoisonValue::get(decimalType), digits, {0u});
+			return irCtx->builder.CreateInsertValue(result, decimalExponent, {1u});
+		};
+		irCtx->builder.SetInsertPoint(entry);
+		auto* isOdd       = irCtx->builder.CreateAnd(mantissa, const64(1));
+		auto* center      = irCtx->builder.CreateShl(mantissa, 2u);
+		auto* upper       = irCtx->builder.CreateAdd(center, const64(2));
+		auto* lower       = irCtx->builder.CreateSelect(irregular, irCtx->builder.CreateSub(center, const64(1)),
+		                                                irCtx->builder.CreateSub(center, const64(2)));
+		auto* scaledExp   = irCtx->builder.CreateMul(exponent, const64(log10Pow2Factor));
+		auto* decimalExp  = irCtx->builder.CreateAShr(
+		    irCtx->builder.CreateSelect(
+		        irregular, irCtx->builder.CreateSub(scaledExp, const64(log10ThreeQuartersAddend)), scaledExp),
+		    log10Pow2Shift);
+		auto* binaryShift = irCtx->builder.CreateAdd(
+		    irCtx->builder.CreateAdd(
+		        exponent, irCtx->builder.CreateAShr(irCtx->builder.CreateMul(irCtx->builder.CreateNeg(decimalExp),
+		                                                                     const64(log2Pow10Factor)),
+		                                            log2Pow10Shift)),
+		    const64(2));
+		auto* powerIndex =
+		    irCtx->builder.CreateShl(irCtx->builder.CreateSub(decimalExp, const64(minPowerExponent)), 1u);
+		auto* powerHigh =
+		    irCtx->builder.CreateLoad(Ty64Int, irCtx->builder.CreateInBoundsGEP(Ty64Int, powers, {powerIndex}));
+		auto* powerLow = irCtx->builder.CreateLoad(
+		    Ty64Int,
+		    irCtx->builder.CreateInBoundsGEP(Ty64Int, powers, {irCtx->builder.CreateAdd(powerIndex, const64(1))}));
+		// Multiplies with the power of ten, rounding to odd so that the comparisons below are exact
+		auto roundOdd = [&](llvm::Value* bound) {
+			auto* scaled  = irCtx->builder.CreateShl(bound, binaryShift);
+			auto* lowHigh = mulHigh(powerLow, scaled);
+			auto* highLow = irCtx->builder.CreateMul(powerHigh, scaled);
+			auto* highVal = mulHigh(powerHigh, scaled);
+			auto* middle  = irCtx->builder.CreateAdd(irCtx->builder.CreateLShr(highLow, 1u), lowHigh);
+			auto* result  = irCtx->builder.CreateAdd(highVal, irCtx->builder.CreateLShr(middle, 63u));
+			return irCtx->builder.CreateOr(
+			    result, irCtx->builder.CreateLShr(
+			                irCtx->builder.CreateAdd(irCtx->builder.CreateAnd(middle, lowBitMask), lowBitMask), 63u));
+		};
+		auto* centerVal = roundOdd(center);
+		auto* lowerVal  = irCtx->builder.CreateAdd(roundOdd(lower), isOdd);
+		auto* upperVal  = roundOdd(upper);
+		auto* candidate = irCtx->builder.CreateLShr(centerVal, 2u);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpUGE(candidate, const64(10)), tenCheck, unitCheck);
+		// A multiple of ten in the rounding interval has one digit less than the candidate
+		irCtx->builder.SetInsertPoint(tenCheck);
+		auto* tenBelow   = irCtx->builder.CreateSub(candidate, irCtx->builder.CreateURem(candidate, const64(10)));
+		auto* tenAbove   = irCtx->builder.CreateAdd(tenBelow, const64(10));
+		auto* tenBelowIn = irCtx->builder.CreateICmpULE(lowerVal, irCtx->builder.CreateShl(tenBelow, 2u));
+		auto* tenAboveIn = irCtx->builder.CreateICmpULE(
+		    irCtx->builder.CreateAdd(irCtx->builder.CreateShl(tenAbove, 2u), isOdd), upperVal);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpNE(tenBelowIn, tenAboveIn), tenDone, unitCheck);
+		irCtx->builder.SetInsertPoint(tenDone);
+		irCtx->builder.CreateRet(makeDecimal(irCtx->builder.CreateSelect(tenBelowIn, tenBelow, tenAbove), decimalExp));
+		irCtx->builder.SetInsertPoint(unitCheck);
+		auto* unitAbove   = irCtx->builder.CreateAdd(candidate, const64(1));
+		auto* unitBelowIn = irCtx->builder.CreateICmpULE(lowerVal, irCtx->builder.CreateShl(candidate, 2u));
+		auto* unitAboveIn = irCtx->builder.CreateICmpULE(
+		    irCtx->builder.CreateAdd(irCtx->builder.CreateShl(unitAbove, 2u), isOdd), upperVal);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpNE(unitBelowIn, unitAboveIn), unitDone, closest);
+		irCtx->builder.SetInsertPoint(unitDone);
+		irCtx->builder.CreateRet(
+		    makeDecimal(irCtx->builder.CreateSelect(unitBelowIn, candidate, unitAbove), decimalExp));
+		// Both neighbours are in the rounding interval, so the one closest to the value is used, and ties go to even
+		irCtx->builder.SetInsertPoint(closest);
+		auto* difference = irCtx->builder.CreateSub(
+		    centerVal, irCtx->builder.CreateShl(irCtx->builder.CreateAdd(candidate, unitAbove), 1u));
+		auto* useBelow = irCtx->builder.CreateOr(
+		    irCtx->builder.CreateICmpSLT(difference, const64(0)),
+		    irCtx->builder.CreateAnd(irCtx->builder.CreateICmpEQ(difference, const64(0)),
+		                             irCtx->builder.CreateIsNull(irCtx->builder.CreateAnd(candidate, const64(1)))));
+		irCtx->builder.CreateRet(makeDecimal(irCtx->builder.CreateSelect(useBelow, candidate, unitAbove), decimalExp));
+	}
+	{
+		SHOW("Creating the layout of floats")
+		auto* isNegative     = layoutFn->getArg(0u);
+		auto* digitsVal      = layoutFn->getArg(1u);
+		auto* exponentVal    = layoutFn->getArg(2u);
+		auto* output         = layoutFn->getArg(3u);
+		auto* entry          = llvm::BasicBlock::Create(llCtx, "entry", layoutFn);
+		auto* stripCond      = llvm::BasicBlock::Create(llCtx, "stripCond", layoutFn);
+		auto* stripNext      = llvm::BasicBlock::Create(llCtx, "stripNext", layoutFn);
+		auto* strippedBlock  = llvm::BasicBlock::Create(llCtx, "stripped", layoutFn);
+		auto* plainBlock     = llvm::BasicBlock::Create(llCtx, "plain", layoutFn);
+		auto* leadZeroBlock  = llvm::BasicBlock::Create(llCtx, "leadZero", layoutFn);
+		auto* pointBlock     = llvm::BasicBlock::Create(llCtx, "point", layoutFn);
+		auto* middleBlock    = llvm::BasicBlock::Create(llCtx, "middle", layoutFn);
+		auto* trailingBlock  = llvm::BasicBlock::Create(llCtx, "trailing", layoutFn);
+		auto* scientificBlck = llvm::BasicBlock::Create(llCtx, "scientific", layoutFn);
+		auto* digitsType     = llvm::ArrayType::get(Ty8Int, maxUnsignedLength);
+		irCtx->builder.SetInsertPoint(entry);
+		auto* digits     = irCtx->builder.CreateAlloca(digitsType);
+		auto* fullLength = irCtx->builder.CreateCall(unsignedFn->getFunctionType(), unsignedFn, {digitsVal, digits});
+		irCtx->builder.CreateBr(stripCond);
+		irCtx->builder.SetInsertPoint(stripCond);
+		auto* count    = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		auto* exponent = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		count->addIncoming(fullLength, entry);
+		exponent->addIncoming(exponentVal, entry);
+		auto* lastDigit =
+		    irCtx->builder.CreateLoad(Ty8Int, bytePtr(digits, irCtx->builder.CreateSub(count, const64(1))));
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateAnd(irCtx->builder.CreateICmpUGT(count, const64(1)),
+		                                                     irCtx->builder.CreateICmpEQ(lastDigit, char8('0'))),
+		                            stripNext, strippedBlock);
+		irCtx->builder.SetInsertPoint(stripNext);
+		count->addIncoming(irCtx->builder.CreateSub(count, const64(1)), stripNext);
+		exponent->addIncoming(irCtx->builder.CreateAdd(exponent, const64(1)), stripNext);
+		irCtx->builder.CreateBr(stripCond);
+		// The sign is always stored, and is overwritten by the text if the value is not negative
+		irCtx->builder.SetInsertPoint(strippedBlock);
+		storeText(output, "-");
+		auto* start        = irCtx->builder.CreateZExt(isNegative, Ty64Int);
+		auto* text         = bytePtr(output, start);
+		auto* leadExponent = irCtx->builder.CreateSub(irCtx->builder.CreateAdd(count, exponent), const64(1));
+		irCtx->builder.CreateCondBr(
+		    irCtx->builder.CreateAnd(irCtx->builder.CreateICmpSGE(leadExponent, const64(minPlainExponent)),
+		                             irCtx->builder.CreateICmpSLT(leadExponent, const64(maxPlainExponent))),
+		    plainBlock, scientificBlck);
+		irCtx->builder.SetInsertPoint(plainBlock);
+		auto* point = irCtx->builder.CreateAdd(count, exponent);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpSLE(point, const64(0)), leadZeroBlock, pointBlock);
+		irCtx->builder.SetInsertPoint(leadZeroBlock);
+		auto* zeroCount = irCtx->builder.CreateNeg(point);
+		storeText(text, "0.");
+		irCtx->builder.CreateMemSet(bytePtr(text, const64(2)), char8('0'), zeroCount, llvm::MaybeAlign(1u));
+		irCtx->builder.CreateMemCpy(bytePtr(text, irCtx->builder.CreateAdd(zeroCount, const64(2))),
+		                            llvm::MaybeAlign(1u), digits, llvm::MaybeAlign(1u), count);
+		irCtx->builder.CreateRet(irCtx->builder.CreateAdd(
+		    irCtx->builder.CreateAdd(start, const64(2)), irCtx->builder.CreateAdd(zeroCount, count)));
+		irCtx->builder.SetInsertPoint(pointBlock);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpSLT(point, count), middleBlock, trailingBlock);
+		irCtx->builder.SetInsertPoint(middleBlock);
+		irCtx->builder.CreateMemCpy(text, llvm::MaybeAlign(1u), digits, llvm::MaybeAlign(1u), point);
+		storeChar(text, point, char8('.'));
+		irCtx->builder.CreateMemCpy(bytePtr(text, irCtx->builder.CreateAdd(point, const64(1))), llvm::MaybeAlign(1u),
+		                            bytePtr(digits, point), llvm::MaybeAlign(1u),
+		                            irCtx->builder.CreateSub(count, point));
+		irCtx->builder.CreateRet(irCtx->builder.CreateAdd(start, irCtx->builder.CreateAdd(count, const64(1))));
+		irCtx->builder.SetInsertPoint(trailingBlock);
+		irCtx->builder.CreateMemCpy(text, llvm::MaybeAlign(1u), digits, llvm::MaybeAlign(1u), count);
+		irCtx->builder.CreateMemSet(bytePtr(text, count), char8('0'), irCtx->builder.CreateSub(point, count),
+		                            llvm::MaybeAlign(1u));
+		storeText(bytePtr(text, point), ".0");
+		irCtx->builder.CreateRet(irCtx->builder.CreateAdd(start, irCtx->builder.CreateAdd(point, const64(2))));
+		// The point is always stored after the first digit, and is overwritten by the exponent if there is one digit
+		irCtx->builder.SetInsertPoint(scientificBlck);
+		storeChar(text, const64(0), irCtx->builder.CreateLoad(Ty8Int, digits));
+		storeChar(text, const64(1), char8('.'));
+		irCtx->builder.CreateMemCpy(bytePtr(text, const64(2)), llvm::MaybeAlign(1u), bytePtr(digits, const64(1)),
+		                            llvm::MaybeAlign(1u), irCtx->builder.CreateSub(count, const64(1)));
+		auto* mantissaLength = irCtx->builder.CreateSelect(irCtx->builder.CreateICmpUGT(count, const64(1)),
+		                                                   irCtx->builder.CreateAdd(count, const64(1)), const64(1));
+		auto* marker         = bytePtr(text, mantissaLength);
+		auto* isNegativeExp  = irCtx->builder.CreateICmpSLT(leadExponent, const64(0));
+		auto* absExponent =
+		    irCtx->builder.CreateSelect(isNegativeExp, irCtx->builder.CreateNeg(leadExponent), leadExponent);
+		auto* padding = irCtx->builder.CreateZExt(irCtx->builder.CreateICmpULT(absExponent, const64(10)), Ty64Int);
+		storeChar(marker, const64(0), char8('e'));
+		storeChar(marker, const64(1), irCtx->builder.CreateSelect(isNegativeExp, char8('-'), char8('+')));
+		storeChar(marker, const64(2), char8('0'));
+		auto* exponentLength =
+		    irCtx->builder.CreateCall(unsignedFn->getFunctionType(), unsignedFn,
+		                              {absExponent, bytePtr(marker, irCtx->builder.CreateAdd(padding, const64(2)))});
+		irCtx->builder.CreateRet(irCtx->builder.CreateAdd(
+		    irCtx->builder.CreateAdd(start, mantissaLength),
+		    irCtx->builder.CreateAdd(irCtx->builder.CreateAdd(padding, const64(2)), exponentLength)));
+	}
+	// Defines the conversion of a float kind, which handles the special values and the fast path for integral values
+	// before using the decimal conversion
+	auto defineFloat = [&](llvm::Function* floatFn, u32 bitwidth, u32 mantissaBits, i64 bias, i64 minExponent) {
+		auto* bitsType      = llvm::Type::getIntNTy(llCtx, bitwidth);
+		auto* value         = floatFn->getArg(0u);
+		auto* output        = floatFn->getArg(1u);
+		auto* entry         = llvm::BasicBlock::Create(llCtx, "entry", floatFn);
+		auto* specialBlock  = llvm::BasicBlock::Create(llCtx, "special", floatFn);
+		auto* nanBlock      = llvm::BasicBlock::Create(llCtx, "nan", floatFn);
+		auto* infBlock      = llvm::BasicBlock::Create(llCtx, "infinite", floatFn);
+		auto* finiteBlock   = llvm::BasicBlock::Create(llCtx, "finite", floatFn);
+		auto* tinyBlock     = llvm::BasicBlock::Create(llCtx, "tiny", floatFn);
+		auto* zeroBlock     = llvm::BasicBlock::Create(llCtx, "zero", floatFn);
+		auto* subnormalBlck = llvm::BasicBlock::Create(llCtx, "subnormal", floatFn);
+		auto* normalBlock   = llvm::BasicBlock::Create(llCtx, "normal", floatFn);
+		auto* integralBlock = llvm::BasicBlock::Create(llCtx, "integral", floatFn);
+		auto* generalBlock  = llvm::BasicBlock::Create(llCtx, "general", floatFn);
+		auto* layoutBlock   = llvm::BasicBlock::Create(llCtx, "layout", floatFn);
+		auto* exponentMask  = const64((1 << (bitwidth - mantissaBits - 1)) - 1);
+		irCtx->builder.SetInsertPoint(entry);
+		auto* bits         = irCtx->builder.CreateBitCast(value, bitsType);
+		auto* isNegative   = irCtx->builder.CreateICmpSLT(bits, llvm::ConstantInt::get(bitsType, 0u));
+		auto* wideBits     = irCtx->builder.CreateZExt(bits, Ty64Int);
+		auto* biasedExp    = irCtx->builder.CreateAnd(irCtx->builder.CreateLShr(wideBits, mantissaBits), exponentMask);
+		auto* fraction     = irCtx->builder.CreateAnd(wideBits, const64((1ll << mantissaBits) - 1));
+		auto* signedStart  = irCtx->builder.CreateZExt(isNegative, Ty64Int);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpEQ(biasedExp, exponentMask), specialBlock, finiteBlock);
+		irCtx->builder.SetInsertPoint(specialBlock);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(fraction), infBlock, nanBlock);
+		irCtx->builder.SetInsertPoint(nanBlock);
+		storeText(output, "nan");
+		irCtx->builder.CreateRet(const64(3));
+		irCtx->builder.SetInsertPoint(infBlock);
+		storeText(output, "-");
+		storeText(bytePtr(output, signedStart), "inf");
+		irCtx->builder.CreateRet(irCtx->builder.CreateAdd(signedStart, const64(3)));
+		irCtx->builder.SetInsertPoint(finiteBlock);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(biasedExp), tinyBlock, normalBlock);
+		irCtx->builder.SetInsertPoint(tinyBlock);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(fraction), zeroBlock, subnormalBlck);
+		irCtx->builder.SetInsertPoint(zeroBlock);
+		storeText(output, "-");
+		storeText(bytePtr(output, signedStart), "0.0");
+		irCtx->builder.CreateRet(irCtx->builder.CreateAdd(signedStart, const64(3)));
+		irCtx->builder.SetInsertPoint(subnormalBlck);
+		auto* subnormalVal =
+		    irCtx->builder.CreateCall(decimalFn->getFunctionType(), decimalFn,
+		                              {const64(minExponent), fraction, llvm::ConstantInt::getFalse(llCtx)});
+		auto* subnormalDigits = irCtx->builder.CreateExtractValue(subnormalVal, {0u});
+		auto* subnormalExp    = irCtx->builder.CreateExtractValue(subnormalVal, {1u});
+		irCtx->builder.CreateBr(layoutBlock);
+		irCtx->builder.SetInsertPoint(normalBlock);
+		auto* shift    = irCtx->builder.CreateSub(const64(bias), biasedExp);
+		auto* mantissa = irCtx->builder.CreateOr(fraction, const64(1ll << mantissaBits));
+		irCtx->builder.CreateCondBr(
+		    irCtx->builder.CreateAnd(irCtx->builder.CreateICmpSGT(shift, const64(0)),
+		                             irCtx->builder.CreateICmpSLE(shift, const64(mantissaBits))),
+		    integralBlock, generalBlock);
+		// Values that are integers are written directly, without searching for the shortest digits
+		irCtx->builder.SetInsertPoint(integralBlock);
+		auto* integral = irCtx->builder.CreateLShr(mantissa, shift);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpEQ(irCtx->builder.CreateShl(integral, shift), mantissa),
+		                            layoutBlock, generalBlock);
+		// The spacing of values below a power of two is irregular, as the exponent changes there
+		irCtx->builder.SetInsertPoint(generalBlock);
+		auto* binaryExp = irCtx->builder.CreateNeg(shift);
+		auto* isIrregular =
+		    irCtx->builder.CreateAnd(irCtx->builder.CreateIsNull(fraction),
+		                             irCtx->builder.CreateICmpNE(binaryExp, const64(minExponent)));
+		auto* generalVal    = irCtx->builder.CreateCall(decimalFn->getFunctionType(), decimalFn,
+		                                                {binaryExp, mantissa, isIrregular});
+		auto* generalDigits = irCtx->builder.CreateExtractValue(generalVal, {0u});
+		auto* generalExp    = irCtx->builder.CreateExtractValue(generalVal, {1u});
+		irCtx->builder.CreateBr(layoutBlock);
+		irCtx->builder.SetInsertPoint(layoutBlock);
+		auto* digits   = irCtx->builder.CreatePHI(Ty64Int, 3u);
+		auto* exponent = irCtx->builder.CreatePHI(Ty64Int, 3u);
+		digits->addIncoming(subnormalDigits, subnormalBlck);
+		digits->addIncoming(integral, integralBlock);
+		digits->addIncoming(generalDigits, generalBlock);
+		exponent->addIncoming(subnormalExp, subnormalBlck);
+		exponent->addIncoming(const64(0), integralBlock);
+		exponent->addIncoming(generalExp, generalBlock);
+		irCtx->builder.CreateRet(irCtx->builder.CreateCall(layoutFn->getFunctionType(), layoutFn,
+		                                                   {isNegative, digits, exponent, output}));
+	};
+	SHOW("Creating the float conversions")
+	defineFloat(f64Fn, 64u, 52u, 1075, -1074);
+	defineFloat(f32Fn, 32u, 23u, 150, -149);
+	defineFloat(f16Fn, 16u, 10u, 25, -24);
+	defineFloat(bf16Fn, 16u, 7u, 134, -133);
+	irCtx->builder.restoreIP(savedIP);
+}
+
+} // namespace qat::ir
@@ -0,0 +1,53 @@
+#ifndef QAT_IR_NUMBER_TEXT_HPP
+#define QAT_IR_NUMBER_TEXT_HPP
+
+#include "../utils/file_range.hpp"
+#include "../utils/helpers.hpp"
+#include "../utils/macros.hpp"
+
+#include <llvm/ADT/APFloat.h>
+
+namespace qat::ir {
+
+class Ctx;
+class Mod;
+
+/// The conversions of integers and floats to text that are provided by the compiler. Integers are converted two digits
+/// at a time using a table of digit pairs. Floats are converted to the shortest digits that convert back to the same
+/// value, using the Schubfach algorithm, and are laid out like the `repr` of Python. Every conversion writes to a
+/// buffer provided by the caller and gives the length of the text
+class NumberText {
+	/// The range of decimal exponents in the table of powers of ten used by the float conversion
+	static constexpr i64 minPowerExponent = -324;
+	static constexpr i64 maxPowerExponent = 292;
+
+	/// Fixed point approximations of the logarithms, as in the Schubfach paper
+	static constexpr i64 log10Pow2Factor          = 661971961083;
+	static constexpr i64 log10ThreeQuartersAddend = 274743187321;
+	static constexpr i64 log10Pow2Shift           = 41;
+	static constexpr i64 log2Pow10Factor          = 913124641741;
+	static constexpr i64 log2Pow10Shift           = 38;
+
+	/// Floats with a decimal exponent in this range are written without an exponent
+	static constexpr i64 minPlainExponent = -4;
+	static constexpr i64 maxPlainExponent = 16;
+
+  public:
+	static constexpr u64 maxUnsignedLength = 20u;
+	static constexpr u64 maxSignedLength   = 20u;
+	static constexpr u64 maxFloatLength    = 24u;
+
+	/// Defines the conversion functions in the module, if they are not defined already
+	static void define(Mod* mod, Ctx* irCtx, FileRange const& fileRange);
+
+	/// Lays out the text of a finite float, from its decimal digits and the exponent of the last digit
+	useit static String layout_float(bool isNegative, String digits, i64 exponent);
+
+	/// The same text as the conversion functions, for values known while compiling. Only half, brain, single and double
+	/// precision floats are supported
+	useit static String float_to_text(llvm::APFloat const& value);
+};
+
+} // namespace qat::ir
+
+#endif
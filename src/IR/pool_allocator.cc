@@ -0,0 +1,216 @@
+#include "./pool_allocator.hpp"
+#include "../show.hpp"
+#include "./context.hpp"
+#include "./qat_module.hpp"
+
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/MDBuilder.h>
+
+namespace qat::ir {
+
+void PoolAllocator::define(Mod* mod, Ctx* irCtx, FileRange const& fileRange) {
+	auto* llvmModule = mod->get_llvm_module();
+	if (llvmModule->getFunction(internal_dependency_to_string(InternalDependency::poolAllocate))) {
+		return;
+	}
+	SHOW("Defining the pool allocator in module " << mod->get_full_name())
+	auto& llCtx        = irCtx->llctx;
+	auto* Ty64Int      = llvm::Type::getInt64Ty(llCtx);
+	auto  addressSpace = irCtx->dataLayout.getProgramAddressSpace();
+	auto* i8PtrTy      = llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace);
+	auto  mallocName   = mod->link_internal_dependency(InternalDependency::malloc, irCtx, fileRange);
+	auto* mallocFn     = llvmModule->getFunction(mallocName);
+	auto  freeName     = mod->link_internal_dependency(InternalDependency::free, irCtx, fileRange);
+	auto* freeFn       = llvmModule->getFunction(freeName);
+	auto  reallocName  = mod->link_internal_dependency(InternalDependency::realloc, irCtx, fileRange);
+	auto* reallocFn    = llvmModule->getFunction(reallocName);
+	auto* listsType    = llvm::ArrayType::get(i8PtrTy, classCount);
+	auto* freeLists    = new llvm::GlobalVariable(*llvmModule, listsType, false,
+	                                              llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+	                                              llvm::ConstantAggregateZero::get(listsType), "qat_pool_free_lists");
+	freeLists->setThreadLocalMode(llvm::GlobalValue::GeneralDynamicTLSModel);
+	auto* allocateFn = llvm::Function::Create(
+	    llvm::FunctionType::get(i8PtrTy, {Ty64Int}, false), llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+	    internal_dependency_to_string(InternalDependency::poolAllocate), llvmModule);
+	auto* freePoolFn = llvm::Function::Create(
+	    llvm::FunctionType::get(llvm::Type::getVoidTy(llCtx), {i8PtrTy}, false),
+	    llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+	    internal_dependency_to_string(InternalDependency::poolFree), llvmModule);
+	auto* reallocateFn = llvm::Function::Create(
+	    llvm::FunctionType::get(i8PtrTy, {i8PtrTy, Ty64Int}, false),
+	    llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+	    internal_dependency_to_string(InternalDependency::poolReallocate), llvmModule);
+	auto* nullPtr    = llvm::ConstantPointerNull::get(i8PtrTy);
+	auto* largeClass = llvm::ConstantInt::get(Ty64Int, largeClassID);
+	// The allocator is defined when it is first used, which is in the middle of the body of some other function
+	auto savedIP   = irCtx->builder.saveIP();
+	auto listEntry = [&](llvm::Value* classID) {
+		return irCtx->builder.CreateInBoundsGEP(listsType, freeLists, {llvm::ConstantInt::get(Ty64Int, 0u), classID});
+	};
+	auto headerOf = [&](llvm::Value* data) {
+		return irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), data,
+		                                        {llvm::ConstantInt::get(Ty64Int, -(i64)headerSize, true)});
+	};
+	auto classOf = [&](llvm::Value* block) {
+		return irCtx->builder.CreateLoad(Ty64Int, irCtx->builder.CreatePointerCast(block, Ty64Int->getPointerTo()));
+	};
+	auto dataOf = [&](llvm::Value* block) {
+		return irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), block,
+		                                        {llvm::ConstantInt::get(Ty64Int, headerSize)});
+	};
+	{
+		SHOW("Creating the allocate function of the pool allocator")
+		auto* size        = allocateFn->getArg(0u);
+		auto* entry       = llvm::BasicBlock::Create(llCtx, "entry", allocateFn);
+		auto* smallBlock  = llvm::BasicBlock::Create(llCtx, "small", allocateFn);
+		auto* popBlock    = llvm::BasicBlock::Create(llCtx, "pop", allocateFn);
+		auto* refillBlock = llvm::BasicBlock::Create(llCtx, "refill", allocateFn);
+		auto* splitCond   = llvm::BasicBlock::Create(llCtx, "splitCond", allocateFn);
+		auto* splitMain   = llvm::BasicBlock::Create(llCtx, "splitMain", allocateFn);
+		auto* splitDone   = llvm::BasicBlock::Create(llCtx, "splitDone", allocateFn);
+		auto* foundBlock  = llvm::BasicBlock::Create(llCtx, "found", allocateFn);
+		auto* largeBlock  = llvm::BasicBlock::Create(llCtx, "large", allocateFn);
+		auto* largeDone   = llvm::BasicBlock::Create(llCtx, "largeDone", allocateFn);
+		auto* failBlock   = llvm::BasicBlock::Create(llCtx, "fail", allocateFn);
+		irCtx->builder.SetInsertPoint(entry);
+		irCtx->builder.CreateCondBr(
+		    irCtx->builder.CreateICmpULE(size, llvm::ConstantInt::get(Ty64Int, granule * classCount)), smallBlock,
+		    largeBlock, llvm::MDBuilder(llCtx).createBranchWeights(2000u, 1u));
+		irCtx->builder.SetInsertPoint(smallBlock);
+		// A size of zero uses the smallest class, so that every allocation provides a unique pointer
+		auto* nonZeroSize = irCtx->builder.CreateSelect(irCtx->builder.CreateIsNull(size),
+		                                                llvm::ConstantInt::get(Ty64Int, 1u), size);
+		auto* sizeBelow   = irCtx->builder.CreateSub(nonZeroSize, llvm::ConstantInt::get(Ty64Int, 1u));
+		auto* classID     = irCtx->builder.CreateLShr(sizeBelow, granuleShift);
+		auto* listPtr     = listEntry(classID);
+		auto* headVal     = irCtx->builder.CreateLoad(i8PtrTy, listPtr);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(headVal), refillBlock, popBlock,
+		                            llvm::MDBuilder(llCtx).createBranchWeights(1u, 2000u));
+		irCtx->builder.SetInsertPoint(popBlock);
+		// A free entry keeps the next entry of the list in place of its data
+		irCtx->builder.CreateStore(irCtx->builder.CreateLoad(i8PtrTy, dataOf(headVal)), listPtr);
+		irCtx->builder.CreateBr(foundBlock);
+		irCtx->builder.SetInsertPoint(refillBlock);
+		auto* entrySize = irCtx->builder.CreateAdd(
+		    irCtx->builder.CreateMul(irCtx->builder.CreateAdd(classID, llvm::ConstantInt::get(Ty64Int, 1u)),
+		                             llvm::ConstantInt::get(Ty64Int, granule)),
+		    llvm::ConstantInt::get(Ty64Int, headerSize));
+		auto* chunk = irCtx->builder.CreateCall(mallocFn->getFunctionType(), mallocFn,
+		                                        {llvm::ConstantInt::get(Ty64Int, chunkSize)});
+		auto* entryCount = irCtx->builder.CreateUDiv(llvm::ConstantInt::get(Ty64Int, chunkSize), entrySize);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(chunk), failBlock, splitCond);
+		// The first entry of the chunk is the result, and the rest of the entries are added to the free list
+		irCtx->builder.SetInsertPoint(splitCond);
+		auto* splitIndex = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		auto* splitHead  = irCtx->builder.CreatePHI(i8PtrTy, 2u);
+		splitIndex->addIncoming(llvm::ConstantInt::get(Ty64Int, 1u), refillBlock);
+		splitHead->addIncoming(nullPtr, refillBlock);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpULT(splitIndex, entryCount), splitMain, splitDone);
+		irCtx->builder.SetInsertPoint(splitMain);
+		auto* splitEntry = irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), chunk,
+		                                                    {irCtx->builder.CreateMul(splitIndex, entrySize)});
+		irCtx->builder.CreateStore(splitHead, dataOf(splitEntry));
+		splitIndex->addIncoming(irCtx->builder.CreateAdd(splitIndex, llvm::ConstantInt::get(Ty64Int, 1u)), splitMain);
+		splitHead->addIncoming(splitEntry, splitMain);
+		irCtx->builder.CreateBr(splitCond);
+		irCtx->builder.SetInsertPoint(splitDone);
+		irCtx->builder.CreateStore(splitHead, listPtr);
+		irCtx->builder.CreateBr(foundBlock);
+		irCtx->builder.SetInsertPoint(foundBlock);
+		auto* foundEntry = irCtx->builder.CreatePHI(i8PtrTy, 2u);
+		foundEntry->addIncoming(headVal, popBlock);
+		foundEntry->addIncoming(chunk, splitDone);
+		irCtx->builder.CreateStore(classID, irCtx->builder.CreatePointerCast(foundEntry, Ty64Int->getPointerTo()));
+		irCtx->builder.CreateRet(dataOf(foundEntry));
+		irCtx->builder.SetInsertPoint(largeBlock);
+		auto* largeVal = irCtx->builder.CreateCall(
+		    mallocFn->getFunctionType(), mallocFn,
+		    {irCtx->builder.CreateAdd(size, llvm::ConstantInt::get(Ty64Int, headerSize))});
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(largeVal), failBlock, largeDone);
+		irCtx->builder.SetInsertPoint(largeDone);
+		irCtx->builder.CreateStore(largeClass, irCtx->builder.CreatePointerCast(largeVal, Ty64Int->getPointerTo()));
+		irCtx->builder.CreateRet(dataOf(largeVal));
+		irCtx->builder.SetInsertPoint(failBlock);
+		irCtx->builder.CreateRet(nullPtr);
+	}
+	{
+		SHOW("Creating the free function of the pool allocator")
+		auto* data       = freePoolFn->getArg(0u);
+		auto* entry      = llvm::BasicBlock::Create(llCtx, "entry", freePoolFn);
+		auto* checkBlock = llvm::BasicBlock::Create(llCtx, "check", freePoolFn);
+		auto* smallBlock = llvm::BasicBlock::Create(llCtx, "small", freePoolFn);
+		auto* largeBlock = llvm::BasicBlock::Create(llCtx, "large", freePoolFn);
+		auto* doneBlock  = llvm::BasicBlock::Create(llCtx, "done", freePoolFn);
+		irCtx->builder.SetInsertPoint(entry);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(data), doneBlock, checkBlock);
+		irCtx->builder.SetInsertPoint(checkBlock);
+		auto* block   = headerOf(data);
+		auto* classID = classOf(block);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpEQ(classID, largeClass), largeBlock, smallBlock);
+		irCtx->builder.SetInsertPoint(smallBlock);
+		// The entry goes to the list of the thread that frees it, which might not be the thread that allocated it
+		auto* listPtr = listEntry(classID);
+		irCtx->builder.CreateStore(irCtx->builder.CreateLoad(i8PtrTy, listPtr), data);
+		irCtx->builder.CreateStore(block, listPtr);
+		irCtx->builder.CreateBr(doneBlock);
+		irCtx->builder.SetInsertPoint(largeBlock);
+		irCtx->builder.CreateCall(freeFn->getFunctionType(), freeFn, {block});
+		irCtx->builder.CreateBr(doneBlock);
+		irCtx->builder.SetInsertPoint(doneBlock);
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the reallocate function of the pool allocator")
+		auto* data         = reallocateFn->getArg(0u);
+		auto* size         = reallocateFn->getArg(1u);
+		auto* entry        = llvm::BasicBlock::Create(llCtx, "entry", reallocateFn);
+		auto* newBlock     = llvm::BasicBlock::Create(llCtx, "new", reallocateFn);
+		auto* checkBlock   = llvm::BasicBlock::Create(llCtx, "check", reallocateFn);
+		auto* largeBlock   = llvm::BasicBlock::Create(llCtx, "large", reallocateFn);
+		auto* largeDone    = llvm::BasicBlock::Create(llCtx, "largeDone", reallocateFn);
+		auto* smallBlock   = llvm::BasicBlock::Create(llCtx, "small", reallocateFn);
+		auto* moveBlock    = llvm::BasicBlock::Create(llCtx, "move", reallocateFn);
+		auto* movedBlock   = llvm::BasicBlock::Create(llCtx, "moved", reallocateFn);
+		auto* inPlaceBlock = llvm::BasicBlock::Create(llCtx, "inPlace", reallocateFn);
+		auto* failBlock    = llvm::BasicBlock::Create(llCtx, "fail", reallocateFn);
+		irCtx->builder.SetInsertPoint(entry);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(data), newBlock, checkBlock);
+		irCtx->builder.SetInsertPoint(newBlock);
+		irCtx->builder.CreateRet(irCtx->builder.CreateCall(allocateFn->getFunctionType(), allocateFn, {size}));
+		irCtx->builder.SetInsertPoint(checkBlock);
+		auto* block   = headerOf(data);
+		auto* classID = classOf(block);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpEQ(classID, largeClass), largeBlock, smallBlock);
+		// Large allocations stay with malloc, even if the new size would fit in a size class
+		irCtx->builder.SetInsertPoint(largeBlock);
+		auto* largeVal = irCtx->builder.CreateCall(
+		    reallocFn->getFunctionType(), reallocFn,
+		    {block, irCtx->builder.CreateAdd(size, llvm::ConstantInt::get(Ty64Int, headerSize))});
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(largeVal), failBlock, largeDone);
+		irCtx->builder.SetInsertPoint(largeDone);
+		irCtx->builder.CreateRet(dataOf(largeVal));
+		irCtx->builder.SetInsertPoint(smallBlock);
+		auto* classEnd = irCtx->builder.CreateAdd(classID, llvm::ConstantInt::get(Ty64Int, 1u));
+		auto* capacity = irCtx->builder.CreateShl(classEnd, granuleShift);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpULE(size, capacity), inPlaceBlock, moveBlock);
+		irCtx->builder.SetInsertPoint(inPlaceBlock);
+		irCtx->builder.CreateRet(data);
+		irCtx->builder.SetInsertPoint(moveBlock);
+		auto* movedVal = irCtx->builder.CreateCall(allocateFn->getFunctionType(), allocateFn, {size});
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(movedVal), failBlock, movedBlock);
+		irCtx->builder.SetInsertPoint(movedBlock);
+		irCtx->builder.CreateMemCpy(movedVal, llvm::MaybeAlign(headerSize), data, llvm::MaybeAlign(headerSize),
+		                            capacity);
+		irCtx->builder.CreateCall(freePoolFn->getFunctionType(), freePoolFn, {data});
+		irCtx->builder.CreateRet(movedVal);
+		irCtx->builder.SetInsertPoint(failBlock);
+		irCtx->builder.CreateRet(nullPtr);
+	}
+	irCtx->builder.restoreIP(savedIP);
+}
+
+} // namespace qat::ir
@@ -0,0 +1,33 @@
+#ifndef QAT_IR_POOL_ALLOCATOR_HPP
+#define QAT_IR_POOL_ALLOCATOR_HPP
+
+#include "../utils/file_range.hpp"
+#include "../utils/helpers.hpp"
+#include "../utils/macros.hpp"
+
+namespace qat::ir {
+
+class Ctx;
+class Mod;
+
+/// The size class allocator that is used for all heap memory instead of malloc, realloc and free when the
+/// `--heap-allocator` flag is "pool". Small allocations are served from free lists that are local to the thread, one for
+/// every size class, and the lists are refilled by splitting chunks obtained from malloc. Larger allocations go
+/// directly to malloc. Every allocation has a header with its size class, so any thread can free it
+class PoolAllocator {
+	/// The sizes of the classes are multiples of the granule, up to the largest class
+	static constexpr u64 granuleShift = 4u;
+	static constexpr u64 granule      = 1u << granuleShift;
+	static constexpr u64 classCount   = 16u;
+	static constexpr u64 headerSize   = 16u;
+	static constexpr u64 chunkSize    = 64u * 1024u;
+	static constexpr u64 largeClassID = ~((u64)0u);
+
+  public:
+	/// Defines the functions of the allocator in the module, if they are not defined already
+	static void define(Mod* mod, Ctx* irCtx, FileRange const& fileRange);
+};
+
+} // namespace qat::ir
+
+#endif
@@ -0,0 +1,462 @@
+#include "./prerun_bytecode.hpp"
+#include "../ast/expression.hpp"
+#include "../ast/prerun_sentences/prerun_sentence.hpp"
+#include "./context.hpp"
+#include "./prerun_function.hpp"
+#include "./prerun_profile.hpp"
+#include "./types/float.hpp"
+#include "./types/integer.hpp"
+#include "./types/unsigned.hpp"
+
+#include <cmath>
+#include <llvm/IR/Constants.h>
+
+namespace qat::ir {
+
+static inline u64 wrap_bits(u64 value, u32 width) {
+	return (width >= 64u) ? value : (value & ((((u64)1u) << width) - 1u));
+}
+
+static inline i64 sign_extend(u64 value, u32 width) {
+	return (width >= 64u) ? (i64)value : (((i64)(value << (64u - width))) >> (64u - width));
+}
+
+static inline double round_real(double value, u32 width) { return (width == 32u) ? (double)((float)value) : value; }
+
+bool PreBytecode::is_supported_type(Type* type) {
+	switch (type->type_kind()) {
+		case TypeKind::INTEGER:
+			return type->as_integer()->get_bitwidth() <= 64u;
+		case TypeKind::UNSIGNED_INTEGER:
+			return type->as_unsigned()->get_bitwidth() <= 64u;
+		case TypeKind::FLOAT:
+			return (type->as_float()->get_float_kind() == FloatTypeKind::_32) ||
+			       (type->as_float()->get_float_kind() == FloatTypeKind::_64);
+		default:
+			return false;
+	}
+}
+
+u32 PreBytecode::get_width(Type* type) {
+	switch (type->type_kind()) {
+		case TypeKind::INTEGER:
+			return type->as_integer()->get_bitwidth();
+		case TypeKind::UNSIGNED_INTEGER:
+			return type->as_unsigned()->get_bitwidth();
+		case TypeKind::FLOAT:
+			return (type->as_float()->get_float_kind() == FloatTypeKind::_32) ? 32u : 64u;
+		default:
+			return 0u;
+	}
+}
+
+Maybe<PreRegister> PreBytecode::to_register(PrerunValue* value) {
+	if ((value == nullptr) || not is_supported_type(value->get_ir_type())) {
+		return None;
+	}
+	auto* constant = value->get_llvm_constant();
+	if (auto* constInt = llvm::dyn_cast<llvm::ConstantInt>(constant)) {
+		return PreRegister{.bits = constInt->getZExtValue()};
+	} else if (auto* constFP = llvm::dyn_cast<llvm::ConstantFP>(constant)) {
+		return PreRegister{.real = constFP->getType()->isFloatTy() ? (double)constFP->getValueAPF().convertToFloat()
+		                                                           : constFP->getValueAPF().convertToDouble()};
+	}
+	return None;
+}
+
+PrerunValue* PreBytecode::to_value(PreRegister value, Type* type, Ctx* irCtx) {
+	if (type->is_float()) {
+		return PrerunValue::get(llvm::ConstantFP::get(type->get_llvm_type(), value.real), type);
+	}
+	return PrerunValue::get(
+	    llvm::ConstantInt::get(llvm::cast<llvm::IntegerType>(type->get_llvm_type()), value.bits, false), type);
+}
+
+PreStatus PreBytecode::execute(Vec<PreRegister> const& arguments, PreRegister& result, Ctx* irCtx) const {
+	Vec<PreRegister> regs(registerTypes.size(), PreRegister{.bits = 0u});
+	for (usize i = 0; i < argumentCount; i++) {
+		regs[i] = arguments[i];
+	}
+	const bool isProfiling = PrerunProfile::is_enabled();
+	usize      position    = 0;
+	while (true) {
+		auto const& ins = code[position++];
+		// The operands are only registers for some of the operations. Jumps keep a position in the code in dest, and
+		// constants, loops and calls keep an index in lhs
+		auto lhs = [&]() -> PreRegister const& { return regs[ins.lhs]; };
+		auto rhs = [&]() -> PreRegister const& { return regs[ins.rhs]; };
+		auto out = [&]() -> PreRegister& { return regs[ins.dest]; };
+		switch (ins.op) {
+			case PreOp::loadConstant: {
+				out() = constants[ins.lhs];
+				break;
+			}
+			case PreOp::move: {
+				out() = lhs();
+				break;
+			}
+			case PreOp::add: {
+				out().bits = wrap_bits(lhs().bits + rhs().bits, ins.width);
+				break;
+			}
+			case PreOp::subtract: {
+				out().bits = wrap_bits(lhs().bits - rhs().bits, ins.width);
+				break;
+			}
+			case PreOp::multiply: {
+				out().bits = wrap_bits(lhs().bits * rhs().bits, ins.width);
+				break;
+			}
+			case PreOp::signedDivide:
+			case PreOp::signedRemainder: {
+				auto dividend = sign_extend(lhs().bits, ins.width);
+				auto divisor  = sign_extend(rhs().bits, ins.width);
+				if ((divisor == 0) || ((divisor == -1) && (dividend == sign_extend(((u64)1u) << (ins.width - 1u),
+				                                                                   ins.width)))) {
+					return PreStatus::fallback;
+				}
+				out().bits = wrap_bits(
+				    (u64)((ins.op == PreOp::signedDivide) ? (dividend / divisor) : (dividend % divisor)), ins.width);
+				break;
+			}
+			case PreOp::unsignedDivide:
+			case PreOp::unsignedRemainder: {
+				if (rhs().bits == 0u) {
+					return PreStatus::fallback;
+				}
+				out().bits = (ins.op == PreOp::unsignedDivide) ? (lhs().bits / rhs().bits) : (lhs().bits % rhs().bits);
+				break;
+			}
+			case PreOp::bitwiseAnd: {
+				out().bits = lhs().bits & rhs().bits;
+				break;
+			}
+			case PreOp::bitwiseOr: {
+				out().bits = lhs().bits | rhs().bits;
+				break;
+			}
+			case PreOp::bitwiseXor: {
+				out().bits = lhs().bits ^ rhs().bits;
+				break;
+			}
+			case PreOp::shiftLeft:
+			case PreOp::logicalShiftRight:
+			case PreOp::arithmeticShiftRight: {
+				// Shifting by the bitwidth or more produces poison in LLVM
+				if (rhs().bits >= ins.width) {
+					return PreStatus::fallback;
+				}
+				if (ins.op == PreOp::shiftLeft) {
+					out().bits = wrap_bits(lhs().bits << rhs().bits, ins.width);
+				} else if (ins.op == PreOp::logicalShiftRight) {
+					out().bits = lhs().bits >> rhs().bits;
+				} else {
+					out().bits = wrap_bits((u64)(sign_extend(lhs().bits, ins.width) >> rhs().bits), ins.width);
+				}
+				break;
+			}
+			case PreOp::negate: {
+				out().bits = wrap_bits(((u64)0u) - lhs().bits, ins.width);
+				break;
+			}
+			case PreOp::bitwiseNot: {
+				out().bits = wrap_bits(~lhs().bits, ins.width);
+				break;
+			}
+			case PreOp::equal: {
+				out().bits = (lhs().bits == rhs().bits) ? 1u : 0u;
+				break;
+			}
+			case PreOp::notEqual: {
+				out().bits = (lhs().bits != rhs().bits) ? 1u : 0u;
+				break;
+			}
+			case PreOp::signedLess: {
+				out().bits = (sign_extend(lhs().bits, ins.width) < sign_extend(rhs().bits, ins.width)) ? 1u : 0u;
+				break;
+			}
+			case PreOp::signedGreater: {
+				out().bits = (sign_extend(lhs().bits, ins.width) > sign_extend(rhs().bits, ins.width)) ? 1u : 0u;
+				break;
+			}
+			case PreOp::signedLessOrEqual: {
+				out().bits = (sign_extend(lhs().bits, ins.width) <= sign_extend(rhs().bits, ins.width)) ? 1u : 0u;
+				break;
+			}
+			case PreOp::signedGreaterOrEqual: {
+				out().bits = (sign_extend(lhs().bits, ins.width) >= sign_extend(rhs().bits, ins.width)) ? 1u : 0u;
+				break;
+			}
+			case PreOp::unsignedLess: {
+				out().bits = (lhs().bits < rhs().bits) ? 1u : 0u;
+				break;
+			}
+			case PreOp::unsignedGreater: {
+				out().bits = (lhs().bits > rhs().bits) ? 1u : 0u;
+				break;
+			}
+			case PreOp::unsignedLessOrEqual: {
+				out().bits = (lhs().bits <= rhs().bits) ? 1u : 0u;
+				break;
+			}
+			case PreOp::unsignedGreaterOrEqual: {
+				out().bits = (lhs().bits >= rhs().bits) ? 1u : 0u;
+				break;
+			}
+			case PreOp::floatAdd: {
+				out().real = round_real(lhs().real + rhs().real, ins.width);
+				break;
+			}
+			case PreOp::floatSubtract: {
+				out().real = round_real(lhs().real - rhs().real, ins.width);
+				break;
+			}
+			case PreOp::floatMultiply: {
+				out().real = round_real(lhs().real * rhs().real, ins.width);
+				break;
+			}
+			case PreOp::floatDivide: {
+				out().real = round_real(lhs().real / rhs().real, ins.width);
+				break;
+			}
+			case PreOp::floatRemainder: {
+				out().real = round_real(std::fmod(lhs().real, rhs().real), ins.width);
+				break;
+			}
+			case PreOp::floatNegate: {
+				out().real = -lhs().real;
+				break;
+			}
+			// All floating point comparisons are ordered, so they are false if either side is NaN
+			case PreOp::floatEqual: {
+				out().bits = (lhs().real == rhs().real) ? 1u : 0u;
+				break;
+			}
+			case PreOp::floatNotEqual: {
+				out().bits = ((lhs().real < rhs().real) || (lhs().real > rhs().real)) ? 1u : 0u;
+				break;
+			}
+			case PreOp::floatLess: {
+				out().bits = (lhs().real < rhs().real) ? 1u : 0u;
+				break;
+			}
+			case PreOp::floatGreater: {
+				out().bits = (lhs().real > rhs().real) ? 1u : 0u;
+				break;
+			}
+			case PreOp::floatLessOrEqual: {
+				out().bits = (lhs().real <= rhs().real) ? 1u : 0u;
+				break;
+			}
+			case PreOp::floatGreaterOrEqual: {
+				out().bits = (lhs().real >= rhs().real) ? 1u : 0u;
+				break;
+			}
+			case PreOp::jump: {
+				position = ins.dest;
+				break;
+			}
+			case PreOp::jumpIfFalse: {
+				if (lhs().bits == 0u) {
+					position = ins.dest;
+				}
+				break;
+			}
+			case PreOp::loopEnter: {
+				if (isProfiling) {
+					auto const& site   = loopSites[ins.lhs];
+					auto        nameFn = [&]() { return "loop to in " + site.function->get_full_name(); };
+					PrerunProfile::get_entry(site.loop, PrerunProfileKind::loop, nameFn, site.fileRange)->calls++;
+				}
+				break;
+			}
+			case PreOp::loopBack: {
+				if (not PrerunProfile::add_step()) {
+					return PreStatus::fallback;
+				}
+				if (isProfiling) {
+					auto const& site   = loopSites[ins.lhs];
+					auto        nameFn = [&]() { return "loop to in " + site.function->get_full_name(); };
+					PrerunProfile::get_entry(site.loop, PrerunProfileKind::loop, nameFn, site.fileRange)->iterations++;
+				}
+				position = ins.dest;
+				break;
+			}
+			case PreOp::call: {
+				auto const&      site = callSites[ins.lhs];
+				Vec<PreRegister> callArgs;
+				callArgs.reserve(site.arguments.size());
+				for (auto arg : site.arguments) {
+					callArgs.push_back(regs[arg]);
+				}
+				PreRegister callResult{.bits = 0u};
+				auto        status = site.callee->call_native(callArgs, callResult, irCtx, site.fileRange);
+				if (status == PreStatus::fallback) {
+					return PreStatus::fallback;
+				} else if (status == PreStatus::given) {
+					regs[ins.dest] = callResult;
+				}
+				break;
+			}
+			case PreOp::give: {
+				result = lhs();
+				return PreStatus::given;
+			}
+			case PreOp::giveVoid: {
+				return PreStatus::givenVoid;
+			}
+			case PreOp::end: {
+				return PreStatus::ended;
+			}
+			case PreOp::fail: {
+				return PreStatus::fallback;
+			}
+		}
+	}
+}
+
+PreBytecode* PreCompiler::compile(PrerunFunction* function, ast::EmitCtx* ctx,
+                                  Vec<ast::PrerunSentence*> const& sentences) {
+	auto* result = std::construct_at(OwnPrerun(PreBytecode));
+
+	PreCompiler compiler(function, ctx, result);
+
+	bool isSupported =
+	    function->get_return_type()->is_void() || PreBytecode::is_supported_type(function->get_return_type());
+	for (usize i = 0; isSupported && (i < function->get_argument_count()); i++) {
+		auto* argTy = function->get_argument_type_at(i)->get_type();
+		isSupported = PreBytecode::is_supported_type(argTy);
+		(void)compiler.new_register(argTy);
+	}
+	if (not isSupported || not compiler.lower_sentences(sentences)) {
+		std::destroy_at(result);
+		return nullptr;
+	}
+	result->argumentCount = function->get_argument_count();
+	// Reaching the end of a function that has to give a value is an error, which is left to the interpreter to report
+	compiler.add_instruction(function->get_return_type()->is_void() ? PreOp::end : PreOp::fail, 0u, 0u);
+	return result;
+}
+
+u32 PreCompiler::new_register(Type* type) {
+	result->registerTypes.push_back(type);
+	return result->registerTypes.size() - 1;
+}
+
+u32 PreCompiler::add_instruction(PreOp op, u32 width, u32 dest, u32 lhs, u32 rhs) {
+	result->code.push_back(PreInstruction{.op = op, .width = width, .dest = dest, .lhs = lhs, .rhs = rhs});
+	return result->code.size() - 1;
+}
+
+void PreCompiler::set_jump_target(u32 instruction, u32 target) { result->code[instruction].dest = target; }
+
+u32 PreCompiler::add_constant(PreRegister value, Type* type) {
+	result->constants.push_back(value);
+	auto reg = new_register(type);
+	add_instruction(PreOp::loadConstant, 0u, reg, result->constants.size() - 1);
+	return reg;
+}
+
+Maybe<u32> PreCompiler::add_constant(PrerunValue* value) {
+	auto reg = PreBytecode::to_register(value);
+	if (not reg.has_value()) {
+		return None;
+	}
+	return add_constant(reg.value(), value->get_ir_type());
+}
+
+u32 PreCompiler::add_call(PrerunFunction* callee, Vec<u32> arguments, Type* givenType, FileRange fileRange) {
+	result->callSites.push_back(PreCallSite{.callee = callee, .arguments = std::move(arguments), .fileRange = fileRange});
+	auto reg = new_register(givenType);
+	add_instruction(PreOp::call, 0u, reg, result->callSites.size() - 1);
+	return reg;
+}
+
+u32 PreCompiler::add_loop_site(void const* loop, FileRange fileRange) {
+	result->loopSites.push_back(PreLoopSite{.loop = loop, .function = function, .fileRange = fileRange});
+	return result->loopSites.size() - 1;
+}
+
+Maybe<u32> PreCompiler::find_local(String const& name) const {
+	for (usize i = 0; i < function->get_argument_count(); i++) {
+		if (function->get_argument_type_at(i)->get_name() == name) {
+			return (u32)i;
+		}
+	}
+	for (auto it = locals.rbegin(); it != locals.rend(); it++) {
+		if (it->first == name) {
+			return it->second;
+		}
+	}
+	return None;
+}
+
+void PreCompiler::push_local(String name, u32 reg) { locals.push_back({std::move(name), reg}); }
+
+void PreCompiler::pop_local() { locals.pop_back(); }
+
+bool PreCompiler::has_loop_with_tag(String const& tag) const {
+	for (auto const& loop : loops) {
+		if (loop.tag.has_value() && (loop.tag.value() == tag)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void PreCompiler::push_loop(Maybe<String> tag) { loops.push_back(LoopLabels{.tag = std::move(tag)}); }
+
+void PreCompiler::pop_loop(u32 continueTarget, u32 breakTarget) {
+	for (auto ins : loops.back().continues) {
+		set_jump_target(ins, continueTarget);
+	}
+	for (auto ins : loops.back().breaks) {
+		set_jump_target(ins, breakTarget);
+	}
+	loops.pop_back();
+}
+
+bool PreCompiler::add_loop_exit(Maybe<String> const& tag, bool isBreak) {
+	LoopLabels* target = nullptr;
+	if (tag.has_value()) {
+		for (auto it = loops.rbegin(); it != loops.rend(); it++) {
+			if (it->tag.has_value() && (it->tag.value() == tag.value())) {
+				target = &(*it);
+				break;
+			}
+		}
+	} else if (loops.size() == 1) {
+		target = &loops.back();
+	}
+	if (target == nullptr) {
+		return false;
+	}
+	auto jump = add_instruction(PreOp::jump, 0u, 0u);
+	(isBreak ? target->breaks : target->continues).push_back(jump);
+	return true;
+}
+
+Maybe<u32> PreCompiler::lower_expression(ast::PrerunExpression* expression) {
+	switch (expression->nodeType()) {
+		case ast::NodeType::INTEGER_LITERAL:
+		case ast::NodeType::UNSIGNED_LITERAL:
+		case ast::NodeType::FLOAT_LITERAL:
+		case ast::NodeType::CUSTOM_INTEGER_LITERAL:
+		case ast::NodeType::CUSTOM_FLOAT_LITERAL:
+		case ast::NodeType::BOOLEAN_LITERAL:
+			return add_constant(expression->emit(ctx));
+		default:
+			return expression->lower_to_bytecode(this);
+	}
+}
+
+bool PreCompiler::lower_sentences(Vec<ast::PrerunSentence*> const& sentences) {
+	for (auto* snt : sentences) {
+		if (not snt->lower_to_bytecode(this)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace qat::ir
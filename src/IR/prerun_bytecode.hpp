@@ -0,0 +1,186 @@
+#ifndef QAT_IR_PRERUN_BYTECODE_HPP
+#define QAT_IR_PRERUN_BYTECODE_HPP
+
+#include "../utils/file_range.hpp"
+#include "../utils/helpers.hpp"
+#include "../utils/macros.hpp"
+
+namespace qat::ast {
+class EmitCtx;
+class PrerunExpression;
+class PrerunSentence;
+} // namespace qat::ast
+
+namespace qat::ir {
+
+class Ctx;
+class Type;
+class PrerunFunction;
+class PrerunValue;
+
+enum class PreOp : u8 {
+	loadConstant,
+	move,
+	add,
+	subtract,
+	multiply,
+	signedDivide,
+	unsignedDivide,
+	signedRemainder,
+	unsignedRemainder,
+	bitwiseAnd,
+	bitwiseOr,
+	bitwiseXor,
+	shiftLeft,
+	logicalShiftRight,
+	arithmeticShiftRight,
+	negate,
+	bitwiseNot,
+	equal,
+	notEqual,
+	signedLess,
+	signedGreater,
+	signedLessOrEqual,
+	signedGreaterOrEqual,
+	unsignedLess,
+	unsignedGreater,
+	unsignedLessOrEqual,
+	unsignedGreaterOrEqual,
+	floatAdd,
+	floatSubtract,
+	floatMultiply,
+	floatDivide,
+	floatRemainder,
+	floatNegate,
+	floatEqual,
+	floatNotEqual,
+	floatLess,
+	floatGreater,
+	floatLessOrEqual,
+	floatGreaterOrEqual,
+	jump,
+	jumpIfFalse,
+	loopEnter,
+	loopBack,
+	call,
+	give,
+	giveVoid,
+	end,
+	fail,
+};
+
+/// A single instruction of the prerun bytecode. `width` is the bitwidth of the operands, and is used to wrap integer
+/// results and to round floating point results
+struct PreInstruction {
+	PreOp op;
+	u32   width;
+	u32   dest;
+	u32   lhs;
+	u32   rhs;
+};
+
+union PreRegister {
+	u64    bits;
+	double real;
+};
+
+/// The loop that a `loopEnter` or `loopBack` instruction belongs to. Each jump back counts as a step of the evaluation
+struct PreLoopSite {
+	void const*     loop;
+	PrerunFunction* function;
+	FileRange       fileRange;
+};
+
+struct PreCallSite {
+	PrerunFunction* callee;
+	Vec<u32>        arguments;
+	FileRange       fileRange;
+};
+
+enum class PreStatus {
+	given,
+	givenVoid,
+	ended,
+	// The evaluation reached something the bytecode cannot represent natively, like a division by zero or a shift that
+	// produces poison. The call should be repeated by the interpreter, which reports the problem
+	fallback,
+};
+
+class PreBytecode {
+	friend class PreCompiler;
+	friend class PreJitLowering;
+
+	Vec<PreInstruction> code;
+	Vec<PreRegister>    constants;
+	Vec<Type*>          registerTypes;
+	Vec<PreCallSite>    callSites;
+	Vec<PreLoopSite>    loopSites;
+	usize               argumentCount = 0;
+
+  public:
+	useit static bool is_supported_type(Type* type);
+	useit static u32  get_width(Type* type);
+
+	useit static Maybe<PreRegister> to_register(PrerunValue* value);
+	useit static PrerunValue*       to_value(PreRegister value, Type* type, Ctx* irCtx);
+
+	useit PreStatus execute(Vec<PreRegister> const& arguments, PreRegister& result, Ctx* irCtx) const;
+
+	useit usize get_register_count() const { return registerTypes.size(); }
+
+	useit Vec<PreCallSite> const& get_call_sites() const { return callSites; }
+};
+
+/// Lowers the sentences of a prerun function to bytecode. The lowering stops at the first sentence or expression that
+/// does not have an equivalent in the bytecode, and such functions keep using the interpreter
+class PreCompiler {
+	struct LoopLabels {
+		Maybe<String> tag;
+		Vec<u32>      breaks;
+		Vec<u32>      continues;
+	};
+
+	PrerunFunction*        function;
+	ast::EmitCtx*          ctx;
+	PreBytecode*           result;
+	Vec<Pair<String, u32>> locals;
+	Vec<LoopLabels>        loops;
+
+	PreCompiler(PrerunFunction* _function, ast::EmitCtx* _ctx, PreBytecode* _result)
+	    : function(_function), ctx(_ctx), result(_result) {}
+
+  public:
+	useit static PreBytecode* compile(PrerunFunction* function, ast::EmitCtx* ctx,
+	                                  Vec<ast::PrerunSentence*> const& sentences);
+
+	useit ast::EmitCtx*   get_ctx() const { return ctx; }
+	useit PrerunFunction* get_function() const { return function; }
+
+	useit u32   new_register(Type* type);
+	useit Type* get_type_of(u32 reg) const { return result->registerTypes[reg]; }
+	useit u32   get_next_position() const { return result->code.size(); }
+
+	u32  add_instruction(PreOp op, u32 width, u32 dest, u32 lhs = 0, u32 rhs = 0);
+	void set_jump_target(u32 instruction, u32 target);
+
+	useit u32        add_constant(PreRegister value, Type* type);
+	useit Maybe<u32> add_constant(PrerunValue* value);
+	useit u32        add_call(PrerunFunction* callee, Vec<u32> arguments, Type* givenType, FileRange fileRange);
+	useit u32        add_loop_site(void const* loop, FileRange fileRange);
+
+	useit Maybe<u32> find_local(String const& name) const;
+	void             push_local(String name, u32 reg);
+	void             pop_local();
+
+	useit bool has_loop_with_tag(String const& tag) const;
+	void       push_loop(Maybe<String> tag);
+	void       pop_loop(u32 continueTarget, u32 breakTarget);
+	useit bool add_loop_exit(Maybe<String> const& tag, bool isBreak);
+
+	useit Maybe<u32> lower_expression(ast::PrerunExpression* expression);
+	useit bool       lower_sentences(Vec<ast::PrerunSentence*> const& sentences);
+};
+
+} // namespace qat::ir
+
+#endif
@@ -0,0 +1,304 @@
+#include "./prerun_cache.hpp"
+#include "../cli/config.hpp"
+#include "../cli/version.hpp"
+#include "./context.hpp"
+#include "./prerun_bytecode.hpp"
+#include "./prerun_function.hpp"
+#include "./types/array.hpp"
+
+#include <fstream>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/Support/xxhash.h>
+#include <sstream>
+
+namespace qat::ir {
+
+Vec<PrerunCache::Recording>                     PrerunCache::recordings{};
+Map<PrerunFunction const*, Map<String, String>> PrerunCache::knownCallees{};
+std::set<PrerunFunction const*>                 PrerunCache::outsideReaders{};
+Map<PrerunFunction const*, Maybe<String>>       PrerunCache::sourceHashes{};
+u64                                             PrerunCache::outsideReadCount = 0;
+u64                                             PrerunCache::loadedCount      = 0;
+u64                                             PrerunCache::storedCount      = 0;
+
+bool PrerunCache::is_enabled() { return not cli::Config::get()->is_prerun_cache_disabled(); }
+
+Maybe<String> PrerunCache::get_source_hash(PrerunFunction* function) {
+	auto existing = sourceHashes.find(function);
+	if (existing != sourceHashes.end()) {
+		return existing->second;
+	}
+	// Only the lines of the function are hashed, so that the entry stays valid when other parts of the file change
+	auto          range = function->get_definition_range();
+	std::ifstream file(range.get_path());
+	String        source;
+	String        line;
+	u64           lineNumber = 0;
+	while (std::getline(file, line)) {
+		lineNumber++;
+		if (lineNumber > range.end.line) {
+			break;
+		}
+		if (lineNumber >= range.start.line) {
+			source += line;
+			source += '\n';
+		}
+	}
+	Maybe<String> result;
+	if (not source.empty()) {
+		result = llvm::utohexstr(llvm::xxHash64(source));
+	}
+	sourceHashes[function] = result;
+	return result;
+}
+
+fs::path PrerunCache::get_entry_path(String const& key) {
+	return cli::Config::get()->get_output_path() / "cache" / "prerun" /
+	       (llvm::utohexstr(llvm::xxHash64(key)) + ".json");
+}
+
+Maybe<String> PrerunCache::serialise(llvm::Constant* value, Type* type) {
+	if (type->is_bool() || type->is_unsigned() || type->is_integer()) {
+		auto* intValue = llvm::dyn_cast<llvm::ConstantInt>(value);
+		if (intValue == nullptr) {
+			return None;
+		}
+		return llvm::toString(intValue->getValue(), 16, false);
+	} else if (type->is_float()) {
+		auto* floatValue = llvm::dyn_cast<llvm::ConstantFP>(value);
+		if (floatValue == nullptr) {
+			return None;
+		}
+		return llvm::toString(floatValue->getValueAPF().bitcastToAPInt(), 16, false);
+	} else if (type->is_array()) {
+		auto*  elementType = type->as_array()->get_element_type();
+		String result      = "[";
+		for (u64 i = 0; i < type->as_array()->get_length(); i++) {
+			auto* element = value->getAggregateElement(i);
+			if (element == nullptr) {
+				return None;
+			}
+			auto elementText = serialise(element, elementType);
+			if (not elementText.has_value()) {
+				return None;
+			}
+			if (i > 0) {
+				result += ",";
+			}
+			result += elementText.value();
+		}
+		return result + "]";
+	}
+	return None;
+}
+
+llvm::Constant* PrerunCache::deserialise(String const& text, usize& position, Type* type, Ctx* irCtx) {
+	if (type->is_array()) {
+		if ((position >= text.size()) || (text[position] != '[')) {
+			return nullptr;
+		}
+		position++;
+		auto*                elementType = type->as_array()->get_element_type();
+		Vec<llvm::Constant*> elements;
+		for (u64 i = 0; i < type->as_array()->get_length(); i++) {
+			if (i > 0) {
+				if ((position >= text.size()) || (text[position] != ',')) {
+					return nullptr;
+				}
+				position++;
+			}
+			auto* element = deserialise(text, position, elementType, irCtx);
+			if (element == nullptr) {
+				return nullptr;
+			}
+			elements.push_back(element);
+		}
+		if ((position >= text.size()) || (text[position] != ']')) {
+			return nullptr;
+		}
+		position++;
+		return llvm::ConstantArray::get(llvm::cast<llvm::ArrayType>(type->get_llvm_type()), elements);
+	}
+	auto end = text.find_first_of(",]", position);
+	if (end == String::npos) {
+		end = text.size();
+	}
+	auto digits = llvm::StringRef(text).slice(position, end);
+	position    = end;
+	llvm::APInt bits;
+	if (digits.getAsInteger(16, bits)) {
+		return nullptr;
+	}
+	auto width = type->get_llvm_type()->getScalarSizeInBits();
+	if ((width == 0u) || (bits.getActiveBits() > width)) {
+		return nullptr;
+	}
+	bits = bits.zextOrTrunc(width);
+	if (type->is_bool() || type->is_unsigned() || type->is_integer()) {
+		return llvm::ConstantInt::get(irCtx->llctx, bits);
+	} else if (type->is_float()) {
+		return llvm::ConstantFP::get(irCtx->llctx, llvm::APFloat(type->get_llvm_type()->getFltSemantics(), bits));
+	}
+	return nullptr;
+}
+
+Maybe<String> PrerunCache::get_key(PrerunFunction* function, Vec<PrerunValue*> const& arguments) {
+	auto sourceHash = get_source_hash(function);
+	if (not sourceHash.has_value() || (arguments.size() != function->get_argument_count())) {
+		return None;
+	}
+	auto* cfg = cli::Config::get();
+	// The target is part of the key, as the layout of types can change the result
+	String result = "qat " + VERSION_STRING + "\n" + cfg->get_target_triple() + "\n" + function->get_full_name() +
+	                "\n" + sourceHash.value() + "\n" + function->get_return_type()->to_string() + "\n";
+	for (auto* argVal : arguments) {
+		auto argText = serialise(argVal->get_llvm_constant(), argVal->get_ir_type());
+		if (not argText.has_value()) {
+			return None;
+		}
+		result += argVal->get_ir_type()->to_string() + " " + argText.value() + "\n";
+	}
+	return result;
+}
+
+PrerunValue* PrerunCache::load(PrerunFunction* function, String const& key, Ctx* irCtx) {
+	auto          entryPath = get_entry_path(key);
+	std::ifstream file(entryPath);
+	if (not file.is_open()) {
+		return nullptr;
+	}
+	std::stringstream content;
+	content << file.rdbuf();
+	// The entry can be any file on disk, so anything that does not have the expected shape is a miss
+	auto entry = Json::parse(content.str());
+	if (not entry.has_value() || not(*entry)["key"].isString() || not(*entry)["callees"].isList() ||
+	    not(*entry)["result"].isString() || ((*entry)["key"].asString() != key)) {
+		return nullptr;
+	}
+	Map<String, String> callees;
+	for (auto const& calleeVal : (*entry)["callees"].asList()) {
+		if (not calleeVal.isJson()) {
+			return nullptr;
+		}
+		auto calleeJson = calleeVal.asJson();
+		if (not calleeJson["name"].isString() || not calleeJson["sourceHash"].isString()) {
+			return nullptr;
+		}
+		auto  calleeName = calleeJson["name"].asString();
+		auto* callee     = PrerunFunction::find_by_full_name(calleeName);
+		if (callee == nullptr) {
+			return nullptr;
+		}
+		auto calleeHash = get_source_hash(callee);
+		if (not calleeHash.has_value() || (calleeHash.value() != calleeJson["sourceHash"].asString())) {
+			return nullptr;
+		}
+		callees[calleeName] = calleeHash.value();
+	}
+	auto  resultText = (*entry)["result"].asString();
+	usize position   = 0;
+	auto* value      = deserialise(resultText, position, function->get_return_type(), irCtx);
+	if ((value == nullptr) || (position != resultText.size())) {
+		return nullptr;
+	}
+	knownCallees[function].insert(callees.begin(), callees.end());
+	loadedCount++;
+	return PrerunValue::get(value, function->get_return_type());
+}
+
+void PrerunCache::add_callee(PrerunFunction* function) {
+	if (recordings.empty()) {
+		return;
+	}
+	auto sourceHash = get_source_hash(function);
+	if (sourceHash.has_value()) {
+		recordings.back().callees[function->get_full_name()] = sourceHash.value();
+	} else {
+		// A function without readable source cannot be validated later
+		outsideReadCount++;
+	}
+}
+
+void PrerunCache::begin_recording(PrerunFunction* function) {
+	add_callee(function);
+	recordings.push_back(Recording{
+	    .callees      = {},
+	    .outsideReads = outsideReadCount,
+	    .sideEffects  = PrerunFunction::get_side_effect_count(),
+	});
+}
+
+void PrerunCache::end_recording(PrerunFunction* function, Maybe<String> const& key, PrerunValue* result) {
+	auto recording = std::move(recordings.back());
+	recordings.pop_back();
+	auto& functionCallees = knownCallees[function];
+	functionCallees.insert(recording.callees.begin(), recording.callees.end());
+	if (not recordings.empty()) {
+		recordings.back().callees.insert(recording.callees.begin(), recording.callees.end());
+	}
+	bool isPure = (recording.outsideReads == outsideReadCount) &&
+	              (recording.sideEffects == PrerunFunction::get_side_effect_count());
+	if (not isPure) {
+		outsideReaders.insert(function);
+	}
+	if (not isPure || not key.has_value() || (result == nullptr)) {
+		return;
+	}
+	auto resultText = serialise(result->get_llvm_constant(), result->get_ir_type());
+	if (not resultText.has_value()) {
+		return;
+	}
+	Vec<JsonValue> calleesJson;
+	for (auto const& callee : recording.callees) {
+		calleesJson.push_back(Json()._("name", callee.first)._("sourceHash", callee.second));
+	}
+	auto            entryPath = get_entry_path(key.value());
+	std::error_code errorCode;
+	fs::create_directories(entryPath.parent_path(), errorCode);
+	if (errorCode) {
+		return;
+	}
+	// The cache only speeds up later builds, so failing to write an entry is not an error
+	std::ofstream file(entryPath);
+	if (file.is_open()) {
+		file << Json()._("key", key.value())._("callees", calleesJson)._("result", resultText.value());
+		storedCount++;
+	}
+}
+
+void PrerunCache::record_reuse(PrerunFunction* function) {
+	if (recordings.empty()) {
+		return;
+	}
+	add_callee(function);
+	auto known = knownCallees.find(function);
+	if (known != knownCallees.end()) {
+		recordings.back().callees.insert(known->second.begin(), known->second.end());
+	}
+	if (outsideReaders.contains(function)) {
+		outsideReadCount++;
+	}
+}
+
+void PrerunCache::record_bytecode_calls(PreBytecode const* code) {
+	if (recordings.empty()) {
+		return;
+	}
+	Vec<PreBytecode const*>   pending{code};
+	std::set<PrerunFunction*> visited;
+	while (not pending.empty()) {
+		auto* current = pending.back();
+		pending.pop_back();
+		for (auto const& callSite : current->get_call_sites()) {
+			if (visited.insert(callSite.callee).second) {
+				add_callee(callSite.callee);
+				if (callSite.callee->get_compiled_bytecode() != nullptr) {
+					pending.push_back(callSite.callee->get_compiled_bytecode());
+				}
+			}
+		}
+	}
+}
+
+} // namespace qat::ir
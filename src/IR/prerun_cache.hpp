@@ -0,0 +1,78 @@
+#ifndef QAT_IR_PRERUN_CACHE_HPP
+#define QAT_IR_PRERUN_CACHE_HPP
+
+#include "../utils/helpers.hpp"
+#include "../utils/macros.hpp"
+
+#include <set>
+
+namespace llvm {
+class Constant;
+}
+
+namespace qat::ir {
+
+class Ctx;
+class Type;
+class PreBytecode;
+class PrerunFunction;
+class PrerunValue;
+
+/// Keeps the results of prerun function calls in the output directory, so that later builds can reuse them. An entry is
+/// found by the source of the function and the arguments of the call, and is only reused if the source of every prerun
+/// function it called is unchanged. Calls that read other entities of the program, like prerun globals or named types,
+/// or that have side effects, are not kept
+class PrerunCache {
+	struct Recording {
+		// Source hashes of the prerun functions called, by their full names
+		Map<String, String> callees;
+		u64                 outsideReads;
+		u64                 sideEffects;
+	};
+
+	static Vec<Recording>                                  recordings;
+	static Map<PrerunFunction const*, Map<String, String>> knownCallees;
+	static std::set<PrerunFunction const*>                 outsideReaders;
+	static Map<PrerunFunction const*, Maybe<String>>       sourceHashes;
+	static u64                                             outsideReadCount;
+	static u64                                             loadedCount;
+	static u64                                             storedCount;
+
+	useit static Maybe<String> get_source_hash(PrerunFunction* function);
+	useit static fs::path      get_entry_path(String const& key);
+
+	useit static Maybe<String>   serialise(llvm::Constant* value, Type* type);
+	useit static llvm::Constant* deserialise(String const& text, usize& position, Type* type, Ctx* irCtx);
+
+	static void add_callee(PrerunFunction* function);
+
+  public:
+	useit static bool is_enabled();
+	useit static bool is_recording() { return not recordings.empty(); }
+
+	/// Provides the key of a call, or None if the function or the arguments cannot be kept in the cache
+	useit static Maybe<String> get_key(PrerunFunction* function, Vec<PrerunValue*> const& arguments);
+
+	useit static PrerunValue* load(PrerunFunction* function, String const& key, Ctx* irCtx);
+
+	/// Should surround every evaluation of a prerun function. The result is stored if the key is present and nothing
+	/// outside the called prerun functions was read during the evaluation
+	static void begin_recording(PrerunFunction* function);
+	static void end_recording(PrerunFunction* function, Maybe<String> const& key, PrerunValue* result);
+
+	/// Should be called when the result of a call is reused from the memory or the disk instead of being evaluated
+	static void record_reuse(PrerunFunction* function);
+
+	/// The bytecode calls other prerun functions directly, so all functions it can call are recorded
+	static void record_bytecode_calls(PreBytecode const* code);
+
+	/// Should be called by prerun expressions that depend on entities other than arguments, locals and prerun functions
+	static void record_outside_read() { outsideReadCount++; }
+
+	useit static u64 get_loaded_count() { return loadedCount; }
+	useit static u64 get_stored_count() { return storedCount; }
+};
+
+} // namespace qat::ir
+
+#endif
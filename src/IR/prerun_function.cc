@@ -1,8 +1,11 @@
 #include "./prerun_function.hpp"
 #include "../ast/emit_ctx.hpp"
-#include "../ast/prerun_sentences/internal_exceptions.hpp"
 #include "../ast/prerun_sentences/prerun_sentence.hpp"
 #include "./context.hpp"
+#include "./prerun_cache.hpp"
+#include "./prerun_jit.hpp"
+#include "./prerun_profile.hpp"
+#include "./types/void.hpp"
 
 namespace qat::ir {
 
@@ -43,25 +46,166 @@ PrerunFunction::PrerunFunction(Mod* _parent, Identifier _name, Type* _retTy, Vec
 
 String PrerunFunction::get_full_name() const { return parent->get_fullname_with_child(name.value); }
 
+PrerunFunction* PrerunFunction::find_by_full_name(String const& fullName) {
+	for (auto* mod : Mod::allModules) {
+		for (auto* preFn : mod->prerunFunctions) {
+			if (preFn->get_full_name() == fullName) {
+				return preFn;
+			}
+		}
+	}
+	return nullptr;
+}
+
+PreBytecode* PrerunFunction::get_bytecode(Ctx* irCtx) {
+	if (not isBytecodeChecked) {
+		isBytecodeChecked = true;
+		bytecode          = PreCompiler::compile(this, ast::EmitCtx::get(irCtx, parent), sentences.first);
+	}
+	return bytecode;
+}
+
+u64 PrerunFunction::sideEffectCount = 0;
+
+PrerunProfileEntry* PrerunFunction::get_profile_entry() {
+	return PrerunProfile::get_entry(this, PrerunProfileKind::function, [&]() { return get_full_name(); }, name.range);
+}
+
 PrerunValue* PrerunFunction::call_prerun(Vec<PrerunValue*> argValues, Ctx* irCtx, FileRange fileRange) {
-	auto callState = PrerunCallState::get(this, argValues);
-	auto emitCtx   = ast::EmitCtx::get(irCtx, parent)->with_prerun_call_state(callState);
-	try {
-		for (auto* snt : sentences.first) {
-			snt->emit(emitCtx);
+	auto*                profileEntry = get_profile_entry();
+	Vec<llvm::Constant*> cacheKey;
+	if (isMemoisable) {
+		cacheKey.reserve(argValues.size());
+		for (auto* argVal : argValues) {
+			cacheKey.push_back(argVal->get_llvm_constant());
+		}
+		auto cached = callCache.find(cacheKey);
+		if (cached != callCache.end()) {
+			if (profileEntry != nullptr) {
+				profileEntry->cachedCalls++;
+			}
+			PrerunCache::record_reuse(this);
+			// A copy is provided, since the caller is free to change the range of the value
+			return (cached->second == nullptr)
+			           ? nullptr
+			           : PrerunValue::get(cached->second->get_llvm_constant(), cached->second->get_ir_type());
+		}
+	}
+	// Only outermost calls use the disk, so that recursive evaluations do not touch the file system for every call
+	Maybe<String> diskKey;
+	if (PrerunCache::is_enabled() && not PrerunCache::is_recording()) {
+		diskKey = PrerunCache::get_key(this, argValues);
+		if (diskKey.has_value()) {
+			auto* loaded = PrerunCache::load(this, diskKey.value(), irCtx);
+			if (loaded != nullptr) {
+				if (profileEntry != nullptr) {
+					profileEntry->cachedCalls++;
+				}
+				PrerunCache::record_reuse(this);
+				if (isMemoisable) {
+					auto* cachedResult = PrerunValue::get(loaded->get_llvm_constant(), loaded->get_ir_type());
+					callCache.emplace(std::move(cacheKey), cachedResult);
+				}
+				return loaded;
+			}
 		}
-	} catch (InternalPrerunGive& given) {
-		std::destroy_at(callState);
-		return given.value;
-	} catch (...) {
-		irCtx->Error("Failed to call the prerun function with an exception", fileRange);
 	}
-	if (returnType->is_void()) {
-		std::destroy_at(callState);
-		return nullptr;
-	} else {
+	PrerunProfileScope profileScope(profileEntry);
+	PrerunProfile::enter_evaluation();
+	if (not PrerunProfile::add_step()) {
+		irCtx->Error(PrerunProfile::step_limit_message(), fileRange);
+	}
+	const auto sideEffectsBefore = sideEffectCount;
+	PrerunCache::begin_recording(this);
+	auto* result = evaluate(std::move(argValues), irCtx, fileRange);
+	PrerunCache::end_recording(this, diskKey, result);
+	PrerunProfile::exit_evaluation();
+	if (sideEffectCount != sideEffectsBefore) {
+		isMemoisable = false;
+		callCache.clear();
+	} else if (isMemoisable) {
+		auto* cachedResult =
+		    (result == nullptr) ? nullptr : PrerunValue::get(result->get_llvm_constant(), result->get_ir_type());
+		callCache.emplace(std::move(cacheKey), cachedResult);
+	}
+	return result;
+}
+
+PrerunValue* PrerunFunction::evaluate(Vec<PrerunValue*> argValues, Ctx* irCtx, FileRange fileRange) {
+	auto* code = get_bytecode(irCtx);
+	if ((code != nullptr) && (argValues.size() == argTypes.size())) {
+		Vec<PreRegister> argRegs;
+		argRegs.reserve(argValues.size());
+		for (auto* argVal : argValues) {
+			auto argReg = PreBytecode::to_register(argVal);
+			if (not argReg.has_value()) {
+				break;
+			}
+			argRegs.push_back(argReg.value());
+		}
+		if (argRegs.size() == argValues.size()) {
+			const auto  stepsBefore = PrerunProfile::get_step_count();
+			PreRegister result{.bits = 0u};
+			auto        native = PrerunJit::is_enabled() ? PrerunJit::get_native(this, irCtx, fileRange) : nullptr;
+			auto        status = (native != nullptr) ? PrerunJit::execute(native, argRegs, result)
+			                                         : code->execute(argRegs, result, irCtx);
+
+			PrerunValue* value = nullptr;
+			switch (status) {
+				case PreStatus::given: {
+					value = PreBytecode::to_value(result, returnType, irCtx);
+					break;
+				}
+				case PreStatus::givenVoid: {
+					value = PrerunValue::get(nullptr, VoidType::get(irCtx->llctx));
+					break;
+				}
+				case PreStatus::ended: {
+					break;
+				}
+				case PreStatus::fallback: {
+					// The interpreter repeats the steps taken by the bytecode, so that running out of steps is
+					// reported at the right loop
+					PrerunProfile::set_step_count(stepsBefore);
+					return interpret(std::move(argValues), irCtx, fileRange);
+				}
+			}
+			PrerunCache::record_bytecode_calls(code);
+			if ((native != nullptr) && PrerunJit::is_verifying()) {
+				PrerunProfile::set_step_count(stepsBefore);
+				PrerunJit::verify(this, value, interpret(std::move(argValues), irCtx, fileRange), irCtx, fileRange);
+			}
+			return value;
+		}
+	}
+	return interpret(std::move(argValues), irCtx, fileRange);
+}
+
+PreStatus PrerunFunction::call_native(Vec<PreRegister> const& arguments, PreRegister& result, Ctx* irCtx,
+                                      FileRange fileRange) {
+	auto* code = get_bytecode(irCtx);
+	if ((code == nullptr) || not PrerunProfile::add_step()) {
+		return PreStatus::fallback;
+	}
+	PrerunProfileScope profileScope(get_profile_entry());
+	return code->execute(arguments, result, irCtx);
+}
+
+PrerunValue* PrerunFunction::interpret(Vec<PrerunValue*> argValues, Ctx* irCtx, FileRange fileRange) {
+	auto callState = PrerunCallState::get(this, argValues);
+	auto emitCtx   = ast::EmitCtx::get(irCtx, parent)->with_prerun_call_state(callState);
+	auto completion = ast::PrerunSentence::emit_all(sentences.first, emitCtx);
+	std::destroy_at(callState);
+	if (completion.is_give()) {
+		return completion.value;
+	} else if (not completion.is_normal()) {
+		irCtx->Error("Found a " + irCtx->color(completion.is_break() ? "break" : "continue") +
+		                 " outside of any loop in this prerun function",
+		             fileRange);
+	} else if (not returnType->is_void()) {
 		irCtx->Error("This prerun function did not give any value", fileRange);
 	}
+	return nullptr;
 }
 
 void PrerunFunction::update_overview() {
@@ -6,6 +6,7 @@
 #include "./types/function.hpp"
 #include "./types/qat_type.hpp"
 #include "entity_overview.hpp"
+#include "prerun_bytecode.hpp"
 #include "value.hpp"
 
 namespace qat::ast {
@@ -19,6 +20,7 @@ namespace qat::ir {
 
 class PrerunFunction;
 class PrerunCallState;
+struct PrerunProfileEntry;
 
 class PrerunLocal final : public PrerunValue {
 	Identifier name;
@@ -29,7 +31,7 @@ class PrerunLocal final : public PrerunValue {
 	    : PrerunValue(_initialVal, _type), name(_name), isVar(_isVar) {}
 
 	useit static PrerunLocal* get(Identifier _name, Type* _type, bool _isVar, llvm::Constant* _initialVal) {
-		return std::construct_at(OwnNormal(PrerunLocal), _name, _type, _isVar, _initialVal);
+		return std::construct_at(OwnPrerun(PrerunLocal), _name, _type, _isVar, _initialVal);
 	}
 
 	bool is_prerun_local() const final { return true; }
@@ -52,11 +54,11 @@ class PreBlock {
 	PreBlock(PrerunCallState* _callState, PreBlock* _parent);
 
 	useit static PreBlock* create(PrerunCallState* callState, PreBlock* parent = nullptr) {
-		return std::construct_at(OwnNormal(PreBlock), callState, parent);
+		return std::construct_at(OwnPrerun(PreBlock), callState, parent);
 	}
 
 	useit static PreBlock* create_next_to(PreBlock* previous) {
-		auto res = std::construct_at(OwnNormal(PreBlock), previous->callState, previous->parent);
+		auto res = std::construct_at(OwnPrerun(PreBlock), previous->callState, previous->parent);
 		res->set_previous(previous);
 		return res;
 	}
@@ -72,6 +74,8 @@ class PreBlock {
 
 	void make_active();
 
+	void add_local(PrerunLocal* local) { locals.push_back(local); }
+
 	useit bool has_previous() const { return previous != nullptr; }
 	useit bool has_next() const { return next != nullptr; }
 	useit bool has_parent() const { return parent != nullptr; }
@@ -159,7 +163,7 @@ class PrerunCallState {
 	~PrerunCallState() { std::destroy_at(rootBlock); }
 
 	useit static PrerunCallState* get(PrerunFunction* fun, Vec<PrerunValue*> argVals) {
-		return std::construct_at(OwnNormal(PrerunCallState), fun, argVals);
+		return std::construct_at(OwnPrerun(PrerunCallState), fun, argVals);
 	}
 
 	useit PreBlock*       get_block() const { return activeBlock; }
@@ -178,6 +182,21 @@ class PrerunFunction : public PrerunValue, public EntityOverview {
 
 	Pair<Vec<ast::PrerunSentence*>, FileRange> sentences;
 
+	PreBytecode* bytecode          = nullptr;
+	bool         isBytecodeChecked = false;
+
+	// Results of previous calls, keyed by the uniqued llvm constants of the arguments. Calls are only cached while the
+	// function has not shown any side effect
+	Map<Vec<llvm::Constant*>, PrerunValue*> callCache;
+	bool                                    isMemoisable = true;
+
+	static u64 sideEffectCount;
+
+	useit PrerunProfileEntry* get_profile_entry();
+
+	useit PrerunValue* evaluate(Vec<PrerunValue*> arguments, Ctx* irCtx, FileRange fileRange);
+	useit PrerunValue* interpret(Vec<PrerunValue*> arguments, Ctx* irCtx, FileRange fileRange);
+
   public:
 	PrerunFunction(Mod* _parent, Identifier _name, Type* _retTy, Vec<ArgumentType*> _argTys,
 	               Pair<Vec<ast::PrerunSentence*>, FileRange> _sentences, VisibilityInfo visib, llvm::LLVMContext& ctx);
@@ -189,17 +208,49 @@ class PrerunFunction : public PrerunValue, public EntityOverview {
 		                         std::move(sentences), visibility, ctx);
 	}
 
+	~PrerunFunction() override {
+		if (bytecode != nullptr) {
+			std::destroy_at(bytecode);
+		}
+	}
+
 	void update_overview() final;
 
 	useit Identifier    get_name() const { return name; }
 	useit String        get_full_name() const;
 	useit Type*         get_return_type() const { return returnType; }
 	useit ArgumentType* get_argument_type_at(usize index) { return argTypes[index]; }
+	useit usize         get_argument_count() const { return argTypes.size(); }
 	useit Mod*          get_module() const { return parent; }
 
+	/// The range from the name of the function to the end of its body
+	useit FileRange get_definition_range() const { return FileRange(name.range, sentences.second); }
+
+	/// The bytecode of the function, if it has already been compiled
+	useit PreBytecode* get_compiled_bytecode() const { return bytecode; }
+
+	/// Compiles the bytecode on first use. Provides nullptr if the function can only be interpreted
+	useit PreBytecode* get_bytecode(Ctx* irCtx);
+
+	useit static PrerunFunction* find_by_full_name(String const& fullName);
+
 	useit VisibilityInfo const& get_visibility() const { return visibility; }
 
 	PrerunValue* call_prerun(Vec<PrerunValue*> arguments, Ctx* irCtx, FileRange fileRange);
+
+	/// Should be called by prerun sentences that have an effect outside of the call, like `say`. Functions that cause
+	/// side effects, directly or through other calls, stop caching their results
+	static void record_side_effect() { sideEffectCount++; }
+
+	useit static u64 get_side_effect_count() { return sideEffectCount; }
+
+	useit bool is_memoisable() const { return isMemoisable; }
+
+	/// Calls this function from the bytecode of another prerun function. This never falls back to the interpreter by
+	/// itself, so that the bytecode stays free of side effects and the outermost call can be safely repeated by the
+	/// interpreter if the status is fallback
+	useit PreStatus call_native(Vec<PreRegister> const& arguments, PreRegister& result, Ctx* irCtx,
+	                            FileRange fileRange);
 };
 
 } // namespace qat::ir
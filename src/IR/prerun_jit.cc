@@ -0,0 +1,508 @@
+#include "./prerun_jit.hpp"
+#include "../cli/config.hpp"
+#include "./context.hpp"
+#include "./prerun_function.hpp"
+#include "./prerun_profile.hpp"
+
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/TargetSelect.h>
+
+namespace qat::ir {
+
+std::unique_ptr<llvm::orc::LLJIT>               PrerunJit::jit{};
+bool                                            PrerunJit::isUnavailable = false;
+Map<PrerunFunction const*, PrerunJit::NativeFn> PrerunJit::compiled{};
+std::set<PrerunFunction const*>                 PrerunJit::rejected{};
+u64                                             PrerunJit::moduleCount     = 0;
+u64                                             PrerunJit::nativeCallCount = 0;
+
+bool PrerunJit::is_enabled() {
+	// Profiling counts every loop and call, which only the bytecode and the interpreter do
+	return cli::Config::get()->should_jit_prerun() && not cli::Config::get()->should_profile_prerun();
+}
+
+bool PrerunJit::is_verifying() { return cli::Config::get()->should_verify_prerun_jit(); }
+
+/// Lowers the bytecode of prerun functions to LLVM IR. Every function has the signature of `PrerunJit::NativeFn`, and
+/// every register of the bytecode is a 64-bit slot that holds either the bits of an integer or a double
+class PreJitLowering {
+	llvm::LLVMContext& llctx;
+	llvm::Module*      mod;
+	llvm::IRBuilder<>  builder;
+	Ctx*               irCtx;
+
+	Map<PrerunFunction*, llvm::Function*>    functions;
+	Vec<Pair<PrerunFunction*, PreBytecode*>> pending;
+
+	llvm::Function*        current = nullptr;
+	Vec<llvm::AllocaInst*> registers;
+	llvm::BasicBlock*      fallbackBlock = nullptr;
+
+	useit llvm::Type* get_i64() { return llvm::Type::getInt64Ty(llctx); }
+	useit llvm::Type* get_f64() { return llvm::Type::getDoubleTy(llctx); }
+
+	useit llvm::Constant* get_status(PreStatus status) {
+		return llvm::ConstantInt::get(llvm::Type::getInt32Ty(llctx), (u64)status);
+	}
+
+	useit llvm::Value* load_bits(u32 reg) { return builder.CreateLoad(get_i64(), registers[reg]); }
+	useit llvm::Value* load_real(u32 reg) { return builder.CreateBitCast(load_bits(reg), get_f64()); }
+
+	void store_bits(u32 reg, llvm::Value* value) { builder.CreateStore(value, registers[reg]); }
+	void store_real(u32 reg, llvm::Value* value) { store_bits(reg, builder.CreateBitCast(value, get_i64())); }
+
+	useit llvm::Value* wrap_bits(llvm::Value* value, u32 width) {
+		return (width >= 64u) ? value : builder.CreateAnd(value, (((u64)1u) << width) - 1u);
+	}
+
+	useit llvm::Value* sign_extend(llvm::Value* value, u32 width) {
+		return (width >= 64u) ? value : builder.CreateAShr(builder.CreateShl(value, 64u - width), 64u - width);
+	}
+
+	useit llvm::Value* round_real(llvm::Value* value, u32 width) {
+		return (width == 32u) ? builder.CreateFPExt(builder.CreateFPTrunc(value, llvm::Type::getFloatTy(llctx)),
+		                                            get_f64())
+		                      : value;
+	}
+
+	useit llvm::Value* from_bool(llvm::Value* value) { return builder.CreateZExt(value, get_i64()); }
+
+	/// Leaves the function with the fallback status if the condition is true, and continues in a new block otherwise
+	void fall_back_if(llvm::Value* condition) {
+		auto* continueBlock = llvm::BasicBlock::Create(llctx, "", current);
+		builder.CreateCondBr(condition, fallbackBlock, continueBlock);
+		builder.SetInsertPoint(continueBlock);
+	}
+
+	/// Counts a step, the same way as `PrerunProfile::add_step`
+	void add_step() {
+		auto* steps     = current->getArg(2);
+		auto* stepLimit = current->getArg(3);
+		auto* newSteps  = builder.CreateAdd(builder.CreateLoad(get_i64(), steps), builder.getInt64(1u));
+		builder.CreateStore(newSteps, steps);
+		fall_back_if(builder.CreateAnd(builder.CreateICmpNE(stepLimit, builder.getInt64(0u)),
+		                               builder.CreateICmpUGT(newSteps, stepLimit)));
+	}
+
+	void lower_instruction(PreBytecode* code, usize position, Vec<llvm::BasicBlock*> const& blocks);
+
+  public:
+	PreJitLowering(llvm::LLVMContext& _llctx, llvm::Module* _mod, Ctx* _irCtx)
+	    : llctx(_llctx), mod(_mod), builder(_llctx), irCtx(_irCtx) {}
+
+	/// Provides the function for the prerun function, and queues its bytecode for lowering. Provides nullptr if the
+	/// prerun function does not have bytecode
+	useit llvm::Function* get_function(PrerunFunction* function);
+
+	/// Lowers all queued functions, and provides the total number of instructions lowered
+	useit usize lower_all();
+};
+
+llvm::Function* PreJitLowering::get_function(PrerunFunction* function) {
+	auto existing = functions.find(function);
+	if (existing != functions.end()) {
+		return existing->second;
+	}
+	auto* code = function->get_bytecode(irCtx);
+	if (code == nullptr) {
+		return nullptr;
+	}
+	auto* ptrTy  = llvm::PointerType::get(llctx, 0u);
+	auto* result = llvm::Function::Create(
+	    llvm::FunctionType::get(llvm::Type::getInt32Ty(llctx), {ptrTy, ptrTy, ptrTy, get_i64()}, false),
+	    functions.empty() ? llvm::GlobalValue::ExternalLinkage : llvm::GlobalValue::InternalLinkage,
+	    "qat.prerun." + std::to_string(functions.size()), mod);
+	functions[function] = result;
+	pending.push_back({function, code});
+	return result;
+}
+
+usize PreJitLowering::lower_all() {
+	usize instructionCount = 0;
+	while (not pending.empty()) {
+		auto [function, code] = pending.back();
+		pending.pop_back();
+		current = functions[function];
+		instructionCount += code->code.size();
+
+		auto* entryBlock = llvm::BasicBlock::Create(llctx, "entry", current);
+		fallbackBlock    = llvm::BasicBlock::Create(llctx, "fallback", current);
+		Vec<llvm::BasicBlock*> blocks;
+		blocks.reserve(code->code.size());
+		for (usize i = 0; i < code->code.size(); i++) {
+			blocks.push_back(llvm::BasicBlock::Create(llctx, "", current));
+		}
+		builder.SetInsertPoint(fallbackBlock);
+		builder.CreateRet(get_status(PreStatus::fallback));
+
+		builder.SetInsertPoint(entryBlock);
+		registers.clear();
+		for (usize i = 0; i < code->registerTypes.size(); i++) {
+			registers.push_back(builder.CreateAlloca(get_i64()));
+			store_bits(i, (i < code->argumentCount)
+			                  ? (llvm::Value*)builder.CreateLoad(
+			                        get_i64(), builder.CreateConstInBoundsGEP1_64(get_i64(), current->getArg(0), i))
+			                  : builder.getInt64(0u));
+		}
+		builder.CreateBr(blocks.front());
+
+		for (usize i = 0; i < code->code.size(); i++) {
+			builder.SetInsertPoint(blocks[i]);
+			lower_instruction(code, i, blocks);
+		}
+	}
+	return instructionCount;
+}
+
+void PreJitLowering::lower_instruction(PreBytecode* code, usize position, Vec<llvm::BasicBlock*> const& blocks) {
+	auto const& ins      = code->code[position];
+	auto*       next     = (position + 1 < blocks.size()) ? blocks[position + 1] : fallbackBlock;
+	auto        lhsBits  = [&]() { return load_bits(ins.lhs); };
+	auto        rhsBits  = [&]() { return load_bits(ins.rhs); };
+	auto        lhsReal  = [&]() { return load_real(ins.lhs); };
+	auto        rhsReal  = [&]() { return load_real(ins.rhs); };
+	auto        lhsSign  = [&]() { return sign_extend(lhsBits(), ins.width); };
+	auto        rhsSign  = [&]() { return sign_extend(rhsBits(), ins.width); };
+	auto        setBits  = [&](llvm::Value* value) { store_bits(ins.dest, value); };
+	auto        setReal  = [&](llvm::Value* value) { store_real(ins.dest, value); };
+	auto        setWrap  = [&](llvm::Value* value) { setBits(wrap_bits(value, ins.width)); };
+	auto        setRound = [&](llvm::Value* value) { setReal(round_real(value, ins.width)); };
+	switch (ins.op) {
+		case PreOp::loadConstant: {
+			setBits(builder.getInt64(code->constants[ins.lhs].bits));
+			break;
+		}
+		case PreOp::move: {
+			setBits(lhsBits());
+			break;
+		}
+		case PreOp::add: {
+			setWrap(builder.CreateAdd(lhsBits(), rhsBits()));
+			break;
+		}
+		case PreOp::subtract: {
+			setWrap(builder.CreateSub(lhsBits(), rhsBits()));
+			break;
+		}
+		case PreOp::multiply: {
+			setWrap(builder.CreateMul(lhsBits(), rhsBits()));
+			break;
+		}
+		case PreOp::signedDivide:
+		case PreOp::signedRemainder: {
+			auto* dividend = lhsSign();
+			auto* divisor  = rhsSign();
+			auto* minValue = sign_extend(builder.getInt64(((u64)1u) << (ins.width - 1u)), ins.width);
+			fall_back_if(builder.CreateOr(
+			    builder.CreateICmpEQ(divisor, builder.getInt64(0u)),
+			    builder.CreateAnd(builder.CreateICmpEQ(divisor, builder.getInt64((u64)-1)),
+			                      builder.CreateICmpEQ(dividend, minValue))));
+			setWrap((ins.op == PreOp::signedDivide) ? builder.CreateSDiv(dividend, divisor)
+			                                        : builder.CreateSRem(dividend, divisor));
+			break;
+		}
+		case PreOp::unsignedDivide:
+		case PreOp::unsignedRemainder: {
+			auto* divisor = rhsBits();
+			fall_back_if(builder.CreateICmpEQ(divisor, builder.getInt64(0u)));
+			setBits((ins.op == PreOp::unsignedDivide) ? builder.CreateUDiv(lhsBits(), divisor)
+			                                          : builder.CreateURem(lhsBits(), divisor));
+			break;
+		}
+		case PreOp::bitwiseAnd: {
+			setBits(builder.CreateAnd(lhsBits(), rhsBits()));
+			break;
+		}
+		case PreOp::bitwiseOr: {
+			setBits(builder.CreateOr(lhsBits(), rhsBits()));
+			break;
+		}
+		case PreOp::bitwiseXor: {
+			setBits(builder.CreateXor(lhsBits(), rhsBits()));
+			break;
+		}
+		case PreOp::shiftLeft:
+		case PreOp::logicalShiftRight:
+		case PreOp::arithmeticShiftRight: {
+			auto* amount = rhsBits();
+			fall_back_if(builder.CreateICmpUGE(amount, builder.getInt64(ins.width)));
+			if (ins.op == PreOp::shiftLeft) {
+				setWrap(builder.CreateShl(lhsBits(), amount));
+			} else if (ins.op == PreOp::logicalShiftRight) {
+				setBits(builder.CreateLShr(lhsBits(), amount));
+			} else {
+				setWrap(builder.CreateAShr(lhsSign(), amount));
+			}
+			break;
+		}
+		case PreOp::negate: {
+			setWrap(builder.CreateSub(builder.getInt64(0u), lhsBits()));
+			break;
+		}
+		case PreOp::bitwiseNot: {
+			setWrap(builder.CreateNot(lhsBits()));
+			break;
+		}
+		case PreOp::equal: {
+			setBits(from_bool(builder.CreateICmpEQ(lhsBits(), rhsBits())));
+			break;
+		}
+		case PreOp::notEqual: {
+			setBits(from_bool(builder.CreateICmpNE(lhsBits(), rhsBits())));
+			break;
+		}
+		case PreOp::signedLess: {
+			setBits(from_bool(builder.CreateICmpSLT(lhsSign(), rhsSign())));
+			break;
+		}
+		case PreOp::signedGreater: {
+			setBits(from_bool(builder.CreateICmpSGT(lhsSign(), rhsSign())));
+			break;
+		}
+		case PreOp::signedLessOrEqual: {
+			setBits(from_bool(builder.CreateICmpSLE(lhsSign(), rhsSign())));
+			break;
+		}
+		case PreOp::signedGreaterOrEqual: {
+			setBits(from_bool(builder.CreateICmpSGE(lhsSign(), rhsSign())));
+			break;
+		}
+		case PreOp::unsignedLess: {
+			setBits(from_bool(builder.CreateICmpULT(lhsBits(), rhsBits())));
+			break;
+		}
+		case PreOp::unsignedGreater: {
+			setBits(from_bool(builder.CreateICmpUGT(lhsBits(), rhsBits())));
+			break;
+		}
+		case PreOp::unsignedLessOrEqual: {
+			setBits(from_bool(builder.CreateICmpULE(lhsBits(), rhsBits())));
+			break;
+		}
+		case PreOp::unsignedGreaterOrEqual: {
+			setBits(from_bool(builder.CreateICmpUGE(lhsBits(), rhsBits())));
+			break;
+		}
+		case PreOp::floatAdd: {
+			setRound(builder.CreateFAdd(lhsReal(), rhsReal()));
+			break;
+		}
+		case PreOp::floatSubtract: {
+			setRound(builder.CreateFSub(lhsReal(), rhsReal()));
+			break;
+		}
+		case PreOp::floatMultiply: {
+			setRound(builder.CreateFMul(lhsReal(), rhsReal()));
+			break;
+		}
+		case PreOp::floatDivide: {
+			setRound(builder.CreateFDiv(lhsReal(), rhsReal()));
+			break;
+		}
+		case PreOp::floatRemainder: {
+			setRound(builder.CreateFRem(lhsReal(), rhsReal()));
+			break;
+		}
+		case PreOp::floatNegate: {
+			setReal(builder.CreateFNeg(lhsReal()));
+			break;
+		}
+		case PreOp::floatEqual: {
+			setBits(from_bool(builder.CreateFCmpOEQ(lhsReal(), rhsReal())));
+			break;
+		}
+		case PreOp::floatNotEqual: {
+			setBits(from_bool(builder.CreateFCmpONE(lhsReal(), rhsReal())));
+			break;
+		}
+		case PreOp::floatLess: {
+			setBits(from_bool(builder.CreateFCmpOLT(lhsReal(), rhsReal())));
+			break;
+		}
+		case PreOp::floatGreater: {
+			setBits(from_bool(builder.CreateFCmpOGT(lhsReal(), rhsReal())));
+			break;
+		}
+		case PreOp::floatLessOrEqual: {
+			setBits(from_bool(builder.CreateFCmpOLE(lhsReal(), rhsReal())));
+			break;
+		}
+		case PreOp::floatGreaterOrEqual: {
+			setBits(from_bool(builder.CreateFCmpOGE(lhsReal(), rhsReal())));
+			break;
+		}
+		case PreOp::jump: {
+			builder.CreateBr(blocks[ins.dest]);
+			return;
+		}
+		case PreOp::jumpIfFalse: {
+			builder.CreateCondBr(builder.CreateICmpEQ(lhsBits(), builder.getInt64(0u)), blocks[ins.dest], next);
+			return;
+		}
+		case PreOp::loopEnter: {
+			break;
+		}
+		case PreOp::loopBack: {
+			add_step();
+			builder.CreateBr(blocks[ins.dest]);
+			return;
+		}
+		case PreOp::call: {
+			auto const& site   = code->callSites[ins.lhs];
+			auto*       callee = get_function(site.callee);
+			if (callee == nullptr) {
+				// The callee is only known to have no bytecode at this point, so the call is left to the interpreter
+				builder.CreateBr(fallbackBlock);
+				return;
+			}
+			// Calls count as a step, the same way as `PrerunFunction::call_native`
+			add_step();
+			llvm::IRBuilder<> entryBuilder(&current->getEntryBlock(), current->getEntryBlock().begin());
+			auto* callArgs   = entryBuilder.CreateAlloca(get_i64(), builder.getInt64(std::max<usize>(
+			                                                                   site.arguments.size(), 1u)));
+			auto* callResult = entryBuilder.CreateAlloca(get_i64());
+			for (usize i = 0; i < site.arguments.size(); i++) {
+				builder.CreateStore(load_bits(site.arguments[i]),
+				                    builder.CreateConstInBoundsGEP1_64(get_i64(), callArgs, i));
+			}
+			auto* status = builder.CreateCall(callee, {callArgs, callResult, current->getArg(2), current->getArg(3)});
+			fall_back_if(builder.CreateICmpEQ(status, get_status(PreStatus::fallback)));
+			setBits(builder.CreateSelect(builder.CreateICmpEQ(status, get_status(PreStatus::given)),
+			                             builder.CreateLoad(get_i64(), callResult), load_bits(ins.dest)));
+			break;
+		}
+		case PreOp::give: {
+			builder.CreateStore(lhsBits(), current->getArg(1));
+			builder.CreateRet(get_status(PreStatus::given));
+			return;
+		}
+		case PreOp::giveVoid: {
+			builder.CreateRet(get_status(PreStatus::givenVoid));
+			return;
+		}
+		case PreOp::end: {
+			builder.CreateRet(get_status(PreStatus::ended));
+			return;
+		}
+		case PreOp::fail: {
+			builder.CreateBr(fallbackBlock);
+			return;
+		}
+	}
+	builder.CreateBr(next);
+}
+
+llvm::orc::LLJIT* PrerunJit::get_jit(Ctx* irCtx, FileRange const& fileRange) {
+	if ((jit != nullptr) || isUnavailable) {
+		return jit.get();
+	}
+	llvm::InitializeNativeTarget();
+	llvm::InitializeNativeTargetAsmPrinter();
+	auto created = llvm::orc::LLJITBuilder().create();
+	if (not created) {
+		isUnavailable = true;
+		irCtx->Warning("The JIT for prerun functions could not be created for this host, so the bytecode will be used "
+		               "instead. The reason is: " +
+		                   llvm::toString(created.takeError()),
+		               fileRange);
+		return nullptr;
+	}
+	jit = std::move(created.get());
+	// The remainder of floating point values is lowered to a call to `fmod`, which is found in the compiler itself
+	auto generator =
+	    llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(jit->getDataLayout().getGlobalPrefix());
+	if (generator) {
+		jit->getMainJITDylib().addGenerator(std::move(generator.get()));
+	} else {
+		llvm::consumeError(generator.takeError());
+	}
+	return jit.get();
+}
+
+PrerunJit::NativeFn PrerunJit::get_native(PrerunFunction* function, Ctx* irCtx, FileRange const& fileRange) {
+	auto existing = compiled.find(function);
+	if (existing != compiled.end()) {
+		return existing->second;
+	}
+	if (rejected.contains(function)) {
+		return nullptr;
+	}
+	auto* theJit = get_jit(irCtx, fileRange);
+	if (theJit == nullptr) {
+		return nullptr;
+	}
+	auto llctx = std::make_unique<llvm::LLVMContext>();
+	auto mod   = std::make_unique<llvm::Module>("qat.prerun.jit." + std::to_string(moduleCount), *llctx);
+	mod->setDataLayout(theJit->getDataLayout());
+	mod->setTargetTriple(theJit->getTargetTriple().str());
+
+	PreJitLowering lowering(*llctx, mod.get(), irCtx);
+	auto*          entry = lowering.get_function(function);
+	if (entry == nullptr) {
+		rejected.insert(function);
+		return nullptr;
+	}
+	auto instructionCount = lowering.lower_all();
+	if (((instructionCount < instructionThreshold) && not is_verifying()) || llvm::verifyModule(*mod)) {
+		rejected.insert(function);
+		return nullptr;
+	}
+	// The entry has a unique name in the JIT, while the functions it calls are internal to its module
+	auto entryName = "qat.prerun.jit." + std::to_string(moduleCount++);
+	entry->setName(entryName);
+
+	llvm::LoopAnalysisManager     loopAnalysis;
+	llvm::FunctionAnalysisManager functionAnalysis;
+	llvm::CGSCCAnalysisManager    cgsccAnalysis;
+	llvm::ModuleAnalysisManager   moduleAnalysis;
+	llvm::PassBuilder             passBuilder;
+	passBuilder.registerModuleAnalyses(moduleAnalysis);
+	passBuilder.registerCGSCCAnalyses(cgsccAnalysis);
+	passBuilder.registerFunctionAnalyses(functionAnalysis);
+	passBuilder.registerLoopAnalyses(loopAnalysis);
+	passBuilder.crossRegisterProxies(loopAnalysis, functionAnalysis, cgsccAnalysis, moduleAnalysis);
+	passBuilder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O2).run(*mod, moduleAnalysis);
+
+	if (auto error = theJit->addIRModule(llvm::orc::ThreadSafeModule(std::move(mod), std::move(llctx)))) {
+		llvm::consumeError(std::move(error));
+		rejected.insert(function);
+		return nullptr;
+	}
+	auto address = theJit->lookup(entryName);
+	if (not address) {
+		llvm::consumeError(address.takeError());
+		rejected.insert(function);
+		return nullptr;
+	}
+	auto native        = address->toPtr<NativeFn>();
+	compiled[function] = native;
+	return native;
+}
+
+PreStatus PrerunJit::execute(NativeFn native, Vec<PreRegister> const& arguments, PreRegister& result) {
+	nativeCallCount++;
+	u64  steps  = PrerunProfile::get_step_count();
+	auto status = (PreStatus)native(arguments.data(), &result, &steps, PrerunProfile::get_active_step_limit());
+	PrerunProfile::set_step_count(steps);
+	return status;
+}
+
+void PrerunJit::verify(PrerunFunction* function, PrerunValue* nativeResult, PrerunValue* expected, Ctx* irCtx,
+                       FileRange const& fileRange) {
+	auto* nativeConstant   = (nativeResult == nullptr) ? nullptr : nativeResult->get_llvm_constant();
+	auto* expectedConstant = (expected == nullptr) ? nullptr : expected->get_llvm_constant();
+	// Constants are uniqued by LLVM, so equal values are the same constant
+	if (((nativeResult == nullptr) != (expected == nullptr)) || (nativeConstant != expectedConstant)) {
+		irCtx->Error("The native code of the prerun function " + irCtx->color(function->get_full_name()) +
+		                 " produced a different result than the interpreter for this call. This is a bug in the JIT "
+		                 "of prerun functions, and can be avoided by not using " +
+		                 irCtx->color("--prerun-jit"),
+		             fileRange);
+	}
+}
+
+} // namespace qat::ir
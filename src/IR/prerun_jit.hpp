@@ -0,0 +1,64 @@
+#ifndef QAT_IR_PRERUN_JIT_HPP
+#define QAT_IR_PRERUN_JIT_HPP
+
+#include "../utils/file_range.hpp"
+#include "../utils/helpers.hpp"
+#include "../utils/macros.hpp"
+#include "./prerun_bytecode.hpp"
+
+#include <memory>
+#include <set>
+
+namespace llvm::orc {
+class LLJIT;
+}
+
+namespace qat::ir {
+
+class Ctx;
+class PrerunFunction;
+class PrerunValue;
+
+/// Compiles the bytecode of heavy prerun functions to native code using the ORC JIT of LLVM, for `--prerun-jit`. The
+/// native code follows the bytecode exactly, including the fallback to the interpreter for anything that should be
+/// reported as an error, so the interpreter remains the reference for the semantics of prerun functions
+class PrerunJit {
+  public:
+	using NativeFn = i32 (*)(PreRegister const* arguments, PreRegister* result, u64* steps, u64 stepLimit);
+
+  private:
+	/// Functions with less instructions than this, including the functions they call, keep using the bytecode
+	static constexpr usize instructionThreshold = 64u;
+
+	static std::unique_ptr<llvm::orc::LLJIT>    jit;
+	static bool                                 isUnavailable;
+	static Map<PrerunFunction const*, NativeFn> compiled;
+	static std::set<PrerunFunction const*>      rejected;
+	static u64                                  moduleCount;
+	static u64                                  nativeCallCount;
+
+	useit static llvm::orc::LLJIT* get_jit(Ctx* irCtx, FileRange const& fileRange);
+
+  public:
+	useit static bool is_enabled();
+	useit static bool is_verifying();
+
+	/// Provides the native code of the function, compiling it on first use. Provides nullptr if the function or one of
+	/// the functions it calls does not have bytecode, or if it is below the instruction threshold. In the verification
+	/// mode the threshold is ignored, so that every function that can be compiled is checked
+	useit static NativeFn get_native(PrerunFunction* function, Ctx* irCtx, FileRange const& fileRange);
+
+	/// Runs the native code with the same steps and step limit as the bytecode
+	useit static PreStatus execute(NativeFn native, Vec<PreRegister> const& arguments, PreRegister& result);
+
+	/// Reports an error if the result of the native code is different from the result of the interpreter
+	static void verify(PrerunFunction* function, PrerunValue* nativeResult, PrerunValue* expected, Ctx* irCtx,
+	                   FileRange const& fileRange);
+
+	useit static usize get_compiled_count() { return compiled.size(); }
+	useit static u64   get_native_call_count() { return nativeCallCount; }
+};
+
+} // namespace qat::ir
+
+#endif
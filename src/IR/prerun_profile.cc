@@ -0,0 +1,66 @@
+#include "./prerun_profile.hpp"
+#include "../cli/config.hpp"
+
+#include <algorithm>
+
+namespace qat::ir {
+
+Map<void const*, PrerunProfileEntry> PrerunProfile::entries{};
+
+u64   PrerunProfile::stepCount       = 0;
+u64   PrerunProfile::activeStepLimit = 0;
+usize PrerunProfile::evaluationDepth = 0;
+
+PrerunProfileEntry::operator Json() const {
+	String kindStr;
+	switch (kind) {
+		case PrerunProfileKind::function: {
+			kindStr = "function";
+			break;
+		}
+		case PrerunProfileKind::loop: {
+			kindStr = "loop";
+			break;
+		}
+		case PrerunProfileKind::constraint: {
+			kindStr = "constraint";
+			break;
+		}
+	}
+	return Json()
+	    ._("kind", kindStr)
+	    ._("name", name)
+	    ._("fileRange", fileRange)
+	    ._("calls", calls)
+	    ._("cachedCalls", cachedCalls)
+	    ._("iterations", iterations)
+	    ._("timeInMicroSeconds", timeInMicros);
+}
+
+bool PrerunProfile::is_enabled() { return cli::Config::get()->should_profile_prerun(); }
+
+u64 PrerunProfile::get_step_limit() { return cli::Config::get()->get_prerun_step_limit(); }
+
+String PrerunProfile::step_limit_message() {
+	return "The prerun evaluation exceeded the limit of " + std::to_string(get_step_limit()) +
+	       " steps here. If this is intentional, the limit can be changed using --prerun-step-limit=<count>, or " +
+	       "removed using --prerun-step-limit=0";
+}
+
+JsonValue PrerunProfile::to_json() {
+	Vec<PrerunProfileEntry const*> sorted;
+	sorted.reserve(entries.size());
+	for (auto const& entry : entries) {
+		sorted.push_back(&entry.second);
+	}
+	std::sort(sorted.begin(), sorted.end(), [](PrerunProfileEntry const* first, PrerunProfileEntry const* second) {
+		return first->timeInMicros > second->timeInMicros;
+	});
+	Vec<JsonValue> result;
+	for (auto* entry : sorted) {
+		result.push_back((Json)(*entry));
+	}
+	return result;
+}
+
+} // namespace qat::ir
@@ -0,0 +1,112 @@
+#ifndef QAT_IR_PRERUN_PROFILE_HPP
+#define QAT_IR_PRERUN_PROFILE_HPP
+
+#include "../utils/file_range.hpp"
+#include "../utils/helpers.hpp"
+#include "../utils/json.hpp"
+#include "../utils/macros.hpp"
+
+#include <chrono>
+
+namespace qat::ir {
+
+enum class PrerunProfileKind {
+	function,
+	loop,
+	constraint,
+};
+
+struct PrerunProfileEntry {
+	PrerunProfileKind kind;
+	String            name;
+	FileRange         fileRange;
+	u64               calls        = 0;
+	u64               cachedCalls  = 0;
+	u64               iterations   = 0;
+	u64               timeInMicros = 0;
+
+	operator Json() const;
+};
+
+/// Collects the statistics of `--prerun-profile`, and keeps count of the steps taken by the current prerun
+/// evaluation, so that runaway loops and recursion can be stopped at `--prerun-step-limit`
+class PrerunProfile {
+	static Map<void const*, PrerunProfileEntry> entries;
+
+	static u64   stepCount;
+	static u64   activeStepLimit;
+	static usize evaluationDepth;
+
+  public:
+	useit static bool is_enabled();
+	useit static u64  get_step_limit();
+
+	/// Provides the entry for the provided function, loop or constraint node. Entries are only created while profiling
+	/// is enabled, otherwise this provides nullptr. The name is only computed when the entry is created
+	template <typename NameFn>
+	useit static PrerunProfileEntry* get_entry(void const* node, PrerunProfileKind kind, NameFn&& nameFn,
+	                                           FileRange const& fileRange) {
+		if (not is_enabled()) {
+			return nullptr;
+		}
+		auto existing = entries.find(node);
+		if (existing != entries.end()) {
+			return &existing->second;
+		}
+		return &entries.emplace(node, PrerunProfileEntry{.kind = kind, .name = nameFn(), .fileRange = fileRange})
+		            .first->second;
+	}
+
+	/// Counts one step of the current evaluation. Provides false if the step limit has been exceeded
+	useit static bool add_step() {
+		stepCount++;
+		return (stepCount <= activeStepLimit) || (activeStepLimit == 0u);
+	}
+
+	useit static u64 get_step_count() { return stepCount; }
+	static void      set_step_count(u64 count) { stepCount = count; }
+
+	/// The step limit of the current evaluation, which is 0 if there is no limit
+	useit static u64 get_active_step_limit() { return activeStepLimit; }
+
+	/// The step count is reset at the start of every outermost prerun function call
+	static void enter_evaluation() {
+		if (evaluationDepth == 0u) {
+			stepCount       = 0u;
+			activeStepLimit = get_step_limit();
+		}
+		evaluationDepth++;
+	}
+
+	static void exit_evaluation() { evaluationDepth--; }
+
+	useit static String step_limit_message();
+
+	useit static JsonValue to_json();
+};
+
+/// Adds a call and the time spent in the scope to the provided entry, if there is one
+class PrerunProfileScope {
+	PrerunProfileEntry*                            entry;
+	std::chrono::high_resolution_clock::time_point startTime;
+
+  public:
+	explicit PrerunProfileScope(PrerunProfileEntry* _entry) : entry(_entry) {
+		if (entry != nullptr) {
+			entry->calls++;
+			startTime = std::chrono::high_resolution_clock::now();
+		}
+	}
+
+	~PrerunProfileScope() {
+		if (entry != nullptr) {
+			entry->timeInMicros += std::chrono::duration_cast<std::chrono::microseconds>(
+			                           std::chrono::high_resolution_clock::now() - startTime)
+			                           .count();
+		}
+	}
+};
+
+} // namespace qat::ir
+
+#endif
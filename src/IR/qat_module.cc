@@ -10,7 +10,10 @@
 #include "./function.hpp"
 #include "./global_entity.hpp"
 #include "./link_names.hpp"
+#include "./number_text.hpp"
+#include "./pool_allocator.hpp"
 #include "./prerun_function.hpp"
+#include "./say_runtime.hpp"
 #include "./types/definition.hpp"
 #include "./types/flag.hpp"
 #include "./types/opaque.hpp"
@@ -21,6 +24,7 @@
 #include "./types/void.hpp"
 #include "./value.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <lld/Common/Driver.h>
@@ -35,6 +39,7 @@
 #include <llvm/Support/CodeGen.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/TargetParser/Triple.h>
+#include <llvm/Transforms/Utils/Evaluator.h>
 #include <memory>
 #include <system_error>
 
@@ -56,6 +61,7 @@ std::map<InternalDependency, Function*> Mod::providedFunctions = {};
 
 Vec<Mod*>       Mod::allModules{};
 Vec<fs::path>   Mod::usableNativeLibPaths{};
+u64             Mod::foldedGlobalCount    = 0;
 Maybe<String>   Mod::usableClangPath      = None;
 Maybe<fs::path> Mod::windowsMSVCLibPath   = None;
 Maybe<fs::path> Mod::windowsATLMFCLibPath = None;
@@ -202,6 +208,16 @@ Vec<Function*> Mod::collect_mod_initialisers() {
 	return res;
 }
 
+Vec<Pair<String, FileRange>> Mod::get_runtime_globals() {
+	Vec<Pair<String, FileRange>> result;
+	for (auto* mod : allModules) {
+		for (auto& runtimeGlobal : mod->runtimeGlobals) {
+			result.push_back({mod->get_fullname_with_child(runtimeGlobal.name.value), runtimeGlobal.name.range});
+		}
+	}
+	return result;
+}
+
 ModuleType Mod::get_mod_type() const { return moduleType; }
 
 const VisibilityInfo& Mod::get_visibility() const { return visibility; }
@@ -278,6 +294,37 @@ Maybe<String> Mod::get_relevant_foreign_id() const {
 	}
 }
 
+InternalDependency Mod::heap_dependency(InternalDependency systemDependency) {
+	// The allocator is chosen for the whole build, as modules free the heap pointers of each other
+	if (not cli::Config::get()->has_pool_allocator()) {
+		return systemDependency;
+	}
+	switch (systemDependency) {
+		case InternalDependency::malloc:
+			return InternalDependency::poolAllocate;
+		case InternalDependency::realloc:
+			return InternalDependency::poolReallocate;
+		case InternalDependency::free:
+			return InternalDependency::poolFree;
+		default:
+			return systemDependency;
+	}
+}
+
+Maybe<InternalDependency> Mod::thread_exit_dependency(ir::Ctx* irCtx) {
+	auto const& triple = irCtx->clangTargetInfo->getTriple();
+	if (triple.isOSDarwin()) {
+		return InternalDependency::darwinThreadAtExit;
+	}
+	// __cxa_thread_atexit_impl is provided by glibc, bionic and the libc of FreeBSD, but not by musl
+	if ((triple.isOSLinux() && (triple.isGNUEnvironment() || triple.isAndroid() ||
+	                            (triple.getEnvironment() == llvm::Triple::UnknownEnvironment))) ||
+	    triple.isOSFreeBSD()) {
+		return InternalDependency::cxaThreadAtExit;
+	}
+	return None;
+}
+
 bool Mod::has_nth_parent(u32 n) const {
 	if (n == 1) {
 		return (parent != nullptr);
@@ -405,12 +452,17 @@ void Mod::update_overview() {
 	for (auto const& men : fsBroughtMentions) {
 		fsBroughtMentionsJson.push_back(men.second);
 	}
+	Vec<JsonValue> runtimeGlobalsJson;
+	for (auto const& runtimeGlobal : runtimeGlobals) {
+		runtimeGlobalsJson.push_back(runtimeGlobal.name.value);
+	}
 	ovInfo._("moduleID", get_id())
 	    ._("fullName", get_full_name())
 	    ._("isFilesystemLib", rootLib)
 	    ._("moduleType", moduleTyStr)
 	    ._("visibility", visibility)
 	    ._("hasModuleInitialiser", ((moduleInitialiser != nullptr) && (nonConstantGlobals > 0)))
+	    ._("runtimeInitialisedGlobals", runtimeGlobalsJson)
 	    ._("integerBitwidths", integerBitsVal)
 	    ._("unsignedBitwidths", unsignedBitsVal)
 	    ._("filesystemBroughtMentions", fsBroughtMentionsJson);
@@ -542,19 +594,35 @@ bool Mod::is_in_foreign_mod_of_type(String id) const {
 }
 
 LinkNames Mod::get_link_names() const {
+	if (linkNames.has_value()) {
+		return linkNames.value();
+	}
+	LinkNames result;
 	if (parent) {
-		auto parentVal = parent->get_link_names();
+		result = parent->get_link_names();
 		if (should_be_named()) {
-			parentVal.addUnit(LinkNameUnit(name.value, LinkUnitType::lib, {}), get_relevant_foreign_id());
+			result.addUnit(LinkNameUnit(name.value, LinkUnitType::lib, {}), get_relevant_foreign_id());
 		}
-		return parentVal;
 	} else {
 		if (should_be_named()) {
-			return LinkNames({LinkNameUnit(name.value, LinkUnitType::lib, {})}, get_relevant_foreign_id(), nullptr);
+			result = LinkNames({LinkNameUnit(name.value, LinkUnitType::lib, {})}, get_relevant_foreign_id(), nullptr);
 		} else {
-			return LinkNames({}, get_relevant_foreign_id(), nullptr);
+			result = LinkNames({}, get_relevant_foreign_id(), nullptr);
 		}
 	}
+	if (not result.units.empty()) {
+		// Mangling the name of the module here lets every entity inside it derive its name from this prefix
+		(void)result.toName();
+	}
+	linkNames = result;
+	return result;
+}
+
+void Mod::reset_link_names() const {
+	linkNames.reset();
+	for (auto* sub : submodules) {
+		sub->reset_link_names();
+	}
 }
 
 bool Mod::should_be_named() const { return moduleType == ModuleType::lib; }
@@ -570,7 +638,10 @@ Function* Mod::get_mod_initialiser(Ctx* ctx) {
 	return moduleInitialiser;
 }
 
-void Mod::add_non_const_global_counter() { nonConstantGlobals++; }
+void Mod::add_runtime_global(RuntimeGlobal runtimeGlobal) {
+	nonConstantGlobals++;
+	runtimeGlobals.push_back(std::move(runtimeGlobal));
+}
 
 bool Mod::should_call_initialiser() const { return nonConstantGlobals != 0; }
 
@@ -2270,11 +2341,70 @@ void Mod::node_update_dependencies(Ctx* ctx) {
 	}
 }
 
-void Mod::setup_llvm_file(Ctx* ctx) {
+void Mod::finalise_initialiser(Ctx* ctx) {
 	if (moduleInitialiser) {
 		moduleInitialiser->get_block()->set_active(ctx->builder);
 		ctx->builder.CreateRetVoid();
+		if (nonConstantGlobals > 0) {
+			fold_initialiser(ctx);
+		}
+	}
+	for (auto* sub : submodules) {
+		sub->finalise_initialiser(ctx);
+	}
+}
+
+void Mod::fold_initialiser(Ctx* ctx) {
+	// Runtime globals are weak until their value is known, and the evaluator only commits stores to globals that cannot
+	// be replaced while linking
+	for (auto& runtimeGlobal : runtimeGlobals) {
+		runtimeGlobal.global->setLinkage(runtimeGlobal.linkage);
+	}
+	auto*                              llvmFunction = moduleInitialiser->get_llvm_function();
+	llvm::Constant*                    returnValue  = nullptr;
+	llvm::SmallVector<llvm::Constant*> noArguments;
+	llvm::Evaluator                    evaluator(llvmModule->getDataLayout(), nullptr);
+
+	bool isFoldable     = evaluator.EvaluateFunction(llvmFunction, returnValue, noArguments);
+	auto mutatedGlobals = evaluator.getMutatedInitializers();
+	// Folding is limited to initialisers that only write to the globals of this module. Otherwise the order in which
+	// the initialisers of different modules run could be observed
+	for (auto& mutated : mutatedGlobals) {
+		if (not isFoldable) {
+			break;
+		}
+		isFoldable = std::any_of(runtimeGlobals.begin(), runtimeGlobals.end(), [&](RuntimeGlobal const& runtimeGlobal) {
+			return runtimeGlobal.global == mutated.first;
+		});
+	}
+	if (not isFoldable) {
+		for (auto& runtimeGlobal : runtimeGlobals) {
+			runtimeGlobal.global->setLinkage(llvm::GlobalValue::LinkageTypes::WeakAnyLinkage);
+		}
+		return;
+	}
+	for (auto& mutated : mutatedGlobals) {
+		mutated.first->setInitializer(mutated.second);
+	}
+	for (auto& runtimeGlobal : runtimeGlobals) {
+		runtimeGlobal.global->setConstant(not runtimeGlobal.isVariable);
 	}
+	Vec<llvm::CallInst*> initialiserCalls;
+	for (auto* user : llvmFunction->users()) {
+		if (auto* call = llvm::dyn_cast<llvm::CallInst>(user)) {
+			initialiserCalls.push_back(call);
+		}
+	}
+	for (auto* call : initialiserCalls) {
+		call->eraseFromParent();
+	}
+	llvmFunction->deleteBody();
+	foldedGlobalCount += runtimeGlobals.size();
+	nonConstantGlobals = 0;
+	runtimeGlobals.clear();
+}
+
+void Mod::setup_llvm_file(Ctx* ctx) {
 	auto* cfg = cli::Config::get();
 	SHOW("Creating llvm output path")
 	auto fileName = get_writable_name() + ".ll";
@@ -3801,7 +3931,7 @@ llvm::Function* Mod::link_intrinsic(IntrinsicID intr) {
 }
 
 String Mod::link_internal_dependency(InternalDependency nval, Ctx* irCtx, FileRange rangeVal) {
-	if (cli::Config::get()->is_freestanding()) {
+	if (cli::Config::get()->is_freestanding() && not internal_dependency_is_generated(nval)) {
 		if (has_provided_function(nval)) {
 			auto resFn      = get_provided_function(nval);
 			auto existingFn = llvmModule->getFunction(resFn->get_llvm_function()->getName());
@@ -3943,6 +4073,131 @@ String Mod::link_internal_dependency(InternalDependency nval, Ctx* irCtx, FileRa
 			}
 			return "pthread_attr_init";
 		}
+		case InternalDependency::cxaThreadAtExit: {
+			if (not llvmModule->getFunction("__cxa_thread_atexit_impl")) {
+				llvm::Type* voidPtrTy = llvm::Type::getInt8Ty(llCtx)->getPointerTo();
+				llvm::Function::Create(
+				    llvm::FunctionType::get(llvm::Type::getInt32Ty(llCtx), {voidPtrTy, voidPtrTy, voidPtrTy}, false),
+				    llvm::GlobalValue::LinkageTypes::ExternalLinkage, "__cxa_thread_atexit_impl", llvmModule);
+			}
+			return "__cxa_thread_atexit_impl";
+		}
+		case InternalDependency::darwinThreadAtExit: {
+			if (not llvmModule->getFunction("_tlv_atexit")) {
+				llvm::Type* voidPtrTy = llvm::Type::getInt8Ty(llCtx)->getPointerTo();
+				llvm::Function::Create(
+				    llvm::FunctionType::get(llvm::Type::getVoidTy(llCtx), {voidPtrTy, voidPtrTy}, false),
+				    llvm::GlobalValue::LinkageTypes::ExternalLinkage, "_tlv_atexit", llvmModule);
+			}
+			return "_tlv_atexit";
+		}
+		case InternalDependency::mmap: {
+			if (not llvmModule->getFunction("mmap")) {
+				llvm::Type* voidPtrTy = llvm::Type::getInt8Ty(llCtx)->getPointerTo();
+				llvm::Type* i32Ty     = llvm::Type::getInt32Ty(llCtx);
+				llvm::Type* i64Ty     = llvm::Type::getInt64Ty(llCtx);
+				llvm::Function::Create(
+				    llvm::FunctionType::get(voidPtrTy, {voidPtrTy, i64Ty, i32Ty, i32Ty, i32Ty, i64Ty}, false),
+				    llvm::GlobalValue::LinkageTypes::ExternalLinkage, "mmap", llvmModule);
+			}
+			return "mmap";
+		}
+		case InternalDependency::munmap: {
+			if (not llvmModule->getFunction("munmap")) {
+				llvm::Function::Create(
+				    llvm::FunctionType::get(llvm::Type::getInt32Ty(llCtx),
+				                            {llvm::Type::getInt8Ty(llCtx)->getPointerTo(), llvm::Type::getInt64Ty(llCtx)},
+				                            false),
+				    llvm::GlobalValue::LinkageTypes::ExternalLinkage, "munmap", llvmModule);
+			}
+			return "munmap";
+		}
+		case InternalDependency::madvise: {
+			if (not llvmModule->getFunction("madvise")) {
+				llvm::Function::Create(
+				    llvm::FunctionType::get(llvm::Type::getInt32Ty(llCtx),
+				                            {llvm::Type::getInt8Ty(llCtx)->getPointerTo(), llvm::Type::getInt64Ty(llCtx),
+				                             llvm::Type::getInt32Ty(llCtx)},
+				                            false),
+				    llvm::GlobalValue::LinkageTypes::ExternalLinkage, "madvise", llvmModule);
+			}
+			return "madvise";
+		}
+		case InternalDependency::dprintf: {
+			if (not llvmModule->getFunction("dprintf")) {
+				llvm::Function::Create(
+				    llvm::FunctionType::get(llvm::Type::getInt32Ty(llCtx),
+				                            {llvm::Type::getInt32Ty(llCtx), llvm::Type::getInt8Ty(llCtx)->getPointerTo()},
+				                            true),
+				    llvm::GlobalValue::LinkageTypes::ExternalLinkage, "dprintf", llvmModule);
+			}
+			return "dprintf";
+		}
+		case InternalDependency::memcmp: {
+			if (not llvmModule->getFunction("memcmp")) {
+				llvm::Function::Create(llvm::FunctionType::get(llvm::Type::getInt32Ty(llCtx),
+				                                               {llvm::Type::getInt8Ty(llCtx)->getPointerTo(),
+				                                                llvm::Type::getInt8Ty(llCtx)->getPointerTo(),
+				                                                llvm::Type::getInt64Ty(llCtx)},
+				                                               false),
+				                       llvm::GlobalValue::LinkageTypes::ExternalLinkage, "memcmp", llvmModule);
+			}
+			return "memcmp";
+		}
+		case InternalDependency::write: {
+			if (not llvmModule->getFunction("write")) {
+				llvm::Function::Create(llvm::FunctionType::get(llvm::Type::getInt64Ty(llCtx),
+				                                               {llvm::Type::getInt32Ty(llCtx),
+				                                                llvm::Type::getInt8Ty(llCtx)->getPointerTo(),
+				                                                llvm::Type::getInt64Ty(llCtx)},
+				                                               false),
+				                       llvm::GlobalValue::LinkageTypes::ExternalLinkage, "write", llvmModule);
+			}
+			return "write";
+		}
+		case InternalDependency::isatty: {
+			if (not llvmModule->getFunction("isatty")) {
+				llvm::Function::Create(llvm::FunctionType::get(llvm::Type::getInt32Ty(llCtx),
+				                                               {llvm::Type::getInt32Ty(llCtx)}, false),
+				                       llvm::GlobalValue::LinkageTypes::ExternalLinkage, "isatty", llvmModule);
+			}
+			return "isatty";
+		}
+		case InternalDependency::atExit: {
+			if (not llvmModule->getFunction("atexit")) {
+				llvm::Function::Create(llvm::FunctionType::get(llvm::Type::getInt32Ty(llCtx),
+				                                               {llvm::Type::getInt8Ty(llCtx)->getPointerTo()}, false),
+				                       llvm::GlobalValue::LinkageTypes::ExternalLinkage, "atexit", llvmModule);
+			}
+			return "atexit";
+		}
+		case InternalDependency::poolAllocate:
+		case InternalDependency::poolReallocate:
+		case InternalDependency::poolFree: {
+			PoolAllocator::define(this, irCtx, rangeVal);
+			return internal_dependency_to_string(nval);
+		}
+		case InternalDependency::sayText:
+		case InternalDependency::sayCString:
+		case InternalDependency::saySigned:
+		case InternalDependency::sayUnsigned:
+		case InternalDependency::sayFloat:
+		case InternalDependency::sayPointer:
+		case InternalDependency::sayLineEnd:
+		case InternalDependency::sayFlush:
+		case InternalDependency::sayFlushAll: {
+			SayRuntime::define(this, irCtx, rangeVal);
+			return internal_dependency_to_string(nval);
+		}
+		case InternalDependency::unsignedToText:
+		case InternalDependency::signedToText:
+		case InternalDependency::f64ToText:
+		case InternalDependency::f32ToText:
+		case InternalDependency::f16ToText:
+		case InternalDependency::bf16ToText: {
+			NumberText::define(this, irCtx, rangeVal);
+			return internal_dependency_to_string(nval);
+		}
 		case InternalDependency::exitProgram: {
 			if (not llvmModule->getFunction("exit")) {
 				llvm::Function::Create(llvm::FunctionType::get(llvm::Type::getVoidTy(llCtx),
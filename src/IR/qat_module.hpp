@@ -62,6 +62,34 @@ enum class InternalDependency {
 	pthreadExit,
 	pthreadAttrInit,
 	windowsExitThread,
+	cxaThreadAtExit,
+	darwinThreadAtExit,
+	mmap,
+	munmap,
+	madvise,
+	dprintf,
+	memcmp,
+	write,
+	isatty,
+	atExit,
+	poolAllocate,
+	poolReallocate,
+	poolFree,
+	sayText,
+	sayCString,
+	saySigned,
+	sayUnsigned,
+	sayFloat,
+	sayPointer,
+	sayLineEnd,
+	sayFlush,
+	sayFlushAll,
+	unsignedToText,
+	signedToText,
+	f64ToText,
+	f32ToText,
+	f16ToText,
+	bf16ToText,
 	exitProgram,
 	panicHandler,
 };
@@ -86,6 +114,62 @@ useit inline String internal_dependency_to_string(InternalDependency unit) {
 			return "pthread_attr_init";
 		case InternalDependency::windowsExitThread:
 			return "__imp_ExitThread";
+		case InternalDependency::cxaThreadAtExit:
+			return "__cxa_thread_atexit_impl";
+		case InternalDependency::darwinThreadAtExit:
+			return "_tlv_atexit";
+		case InternalDependency::mmap:
+			return "mmap";
+		case InternalDependency::munmap:
+			return "munmap";
+		case InternalDependency::madvise:
+			return "madvise";
+		case InternalDependency::dprintf:
+			return "dprintf";
+		case InternalDependency::memcmp:
+			return "memcmp";
+		case InternalDependency::write:
+			return "write";
+		case InternalDependency::isatty:
+			return "isatty";
+		case InternalDependency::atExit:
+			return "atexit";
+		case InternalDependency::poolAllocate:
+			return "qat_pool_allocate";
+		case InternalDependency::poolReallocate:
+			return "qat_pool_reallocate";
+		case InternalDependency::poolFree:
+			return "qat_pool_free";
+		case InternalDependency::sayText:
+			return "qat_say_text";
+		case InternalDependency::sayCString:
+			return "qat_say_cstring";
+		case InternalDependency::saySigned:
+			return "qat_say_signed";
+		case InternalDependency::sayUnsigned:
+			return "qat_say_unsigned";
+		case InternalDependency::sayFloat:
+			return "qat_say_float";
+		case InternalDependency::sayPointer:
+			return "qat_say_pointer";
+		case InternalDependency::sayLineEnd:
+			return "qat_say_line_end";
+		case InternalDependency::sayFlush:
+			return "qat_say_flush";
+		case InternalDependency::sayFlushAll:
+			return "qat_say_flush_all";
+		case InternalDependency::unsignedToText:
+			return "qat_unsigned_to_text";
+		case InternalDependency::signedToText:
+			return "qat_signed_to_text";
+		case InternalDependency::f64ToText:
+			return "qat_f64_to_text";
+		case InternalDependency::f32ToText:
+			return "qat_f32_to_text";
+		case InternalDependency::f16ToText:
+			return "qat_f16_to_text";
+		case InternalDependency::bf16ToText:
+			return "qat_bf16_to_text";
 		case InternalDependency::exitProgram:
 			return "exit";
 		case InternalDependency::panicHandler:
@@ -93,6 +177,33 @@ useit inline String internal_dependency_to_string(InternalDependency unit) {
 	}
 }
 
+/// Whether the dependency is generated by the compiler in terms of other dependencies, instead of being linked
+useit inline bool internal_dependency_is_generated(InternalDependency unit) {
+	switch (unit) {
+		case InternalDependency::poolAllocate:
+		case InternalDependency::poolReallocate:
+		case InternalDependency::poolFree:
+		case InternalDependency::sayText:
+		case InternalDependency::sayCString:
+		case InternalDependency::saySigned:
+		case InternalDependency::sayUnsigned:
+		case InternalDependency::sayFloat:
+		case InternalDependency::sayPointer:
+		case InternalDependency::sayLineEnd:
+		case InternalDependency::sayFlush:
+		case InternalDependency::sayFlushAll:
+		case InternalDependency::unsignedToText:
+		case InternalDependency::signedToText:
+		case InternalDependency::f64ToText:
+		case InternalDependency::f32ToText:
+		case InternalDependency::f16ToText:
+		case InternalDependency::bf16ToText:
+			return true;
+		default:
+			return false;
+	}
+}
+
 useit inline Maybe<InternalDependency> internal_dependency_from_string(String value) {
 	if (value == "printf") {
 		return InternalDependency::printf;
@@ -112,6 +223,62 @@ useit inline Maybe<InternalDependency> internal_dependency_from_string(String va
 		return InternalDependency::pthreadAttrInit;
 	} else if (value == "__imp_ExitThread") {
 		return InternalDependency::windowsExitThread;
+	} else if (value == "__cxa_thread_atexit_impl") {
+		return InternalDependency::cxaThreadAtExit;
+	} else if (value == "_tlv_atexit") {
+		return InternalDependency::darwinThreadAtExit;
+	} else if (value == "mmap") {
+		return InternalDependency::mmap;
+	} else if (value == "munmap") {
+		return InternalDependency::munmap;
+	} else if (value == "madvise") {
+		return InternalDependency::madvise;
+	} else if (value == "dprintf") {
+		return InternalDependency::dprintf;
+	} else if (value == "memcmp") {
+		return InternalDependency::memcmp;
+	} else if (value == "write") {
+		return InternalDependency::write;
+	} else if (value == "isatty") {
+		return InternalDependency::isatty;
+	} else if (value == "atexit") {
+		return InternalDependency::atExit;
+	} else if (value == "qat_pool_allocate") {
+		return InternalDependency::poolAllocate;
+	} else if (value == "qat_pool_reallocate") {
+		return InternalDependency::poolReallocate;
+	} else if (value == "qat_pool_free") {
+		return InternalDependency::poolFree;
+	} else if (value == "qat_say_text") {
+		return InternalDependency::sayText;
+	} else if (value == "qat_say_cstring") {
+		return InternalDependency::sayCString;
+	} else if (value == "qat_say_signed") {
+		return InternalDependency::saySigned;
+	} else if (value == "qat_say_unsigned") {
+		return InternalDependency::sayUnsigned;
+	} else if (value == "qat_say_float") {
+		return InternalDependency::sayFloat;
+	} else if (value == "qat_say_pointer") {
+		return InternalDependency::sayPointer;
+	} else if (value == "qat_say_line_end") {
+		return InternalDependency::sayLineEnd;
+	} else if (value == "qat_say_flush") {
+		return InternalDependency::sayFlush;
+	} else if (value == "qat_say_flush_all") {
+		return InternalDependency::sayFlushAll;
+	} else if (value == "qat_unsigned_to_text") {
+		return InternalDependency::unsignedToText;
+	} else if (value == "qat_signed_to_text") {
+		return InternalDependency::signedToText;
+	} else if (value == "qat_f64_to_text") {
+		return InternalDependency::f64ToText;
+	} else if (value == "qat_f32_to_text") {
+		return InternalDependency::f32ToText;
+	} else if (value == "qat_f16_to_text") {
+		return InternalDependency::f16ToText;
+	} else if (value == "qat_bf16_to_text") {
+		return InternalDependency::bf16ToText;
 	} else if (value == "exit") {
 		return InternalDependency::exitProgram;
 	} else if (value == "panicHandler") {
@@ -182,30 +349,31 @@ class LibToLink {
 					return name.value().value == other.name.value().value;
 				}
 				case LibToLinkType::libPath: {
-					return fs::absolute(fs::path(path->first).is_relative() ? (fileRange.file / path->first)
+					return fs::absolute(fs::path(path->first).is_relative() ? (fileRange.get_path() / path->first)
 					                                                        : fs::path(path->first)) ==
-					       fs::absolute(fs::path(other.path->first).is_relative() ? (fileRange.file / other.path->first)
-					                                                              : fs::path(other.path->first));
+					       fs::absolute(fs::path(other.path->first).is_relative()
+					                        ? (fileRange.get_path() / other.path->first)
+					                        : fs::path(other.path->first));
 				}
 				case LibToLinkType::staticAndSharedPaths: {
-					return (fs::absolute(fs::path(path->first).is_relative() ? (fileRange.file / path->first)
+					return (fs::absolute(fs::path(path->first).is_relative() ? (fileRange.get_path() / path->first)
 					                                                         : fs::path(path->first)) ==
 					        fs::absolute(fs::path(other.path->first).is_relative()
-					                         ? (fileRange.file / other.path->first)
+					                         ? (fileRange.get_path() / other.path->first)
 					                         : fs::path(other.path->first))) &&
 					       (fs::absolute(fs::path(sharedPath->first).is_relative()
-					                         ? (fileRange.file / sharedPath->first)
+					                         ? (fileRange.get_path() / sharedPath->first)
 					                         : fs::path(sharedPath->first)) ==
 					        fs::absolute(fs::path(other.sharedPath->first).is_relative()
-					                         ? (fileRange.file / other.sharedPath->first)
+					                         ? (fileRange.get_path() / other.sharedPath->first)
 					                         : fs::path(other.sharedPath->first)));
 				}
 				case LibToLinkType::nameWithLookupPath: {
 					return (name.value().value == other.name.value().value) &&
-					       (fs::absolute(fs::path(path->first).is_relative() ? (fileRange.file / path->first)
+					       (fs::absolute(fs::path(path->first).is_relative() ? (fileRange.get_path() / path->first)
 					                                                         : fs::path(path->first)) ==
 					        fs::absolute(fs::path(other.path->first).is_relative()
-					                         ? (fileRange.file / other.path->first)
+					                         ? (fileRange.get_path() / other.path->first)
 					                         : fs::path(other.path->first)));
 				}
 			}
@@ -417,6 +585,15 @@ class GenericStructType;
 class Skill;
 struct ModTypeInfo;
 
+/// A global whose value is computed by the module initialiser. The linkage is what the global gets if its value can be
+/// computed at compile time instead
+struct RuntimeGlobal {
+	Identifier                      name;
+	llvm::GlobalVariable*           global;
+	llvm::GlobalValue::LinkageTypes linkage;
+	bool                            isVariable;
+};
+
 class Mod final : public Uniq, public EntityOverview {
 	friend class Region;
 	friend class OpaqueType;
@@ -536,9 +713,12 @@ class Mod final : public Uniq, public EntityOverview {
 
 	Vec<EntityState*> entityEntries;
 
-	Function* moduleInitialiser   = nullptr;
-	Function* moduleDeinitialiser = nullptr;
-	u64       nonConstantGlobals  = 0;
+	Function*          moduleInitialiser   = nullptr;
+	Function*          moduleDeinitialiser = nullptr;
+	u64                nonConstantGlobals  = 0;
+	Vec<RuntimeGlobal> runtimeGlobals;
+
+	static u64 foldedGlobalCount;
 
 	std::set<u64> integerBitwidths;
 	std::set<u64> unsignedBitwidths;
@@ -555,7 +735,8 @@ class Mod final : public Uniq, public EntityOverview {
 	mutable llvm::Module*              llvmModule;
 	mutable Vec<llvm::GlobalVariable*> otherGlobals;
 
-	mutable Maybe<String> moduleForeignID;
+	mutable Maybe<String>    moduleForeignID;
+	mutable Maybe<LinkNames> linkNames;
 
 	mutable bool linkPthread                  = false;
 	mutable bool hasCreatedModules            = false;
@@ -599,6 +780,11 @@ class Mod final : public Uniq, public EntityOverview {
 
 	static Vec<Function*> collect_mod_initialisers();
 
+	useit static u64 get_folded_global_count() { return foldedGlobalCount; }
+
+	/// The names and locations of the globals that are still initialised when the program starts
+	useit static Vec<Pair<String, FileRange>> get_runtime_globals();
+
 	useit bool has_entity_with_name(String const& name) {
 		for (auto ent : entityEntries) {
 			if (ent->name.has_value() && ent->name->value == name) {
@@ -669,9 +855,10 @@ class Mod final : public Uniq, public EntityOverview {
 
 	useit Function* get_mod_initialiser(ir::Ctx* irCtx);
 	useit bool      should_call_initialiser() const;
-	void            add_non_const_global_counter();
+	void            add_runtime_global(RuntimeGlobal runtimeGlobal);
 
 	useit LinkNames get_link_names() const;
+	void            reset_link_names() const;
 
 	useit bool is_parent_mod_of(Mod* other) const;
 	useit bool has_parent_lib() const;
@@ -684,6 +871,14 @@ class Mod final : public Uniq, public EntityOverview {
 	useit Maybe<ir::PrerunValue*> get_meta_info_from_parent(String key) const;
 	useit Maybe<String> get_relevant_foreign_id() const;
 
+	/// The dependency that allocates, reallocates or frees heap memory, for the provided dependency of the C runtime.
+	/// This is the pool allocator if `--heap-allocator=pool` is provided
+	useit static InternalDependency heap_dependency(InternalDependency systemDependency);
+
+	/// The dependency that registers a function to be called when the current thread exits, if the C runtime of the
+	/// target provides one
+	useit static Maybe<InternalDependency> thread_exit_dependency(ir::Ctx* irCtx);
+
 	useit bool has_nth_parent(u32 n) const;
 	useit Mod* get_nth_parent(u32 n);
 
@@ -905,6 +1100,8 @@ class Mod final : public Uniq, public EntityOverview {
 	void node_create_entities(Ctx* irCtx);
 	void node_update_dependencies(Ctx* irCtx);
 
+	void finalise_initialiser(Ctx* irCtx);
+	void fold_initialiser(Ctx* irCtx);
 	void setup_llvm_file(Ctx* irCtx);
 	void compile_to_object(Ctx* irCtx);
 	void handle_native_libs(Ctx* irCtx);
@@ -0,0 +1,472 @@
+#include "./say_runtime.hpp"
+#include "../cli/config.hpp"
+#include "../show.hpp"
+#include "./context.hpp"
+#include "./number_text.hpp"
+#include "./qat_module.hpp"
+
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/MDBuilder.h>
+
+namespace qat::ir {
+
+bool SayRuntime::is_supported(Ctx* irCtx) {
+	// FIXME - Support targets without a way to flush the buffer of a thread when it exits, like Windows and musl
+	return not cli::Config::get()->is_freestanding() && Mod::thread_exit_dependency(irCtx).has_value();
+}
+
+void SayRuntime::define(Mod* mod, Ctx* irCtx, FileRange const& fileRange) {
+	auto* llvmModule = mod->get_llvm_module();
+	if (llvmModule->getFunction(internal_dependency_to_string(InternalDependency::sayText))) {
+		return;
+	}
+	SHOW("Defining the say runtime in module " << mod->get_full_name())
+	auto& llCtx         = irCtx->llctx;
+	auto* Ty8Int        = llvm::Type::getInt8Ty(llCtx);
+	auto* Ty32Int       = llvm::Type::getInt32Ty(llCtx);
+	auto* Ty64Int       = llvm::Type::getInt64Ty(llCtx);
+	auto* doubleTy      = llvm::Type::getDoubleTy(llCtx);
+	auto* voidTy        = llvm::Type::getVoidTy(llCtx);
+	auto  addressSpace  = irCtx->dataLayout.getProgramAddressSpace();
+	auto* i8PtrTy       = Ty8Int->getPointerTo(addressSpace);
+	auto  writeName     = mod->link_internal_dependency(InternalDependency::write, irCtx, fileRange);
+	auto* writeFn       = llvmModule->getFunction(writeName);
+	auto  isattyName    = mod->link_internal_dependency(InternalDependency::isatty, irCtx, fileRange);
+	auto* isattyFn      = llvmModule->getFunction(isattyName);
+	auto  atExitDep     = Mod::thread_exit_dependency(irCtx).value();
+	auto  atExitName    = mod->link_internal_dependency(atExitDep, irCtx, fileRange);
+	auto* atExitFn      = llvmModule->getFunction(atExitName);
+	auto  processExName = mod->link_internal_dependency(InternalDependency::atExit, irCtx, fileRange);
+	auto* processExitFn = llvmModule->getFunction(processExName);
+	// The state of the buffer of a thread. The states of all live threads are linked, so that every buffer can be
+	// flushed when the program exits. The lock is only contended while the buffer of the thread is being flushed by
+	// another thread
+	auto* stateType = llvm::StructType::get(
+	    llCtx, {i8PtrTy, i8PtrTy, Ty64Int, Ty8Int, Ty8Int, llvm::ArrayType::get(Ty8Int, bufferSize)});
+
+	auto newGlobal = [&](llvm::Type* type, String const& name) {
+		return new llvm::GlobalVariable(*llvmModule, type, false, llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+		                                llvm::Constant::getNullValue(type), name);
+	};
+	auto newFunction = [&](llvm::Type* resultType, Vec<llvm::Type*> const& params, InternalDependency dep) {
+		return llvm::Function::Create(llvm::FunctionType::get(resultType, params, false),
+		                              llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+		                              internal_dependency_to_string(dep), llvmModule);
+	};
+	auto newHelper = [&](Vec<llvm::Type*> const& params, String const& name) {
+		return llvm::Function::Create(llvm::FunctionType::get(voidTy, params, false),
+		                              llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage, name, llvmModule);
+	};
+	auto* state = newGlobal(stateType, "qat_say_state");
+	state->setThreadLocalMode(llvm::GlobalValue::GeneralDynamicTLSModel);
+	auto* states         = newGlobal(i8PtrTy, "qat_say_states");
+	auto* statesLock     = newGlobal(Ty8Int, "qat_say_states_lock");
+	auto* exitRegistered = newGlobal(Ty8Int, "qat_say_exit_registered");
+	auto* writeAllFn     = newHelper({i8PtrTy, Ty64Int}, "qat_say_write_all");
+	auto* flushStateFn   = newHelper({i8PtrTy}, "qat_say_flush_state");
+	auto* threadExitFn   = newHelper({i8PtrTy}, "qat_say_thread_exit");
+	auto* flushFn        = newFunction(voidTy, {i8PtrTy}, InternalDependency::sayFlush);
+	auto* flushAllFn     = newFunction(voidTy, {}, InternalDependency::sayFlushAll);
+	auto* textFn         = newFunction(voidTy, {i8PtrTy, Ty64Int}, InternalDependency::sayText);
+	auto* cstringFn      = newFunction(voidTy, {i8PtrTy}, InternalDependency::sayCString);
+	auto* unsignedFn     = newFunction(voidTy, {Ty64Int}, InternalDependency::sayUnsigned);
+	auto* signedFn       = newFunction(voidTy, {Ty64Int}, InternalDependency::saySigned);
+	auto* floatFn        = newFunction(voidTy, {doubleTy, Ty8Int}, InternalDependency::sayFloat);
+	auto* pointerFn      = newFunction(voidTy, {i8PtrTy}, InternalDependency::sayPointer);
+	auto* lineEndFn      = newFunction(voidTy, {}, InternalDependency::sayLineEnd);
+	auto* nullPtr        = llvm::ConstantPointerNull::get(i8PtrTy);
+	auto* stdoutFd       = llvm::ConstantInt::get(Ty32Int, 1u);
+	// The runtime is defined when it is first used, which is in the middle of the body of some other function
+	auto savedIP   = irCtx->builder.saveIP();
+	auto writeText = [&](String const& value) {
+		irCtx->builder.CreateCall(textFn->getFunctionType(), textFn,
+		                          {irCtx->get_text_constant(value, llvmModule),
+		                           llvm::ConstantInt::get(Ty64Int, value.size())});
+	};
+	auto digitChar = [&](llvm::Value* digit) {
+		return irCtx->builder.CreateAdd(irCtx->builder.CreateTrunc(digit, Ty8Int), llvm::ConstantInt::get(Ty8Int, '0'));
+	};
+	auto stateField = [&](llvm::Value* stateVal, StateField field) {
+		return irCtx->builder.CreateStructGEP(stateType, stateVal, (u32)field);
+	};
+	auto acquire = [&](llvm::Function* function, llvm::Value* lock) {
+		auto* spinBlock   = llvm::BasicBlock::Create(llCtx, "spin", function);
+		auto* lockedBlock = llvm::BasicBlock::Create(llCtx, "locked", function);
+		irCtx->builder.CreateBr(spinBlock);
+		irCtx->builder.SetInsertPoint(spinBlock);
+		auto* previous =
+		    irCtx->builder.CreateAtomicRMW(llvm::AtomicRMWInst::Xchg, lock, llvm::ConstantInt::get(Ty8Int, 1u),
+		                                   llvm::MaybeAlign(), llvm::AtomicOrdering::Acquire);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(previous), lockedBlock, spinBlock);
+		irCtx->builder.SetInsertPoint(lockedBlock);
+	};
+	auto release = [&](llvm::Value* lock) {
+		irCtx->builder.CreateStore(llvm::ConstantInt::get(Ty8Int, 0u), lock)
+		    ->setAtomic(llvm::AtomicOrdering::Release);
+	};
+	{
+		SHOW("Creating the write function of the say runtime")
+		auto* data      = writeAllFn->getArg(0u);
+		auto* count     = writeAllFn->getArg(1u);
+		auto* entry     = llvm::BasicBlock::Create(llCtx, "entry", writeAllFn);
+		auto* condBlock = llvm::BasicBlock::Create(llCtx, "cond", writeAllFn);
+		auto* bodyBlock = llvm::BasicBlock::Create(llCtx, "body", writeAllFn);
+		auto* nextBlock = llvm::BasicBlock::Create(llCtx, "next", writeAllFn);
+		auto* doneBlock = llvm::BasicBlock::Create(llCtx, "done", writeAllFn);
+		irCtx->builder.SetInsertPoint(entry);
+		irCtx->builder.CreateBr(condBlock);
+		irCtx->builder.SetInsertPoint(condBlock);
+		auto* written = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		written->addIncoming(llvm::ConstantInt::get(Ty64Int, 0u), entry);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpULT(written, count), bodyBlock, doneBlock);
+		irCtx->builder.SetInsertPoint(bodyBlock);
+		auto* result = irCtx->builder.CreateCall(
+		    writeFn->getFunctionType(), writeFn,
+		    {stdoutFd, irCtx->builder.CreateInBoundsGEP(Ty8Int, data, {written}),
+		     irCtx->builder.CreateSub(count, written)});
+		// Like printf, the output is dropped if the standard output cannot be written to
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpSGT(result, llvm::ConstantInt::get(Ty64Int, 0u)),
+		                            nextBlock, doneBlock);
+		irCtx->builder.SetInsertPoint(nextBlock);
+		written->addIncoming(irCtx->builder.CreateAdd(written, result), nextBlock);
+		irCtx->builder.CreateBr(condBlock);
+		irCtx->builder.SetInsertPoint(doneBlock);
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the function that flushes the buffer of a state")
+		// The caller holds the lock of the state
+		auto* stateVal   = flushStateFn->getArg(0u);
+		auto* entry      = llvm::BasicBlock::Create(llCtx, "entry", flushStateFn);
+		auto* writeBlock = llvm::BasicBlock::Create(llCtx, "write", flushStateFn);
+		auto* doneBlock  = llvm::BasicBlock::Create(llCtx, "done", flushStateFn);
+		irCtx->builder.SetInsertPoint(entry);
+		auto* lengthPtr = stateField(stateVal, StateField::length);
+		auto* length    = irCtx->builder.CreateLoad(Ty64Int, lengthPtr);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(length), doneBlock, writeBlock);
+		irCtx->builder.SetInsertPoint(writeBlock);
+		irCtx->builder.CreateCall(writeAllFn->getFunctionType(), writeAllFn,
+		                          {stateField(stateVal, StateField::data), length});
+		irCtx->builder.CreateStore(llvm::ConstantInt::get(Ty64Int, 0u), lengthPtr);
+		irCtx->builder.CreateBr(doneBlock);
+		irCtx->builder.SetInsertPoint(doneBlock);
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the flush function of the say runtime")
+		irCtx->builder.SetInsertPoint(llvm::BasicBlock::Create(llCtx, "entry", flushFn));
+		acquire(flushFn, stateField(state, StateField::lock));
+		irCtx->builder.CreateCall(flushStateFn->getFunctionType(), flushStateFn, {state});
+		release(stateField(state, StateField::lock));
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the function that flushes the buffers of all threads")
+		auto* loopBlock  = llvm::BasicBlock::Create(llCtx, "loop", flushAllFn);
+		auto* flushBlock = llvm::BasicBlock::Create(llCtx, "flush", flushAllFn);
+		auto* doneBlock  = llvm::BasicBlock::Create(llCtx, "done", flushAllFn);
+		irCtx->builder.SetInsertPoint(llvm::BasicBlock::Create(llCtx, "entry", flushAllFn));
+		acquire(flushAllFn, statesLock);
+		auto* headBlock = irCtx->builder.GetInsertBlock();
+		auto* head      = irCtx->builder.CreateLoad(i8PtrTy, states);
+		irCtx->builder.CreateBr(loopBlock);
+		irCtx->builder.SetInsertPoint(loopBlock);
+		auto* current = irCtx->builder.CreatePHI(i8PtrTy, 2u);
+		current->addIncoming(head, headBlock);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(current), doneBlock, flushBlock);
+		irCtx->builder.SetInsertPoint(flushBlock);
+		acquire(flushAllFn, stateField(current, StateField::lock));
+		irCtx->builder.CreateCall(flushStateFn->getFunctionType(), flushStateFn, {current});
+		release(stateField(current, StateField::lock));
+		current->addIncoming(irCtx->builder.CreateLoad(i8PtrTy, stateField(current, StateField::next)),
+		                     irCtx->builder.GetInsertBlock());
+		irCtx->builder.CreateBr(loopBlock);
+		irCtx->builder.SetInsertPoint(doneBlock);
+		release(statesLock);
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the thread exit callback of the say runtime")
+		// The state is unlinked before the thread local storage of the thread is freed. A say in a later destructor
+		// of the thread sets the state up again
+		auto* firstBlock    = llvm::BasicBlock::Create(llCtx, "first", threadExitFn);
+		auto* middleBlock   = llvm::BasicBlock::Create(llCtx, "middle", threadExitFn);
+		auto* nextBlock     = llvm::BasicBlock::Create(llCtx, "next", threadExitFn);
+		auto* hasNextBlock  = llvm::BasicBlock::Create(llCtx, "has.next", threadExitFn);
+		auto* unlinkedBlock = llvm::BasicBlock::Create(llCtx, "unlinked", threadExitFn);
+		irCtx->builder.SetInsertPoint(llvm::BasicBlock::Create(llCtx, "entry", threadExitFn));
+		acquire(threadExitFn, stateField(state, StateField::lock));
+		irCtx->builder.CreateCall(flushStateFn->getFunctionType(), flushStateFn, {state});
+		release(stateField(state, StateField::lock));
+		irCtx->builder.CreateStore(llvm::ConstantInt::get(Ty8Int, modeUnknown), stateField(state, StateField::mode));
+		acquire(threadExitFn, statesLock);
+		auto* next     = irCtx->builder.CreateLoad(i8PtrTy, stateField(state, StateField::next));
+		auto* previous = irCtx->builder.CreateLoad(i8PtrTy, stateField(state, StateField::previous));
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(previous), firstBlock, middleBlock);
+		irCtx->builder.SetInsertPoint(firstBlock);
+		irCtx->builder.CreateStore(next, states);
+		irCtx->builder.CreateBr(nextBlock);
+		irCtx->builder.SetInsertPoint(middleBlock);
+		irCtx->builder.CreateStore(next, stateField(previous, StateField::next));
+		irCtx->builder.CreateBr(nextBlock);
+		irCtx->builder.SetInsertPoint(nextBlock);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(next), unlinkedBlock, hasNextBlock);
+		irCtx->builder.SetInsertPoint(hasNextBlock);
+		irCtx->builder.CreateStore(previous, stateField(next, StateField::previous));
+		irCtx->builder.CreateBr(unlinkedBlock);
+		irCtx->builder.SetInsertPoint(unlinkedBlock);
+		release(statesLock);
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the text writer of the say runtime")
+		auto* data          = textFn->getArg(0u);
+		auto* count         = textFn->getArg(1u);
+		auto* entry         = llvm::BasicBlock::Create(llCtx, "entry", textFn);
+		auto* setupBlock    = llvm::BasicBlock::Create(llCtx, "setup", textFn);
+		auto* linkNextBlock = llvm::BasicBlock::Create(llCtx, "link.next", textFn);
+		auto* linkedBlock   = llvm::BasicBlock::Create(llCtx, "linked", textFn);
+		auto* registerBlock = llvm::BasicBlock::Create(llCtx, "register", textFn);
+		auto* readyBlock    = llvm::BasicBlock::Create(llCtx, "ready", textFn);
+		auto* spillBlock    = llvm::BasicBlock::Create(llCtx, "spill", textFn);
+		auto* directBlock   = llvm::BasicBlock::Create(llCtx, "direct", textFn);
+		auto* appendBlock   = llvm::BasicBlock::Create(llCtx, "append", textFn);
+		irCtx->builder.SetInsertPoint(entry);
+		auto* modePtr = stateField(state, StateField::mode);
+		auto* mode    = irCtx->builder.CreateLoad(Ty8Int, modePtr);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpEQ(mode, llvm::ConstantInt::get(Ty8Int, modeUnknown)),
+		                            setupBlock, readyBlock, llvm::MDBuilder(llCtx).createBranchWeights(1u, 2000u));
+		// The first write of every thread decides how its buffer is flushed, and makes sure that it is flushed when the
+		// thread exits. Lines are flushed as they end only if the output is a terminal, like the buffering of stdout
+		irCtx->builder.SetInsertPoint(setupBlock);
+		auto* isTerminal = irCtx->builder.CreateCall(isattyFn->getFunctionType(), isattyFn, {stdoutFd});
+		irCtx->builder.CreateStore(irCtx->builder.CreateSelect(irCtx->builder.CreateIsNull(isTerminal),
+		                                                       llvm::ConstantInt::get(Ty8Int, modeBuffered),
+		                                                       llvm::ConstantInt::get(Ty8Int, modeLine)),
+		                           modePtr);
+		Vec<llvm::Value*> atExitArgs{threadExitFn, nullPtr};
+		// The last argument of __cxa_thread_atexit_impl is the handle of the shared object, which can be null
+		if (atExitDep == InternalDependency::cxaThreadAtExit) {
+			atExitArgs.push_back(nullPtr);
+		}
+		irCtx->builder.CreateCall(atExitFn->getFunctionType(), atExitFn, atExitArgs);
+		acquire(textFn, statesLock);
+		auto* head = irCtx->builder.CreateLoad(i8PtrTy, states);
+		irCtx->builder.CreateStore(head, stateField(state, StateField::next));
+		irCtx->builder.CreateStore(nullPtr, stateField(state, StateField::previous));
+		irCtx->builder.CreateStore(state, states);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(head), linkedBlock, linkNextBlock);
+		irCtx->builder.SetInsertPoint(linkNextBlock);
+		irCtx->builder.CreateStore(state, stateField(head, StateField::previous));
+		irCtx->builder.CreateBr(linkedBlock);
+		// Buffers of threads that are still running when the program exits are flushed by a handler that is
+		// registered by the first thread to write
+		irCtx->builder.SetInsertPoint(linkedBlock);
+		release(statesLock);
+		auto* isFirst = irCtx->builder.CreateExtractValue(
+		    irCtx->builder.CreateAtomicCmpXchg(exitRegistered, llvm::ConstantInt::get(Ty8Int, 0u),
+		                                       llvm::ConstantInt::get(Ty8Int, 1u), llvm::MaybeAlign(),
+		                                       llvm::AtomicOrdering::Monotonic, llvm::AtomicOrdering::Monotonic),
+		    {1u});
+		irCtx->builder.CreateCondBr(isFirst, registerBlock, readyBlock);
+		irCtx->builder.SetInsertPoint(registerBlock);
+		irCtx->builder.CreateCall(processExitFn->getFunctionType(), processExitFn, {flushAllFn});
+		irCtx->builder.CreateBr(readyBlock);
+		irCtx->builder.SetInsertPoint(readyBlock);
+		auto* lockPtr = stateField(state, StateField::lock);
+		acquire(textFn, lockPtr);
+		auto* lockedBlock = irCtx->builder.GetInsertBlock();
+		auto* lengthPtr   = stateField(state, StateField::length);
+		auto* length      = irCtx->builder.CreateLoad(Ty64Int, lengthPtr);
+		auto* space       = irCtx->builder.CreateSub(llvm::ConstantInt::get(Ty64Int, bufferSize), length);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpULE(count, space), appendBlock, spillBlock,
+		                            llvm::MDBuilder(llCtx).createBranchWeights(2000u, 1u));
+		irCtx->builder.SetInsertPoint(spillBlock);
+		irCtx->builder.CreateCall(flushStateFn->getFunctionType(), flushStateFn, {state});
+		irCtx->builder.CreateCondBr(
+		    irCtx->builder.CreateICmpUGT(count, llvm::ConstantInt::get(Ty64Int, bufferSize)), directBlock, appendBlock);
+		// Text that is larger than the buffer is written without copying it
+		irCtx->builder.SetInsertPoint(directBlock);
+		irCtx->builder.CreateCall(writeAllFn->getFunctionType(), writeAllFn, {data, count});
+		release(lockPtr);
+		irCtx->builder.CreateRetVoid();
+		irCtx->builder.SetInsertPoint(appendBlock);
+		auto* start = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		start->addIncoming(length, lockedBlock);
+		start->addIncoming(llvm::ConstantInt::get(Ty64Int, 0u), spillBlock);
+		irCtx->builder.CreateMemCpy(
+		    irCtx->builder.CreateInBoundsGEP(Ty8Int, stateField(state, StateField::data), {start}),
+		    llvm::MaybeAlign(1u), data, llvm::MaybeAlign(1u), count);
+		irCtx->builder.CreateStore(irCtx->builder.CreateAdd(start, count), lengthPtr);
+		release(lockPtr);
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the line end function of the say runtime")
+		auto* entry      = llvm::BasicBlock::Create(llCtx, "entry", lineEndFn);
+		auto* flushBlock = llvm::BasicBlock::Create(llCtx, "flush", lineEndFn);
+		auto* doneBlock  = llvm::BasicBlock::Create(llCtx, "done", lineEndFn);
+		irCtx->builder.SetInsertPoint(entry);
+		irCtx->builder.CreateCondBr(
+		    irCtx->builder.CreateICmpEQ(irCtx->builder.CreateLoad(Ty8Int, stateField(state, StateField::mode)),
+		                                llvm::ConstantInt::get(Ty8Int, modeLine)),
+		    flushBlock, doneBlock);
+		irCtx->builder.SetInsertPoint(flushBlock);
+		irCtx->builder.CreateCall(flushFn->getFunctionType(), flushFn, {nullPtr});
+		irCtx->builder.CreateBr(doneBlock);
+		irCtx->builder.SetInsertPoint(doneBlock);
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the unsigned integer writer of the say runtime")
+		auto* entry     = llvm::BasicBlock::Create(llCtx, "entry", unsignedFn);
+		auto* loopBlock = llvm::BasicBlock::Create(llCtx, "loop", unsignedFn);
+		auto* doneBlock = llvm::BasicBlock::Create(llCtx, "done", unsignedFn);
+		irCtx->builder.SetInsertPoint(entry);
+		auto* digitsType = llvm::ArrayType::get(Ty8Int, maxDecimalDigits);
+		auto* digits     = irCtx->builder.CreateAlloca(digitsType);
+		irCtx->builder.CreateBr(loopBlock);
+		// The digits are produced from the least significant one, and are placed from the end of the local buffer
+		irCtx->builder.SetInsertPoint(loopBlock);
+		auto* value    = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		auto* position = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		value->addIncoming(unsignedFn->getArg(0u), entry);
+		position->addIncoming(llvm::ConstantInt::get(Ty64Int, maxDecimalDigits), entry);
+		auto* newPosition = irCtx->builder.CreateSub(position, llvm::ConstantInt::get(Ty64Int, 1u));
+		auto* remaining   = irCtx->builder.CreateUDiv(value, llvm::ConstantInt::get(Ty64Int, 10u));
+		irCtx->builder.CreateStore(
+		    digitChar(irCtx->builder.CreateURem(value, llvm::ConstantInt::get(Ty64Int, 10u))),
+		    irCtx->builder.CreateInBoundsGEP(digitsType, digits, {llvm::ConstantInt::get(Ty64Int, 0u), newPosition}));
+		value->addIncoming(remaining, loopBlock);
+		position->addIncoming(newPosition, loopBlock);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(remaining), doneBlock, loopBlock);
+		irCtx->builder.SetInsertPoint(doneBlock);
+		irCtx->builder.CreateCall(
+		    textFn->getFunctionType(), textFn,
+		    {irCtx->builder.CreateInBoundsGEP(digitsType, digits, {llvm::ConstantInt::get(Ty64Int, 0u), newPosition}),
+		     irCtx->builder.CreateSub(llvm::ConstantInt::get(Ty64Int, maxDecimalDigits), newPosition)});
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the signed integer writer of the say runtime")
+		auto* value         = signedFn->getArg(0u);
+		auto* entry         = llvm::BasicBlock::Create(llCtx, "entry", signedFn);
+		auto* negativeBlock = llvm::BasicBlock::Create(llCtx, "negative", signedFn);
+		auto* positiveBlock = llvm::BasicBlock::Create(llCtx, "positive", signedFn);
+		irCtx->builder.SetInsertPoint(entry);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpSLT(value, llvm::ConstantInt::get(Ty64Int, 0u)),
+		                            negativeBlock, positiveBlock);
+		// The negation is interpreted as unsigned, so that the smallest value is also written correctly
+		irCtx->builder.SetInsertPoint(negativeBlock);
+		writeText("-");
+		irCtx->builder.CreateCall(unsignedFn->getFunctionType(), unsignedFn, {irCtx->builder.CreateNeg(value)});
+		irCtx->builder.CreateRetVoid();
+		irCtx->builder.SetInsertPoint(positiveBlock);
+		irCtx->builder.CreateCall(unsignedFn->getFunctionType(), unsignedFn, {value});
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the pointer writer of the say runtime")
+		auto* entry     = llvm::BasicBlock::Create(llCtx, "entry", pointerFn);
+		auto* loopBlock = llvm::BasicBlock::Create(llCtx, "loop", pointerFn);
+		auto* doneBlock = llvm::BasicBlock::Create(llCtx, "done", pointerFn);
+		irCtx->builder.SetInsertPoint(entry);
+		auto* digitsType = llvm::ArrayType::get(Ty8Int, maxHexDigits);
+		auto* digits     = irCtx->builder.CreateAlloca(digitsType);
+		auto* address    = irCtx->builder.CreatePtrToInt(pointerFn->getArg(0u), Ty64Int);
+		writeText("0x");
+		irCtx->builder.CreateBr(loopBlock);
+		irCtx->builder.SetInsertPoint(loopBlock);
+		auto* value    = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		auto* position = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		value->addIncoming(address, entry);
+		position->addIncoming(llvm::ConstantInt::get(Ty64Int, maxHexDigits), entry);
+		auto* newPosition = irCtx->builder.CreateSub(position, llvm::ConstantInt::get(Ty64Int, 1u));
+		auto* nibble      = irCtx->builder.CreateAnd(value, llvm::ConstantInt::get(Ty64Int, 0xFu));
+		auto* remaining   = irCtx->builder.CreateLShr(value, 4u);
+		irCtx->builder.CreateStore(
+		    irCtx->builder.CreateSelect(
+		        irCtx->builder.CreateICmpULT(nibble, llvm::ConstantInt::get(Ty64Int, 10u)), digitChar(nibble),
+		        irCtx->builder.CreateAdd(irCtx->builder.CreateTrunc(nibble, Ty8Int),
+		                                 llvm::ConstantInt::get(Ty8Int, 'a' - 10))),
+		    irCtx->builder.CreateInBoundsGEP(digitsType, digits, {llvm::ConstantInt::get(Ty64Int, 0u), newPosition}));
+		value->addIncoming(remaining, loopBlock);
+		position->addIncoming(newPosition, loopBlock);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(remaining), doneBlock, loopBlock);
+		irCtx->builder.SetInsertPoint(doneBlock);
+		irCtx->builder.CreateCall(
+		    textFn->getFunctionType(), textFn,
+		    {irCtx->builder.CreateInBoundsGEP(digitsType, digits, {llvm::ConstantInt::get(Ty64Int, 0u), newPosition}),
+		     irCtx->builder.CreateSub(llvm::ConstantInt::get(Ty64Int, maxHexDigits), newPosition)});
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the C string writer of the say runtime")
+		auto* data      = cstringFn->getArg(0u);
+		auto* entry     = llvm::BasicBlock::Create(llCtx, "entry", cstringFn);
+		auto* loopBlock = llvm::BasicBlock::Create(llCtx, "loop", cstringFn);
+		auto* nextBlock = llvm::BasicBlock::Create(llCtx, "next", cstringFn);
+		auto* doneBlock = llvm::BasicBlock::Create(llCtx, "done", cstringFn);
+		auto* nullBlock = llvm::BasicBlock::Create(llCtx, "null", cstringFn);
+		irCtx->builder.SetInsertPoint(entry);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(data), nullBlock, loopBlock);
+		irCtx->builder.SetInsertPoint(loopBlock);
+		auto* index = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		index->addIncoming(llvm::ConstantInt::get(Ty64Int, 0u), entry);
+		auto* charVal = irCtx->builder.CreateLoad(Ty8Int, irCtx->builder.CreateInBoundsGEP(Ty8Int, data, {index}));
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(charVal), doneBlock, nextBlock);
+		irCtx->builder.SetInsertPoint(nextBlock);
+		index->addIncoming(irCtx->builder.CreateAdd(index, llvm::ConstantInt::get(Ty64Int, 1u)), nextBlock);
+		irCtx->builder.CreateBr(loopBlock);
+		irCtx->builder.SetInsertPoint(doneBlock);
+		irCtx->builder.CreateCall(textFn->getFunctionType(), textFn, {data, index});
+		irCtx->builder.CreateRetVoid();
+		irCtx->builder.SetInsertPoint(nullBlock);
+		writeText("(null)");
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the float writer of the say runtime")
+		// The value is widened to a double by the caller, and is narrowed back to its own kind, which is exact. This
+		// writes the same shortest digits as the conversion of the float to text
+		auto* value      = floatFn->getArg(0u);
+		auto* entry      = llvm::BasicBlock::Create(llCtx, "entry", floatFn);
+		auto* f32Block   = llvm::BasicBlock::Create(llCtx, "f32", floatFn);
+		auto* f16Block   = llvm::BasicBlock::Create(llCtx, "f16", floatFn);
+		auto* brainBlock = llvm::BasicBlock::Create(llCtx, "brain", floatFn);
+		auto* f64Block   = llvm::BasicBlock::Create(llCtx, "f64", floatFn);
+		auto* doneBlock  = llvm::BasicBlock::Create(llCtx, "done", floatFn);
+		irCtx->builder.SetInsertPoint(entry);
+		auto* digitsType = llvm::ArrayType::get(Ty8Int, NumberText::maxFloatLength);
+		auto* digitsData = irCtx->builder.CreateAlloca(digitsType);
+		auto* digits     = irCtx->builder.CreateInBoundsGEP(
+		    digitsType, digitsData, {llvm::ConstantInt::get(Ty64Int, 0u), llvm::ConstantInt::get(Ty64Int, 0u)});
+		auto* kindSwitch = irCtx->builder.CreateSwitch(floatFn->getArg(1u), f64Block, 3u);
+		kindSwitch->addCase(llvm::ConstantInt::get(Ty8Int, floatKind32), f32Block);
+		kindSwitch->addCase(llvm::ConstantInt::get(Ty8Int, floatKind16), f16Block);
+		kindSwitch->addCase(llvm::ConstantInt::get(Ty8Int, floatKindBrain), brainBlock);
+		irCtx->builder.SetInsertPoint(doneBlock);
+		auto* length = irCtx->builder.CreatePHI(Ty64Int, 4u);
+		irCtx->builder.CreateCall(textFn->getFunctionType(), textFn, {digits, length});
+		irCtx->builder.CreateRetVoid();
+		auto convert = [&](llvm::BasicBlock* block, InternalDependency converter, llvm::Type* floatType) {
+			auto* converterFn = llvmModule->getFunction(mod->link_internal_dependency(converter, irCtx, fileRange));
+			irCtx->builder.SetInsertPoint(block);
+			auto* narrowed = (floatType == doubleTy) ? value : irCtx->builder.CreateFPTrunc(value, floatType);
+			length->addIncoming(
+			    irCtx->builder.CreateCall(converterFn->getFunctionType(), converterFn, {narrowed, digits}), block);
+			irCtx->builder.CreateBr(doneBlock);
+		};
+		convert(f32Block, InternalDependency::f32ToText, llvm::Type::getFloatTy(llCtx));
+		convert(f16Block, InternalDependency::f16ToText, llvm::Type::getHalfTy(llCtx));
+		convert(brainBlock, InternalDependency::bf16ToText, llvm::Type::getBFloatTy(llCtx));
+		convert(f64Block, InternalDependency::f64ToText, doubleTy);
+	}
+	irCtx->builder.restoreIP(savedIP);
+}
+
+} // namespace qat::ir
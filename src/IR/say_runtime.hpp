@@ -0,0 +1,45 @@
+#ifndef QAT_IR_SAY_RUNTIME_HPP
+#define QAT_IR_SAY_RUNTIME_HPP
+
+#include "../utils/file_range.hpp"
+#include "../utils/helpers.hpp"
+#include "../utils/macros.hpp"
+
+namespace qat::ir {
+
+class Ctx;
+class Mod;
+
+/// The runtime that `say` writes to instead of printf. Every thread appends to its own buffer, which is written to the
+/// standard output when it is full, at the end of every line if the output is a terminal, and when the thread exits.
+/// The buffers of all live threads are kept in a list, so that they are flushed when the program exits as well.
+/// Values are converted to text by a writer for their kind, so there is no format to parse at runtime
+class SayRuntime {
+	static constexpr u64 bufferSize       = 8192u;
+	static constexpr u64 maxDecimalDigits = 20u;
+	static constexpr u64 maxHexDigits     = 16u;
+
+	static constexpr u8 modeUnknown  = 0u;
+	static constexpr u8 modeLine     = 1u;
+	static constexpr u8 modeBuffered = 2u;
+
+	/// The fields of the state of the buffer of a thread
+	enum class StateField : u32 { next = 0u, previous, length, mode, lock, data };
+
+  public:
+	/// The kinds of floats that the float writer takes, after the value is widened to a double
+	static constexpr u8 floatKind64    = 0u;
+	static constexpr u8 floatKind32    = 1u;
+	static constexpr u8 floatKind16    = 2u;
+	static constexpr u8 floatKindBrain = 3u;
+
+	/// Whether `say` should use the runtime for the target. Otherwise printf is used as before
+	useit static bool is_supported(Ctx* irCtx);
+
+	/// Defines the functions of the runtime in the module, if they are not defined already
+	static void define(Mod* mod, Ctx* irCtx, FileRange const& fileRange);
+};
+
+} // namespace qat::ir
+
+#endif
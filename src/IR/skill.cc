@@ -201,13 +201,7 @@ Skill* GenericSkill::fill_generics(Vec<ir::GenericToFill*>& toFillTypes, ir::Ctx
 	}
 	ir::fill_generics(ast::EmitCtx::get(irCtx, parent), generics, toFillTypes, range);
 	if (constraint != nullptr) {
-		auto checkVal = constraint->emit(ast::EmitCtx::get(irCtx, parent));
-		if (not checkVal->get_ir_type()->is_bool()) {
-			irCtx->Error("The constraints for generic parameters should be of " + irCtx->color("bool") +
-			                 " type. Got an expression of " + irCtx->color(checkVal->get_ir_type()->to_string()),
-			             constraint->fileRange);
-		}
-		if (not llvm::cast<llvm::ConstantInt>(checkVal->get_llvm_constant())->getValue().getBoolValue()) {
+		if (not ir::evaluate_constraint(ast::EmitCtx::get(irCtx, parent), constraint, parent, name)) {
 			irCtx->Error("The provided parameters for the generic skill do not satisfy the constraints", range,
 			             Pair<String, FileRange>{"The constraint can be found here", constraint->fileRange});
 		}
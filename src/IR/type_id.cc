@@ -9,6 +9,7 @@
 
 #include <llvm/IR/GlobalVariable.h>
 #include <llvm/IR/Type.h>
+#include <set>
 
 namespace qat::ir {
 
@@ -16,7 +17,7 @@ std::unordered_map<llvm::Constant*, TypeInfo*> TypeInfo::idMapping{};
 
 llvm::StructType* TypeInfo::typeInfoType = nullptr;
 
-Vec<llvm::Constant*> TypeInfo::builtinTypeInfos{};
+Vec<TypeInfo*> TypeInfo::builtinTypeInfos{};
 
 llvm::GlobalVariable* TypeInfo::builtinGlobal = nullptr;
 
@@ -24,6 +25,10 @@ Mod* TypeInfo::builtinModule = nullptr;
 
 Vec<ModTypeInfo*> TypeInfo::modules{};
 
+u64 TypeInfo::emittedCount  = 0;
+u64 TypeInfo::strippedCount = 0;
+u64 TypeInfo::tableSize     = 0;
+
 TypeInfo* TypeInfo::get_for(llvm::Constant* id) { return idMapping[id]; }
 
 TypeInfo* TypeInfo::create(ir::Ctx* ctx, Type* type, Mod* mod) {
@@ -55,14 +60,14 @@ TypeInfo* TypeInfo::create(ir::Ctx* ctx, Type* type, Mod* mod) {
 			}
 			info = (llvm::ConstantStruct*)llvm::ConstantStruct::get(
 			    typeInfoType, {TextType::create_value(ctx, builtinModule, type->to_string())->get_llvm_constant()});
-			builtinTypeInfos.push_back(info);
 			id = llvm::ConstantExpr::getGetElementPtr(
-			    llvm::ArrayType::get(typeInfoType, builtinTypeInfos.size()), builtinGlobal,
-			    llvm::ConstantInt::get(llvm::Type::getInt32Ty(ctx->llctx), builtinTypeInfos.size() - 1, false));
+			    llvm::ArrayType::get(typeInfoType, builtinTypeInfos.size() + 1), builtinGlobal,
+			    llvm::ConstantInt::get(llvm::Type::getInt32Ty(ctx->llctx), builtinTypeInfos.size(), false));
 			correctGlobalName =
 			    builtinModule->get_link_names().newWith(LinkNameUnit("info", LinkUnitType::global), None).toName();
 			mod->add_dependency(builtinModule);
 			type->typeInfo = std::construct_at(OwnNormal(TypeInfo), id, info, type, builtinModule);
+			builtinTypeInfos.push_back(type->typeInfo);
 		} else {
 			Mod* typeMod = nullptr;
 			if (type->is_choice()) {
@@ -99,17 +104,17 @@ TypeInfo* TypeInfo::create(ir::Ctx* ctx, Type* type, Mod* mod) {
 			                                ? type->as_type_definition()->get_non_definition_subtype()->to_string()
 			                                : type->to_string())
 			         ->get_llvm_constant()});
-			typeMod->typeInfoDetail->typeInfos.push_back(info);
 			id = llvm::ConstantExpr::getGetElementPtr(
-			    llvm::ArrayType::get(typeInfoType, typeMod->typeInfoDetail->typeInfos.size()),
+			    llvm::ArrayType::get(typeInfoType, typeMod->typeInfoDetail->typeInfos.size() + 1),
 			    typeMod->typeInfoDetail->infoList,
-			    llvm::ConstantInt::get(llvm::Type::getInt32Ty(ctx->llctx),
-			                           typeMod->typeInfoDetail->typeInfos.size() - 1, false));
+			    llvm::ConstantInt::get(llvm::Type::getInt32Ty(ctx->llctx), typeMod->typeInfoDetail->typeInfos.size(),
+			                           false));
 			correctGlobalName = typeMod->typeInfoDetail->infoMod->get_link_names()
 			                        .newWith(LinkNameUnit("info", LinkUnitType::global), None)
 			                        .toName();
 			mod->add_dependency(typeMod->typeInfoDetail->infoMod);
 			type->typeInfo = std::construct_at(OwnNormal(TypeInfo), id, info, type, typeMod->typeInfoDetail->infoMod);
+			typeMod->typeInfoDetail->typeInfos.push_back(type->typeInfo);
 		}
 	}
 	if (not mod->get_llvm_module()->getGlobalVariable(correctGlobalName)) {
@@ -121,30 +126,75 @@ TypeInfo* TypeInfo::create(ir::Ctx* ctx, Type* type, Mod* mod) {
 	return type->typeInfo;
 }
 
+llvm::GlobalVariable* TypeInfo::finalise_list(ir::Ctx* ctx, Mod* infoMod, llvm::GlobalVariable* placeholder,
+                                              Vec<TypeInfo*> const& entries) {
+	Vec<TypeInfo*>       usedEntries;
+	Vec<llvm::Constant*> usedInfos;
+	for (auto* entry : entries) {
+		// Constants created while compiling, that did not end up in the program, still refer to the id
+		entry->id->removeDeadConstantUsers();
+		if (entry->id->use_empty()) {
+			idMapping.erase(entry->id);
+			entry->id = nullptr;
+			strippedCount++;
+		} else {
+			usedEntries.push_back(entry);
+			usedInfos.push_back(entry->typeInfo);
+		}
+	}
+	auto* listType = llvm::ArrayType::get(typeInfoType, usedInfos.size());
+	auto* result   = new llvm::GlobalVariable(
+	    *infoMod->get_llvm_module(), listType, true, llvm::GlobalValue::ExternalLinkage,
+	    llvm::ConstantArray::get(listType, usedInfos),
+	    infoMod->get_link_names().newWith(LinkNameUnit("info", LinkUnitType::global), None).toName(), nullptr,
+	    llvm::GlobalValue::NotThreadLocal, ctx->dataLayout.getDefaultGlobalsAddressSpace(), false);
+	for (usize i = 0; i < usedEntries.size(); i++) {
+		auto* entry = usedEntries[i];
+		auto* newId = llvm::ConstantExpr::getGetElementPtr(
+		    typeInfoType, result, llvm::ConstantInt::get(llvm::Type::getInt32Ty(ctx->llctx), i, false));
+		entry->id->replaceAllUsesWith(newId);
+		idMapping.erase(entry->id);
+		idMapping[newId] = entry;
+		entry->id        = newId;
+	}
+	emittedCount += usedEntries.size();
+	tableSize += ctx->dataLayout.getTypeAllocSize(listType);
+	placeholder->removeDeadConstantUsers();
+	placeholder->replaceAllUsesWith(result);
+	placeholder->eraseFromParent();
+	return result;
+}
+
 void TypeInfo::finalise_type_infos(ir::Ctx* ctx) {
 	if (builtinModule) {
 		SHOW("Finalising builtin type infos")
-		auto newBuiltinGlobal = new llvm::GlobalVariable(
-		    *builtinModule->get_llvm_module(), llvm::ArrayType::get(typeInfoType, builtinTypeInfos.size()), true,
-		    llvm::GlobalVariable::ExternalLinkage,
-		    llvm::ConstantArray::get(llvm::ArrayType::get(typeInfoType, builtinTypeInfos.size()), builtinTypeInfos),
-		    builtinModule->get_link_names().newWith(LinkNameUnit("info", LinkUnitType::global), None).toName(), nullptr,
-		    llvm::GlobalVariable::NotThreadLocal, ctx->dataLayout.getDefaultGlobalsAddressSpace(), false);
-		builtinGlobal->replaceAllUsesWith(newBuiltinGlobal);
-		builtinGlobal->eraseFromParent();
-		builtinGlobal = newBuiltinGlobal;
+		builtinGlobal = finalise_list(ctx, builtinModule, builtinGlobal, builtinTypeInfos);
 	}
 	SHOW("Finalising custom type infos")
 	for (auto* mod : modules) {
-		auto newGlobal = new llvm::GlobalVariable(
-		    *mod->infoMod->get_llvm_module(), llvm::ArrayType::get(typeInfoType, mod->typeInfos.size()), true,
-		    llvm::GlobalValue::ExternalLinkage,
-		    llvm::ConstantArray::get(llvm::ArrayType::get(typeInfoType, mod->typeInfos.size()), mod->typeInfos),
-		    mod->infoMod->get_link_names().newWith(LinkNameUnit("info", LinkUnitType::global), None).toName(), nullptr,
-		    llvm::GlobalValue::NotThreadLocal, ctx->dataLayout.getDefaultGlobalsAddressSpace(), false);
-		mod->infoList->replaceAllUsesWith(newGlobal);
-		mod->infoList->eraseFromParent();
-		mod->infoList = newGlobal;
+		mod->infoList = finalise_list(ctx, mod->infoMod, mod->infoList, mod->typeInfos);
+	}
+	// The names of the stripped entries are only removed after all tables are emitted, as the same name can be shared
+	// by entries of different tables
+	std::set<llvm::GlobalVariable*> strippedNames;
+
+	auto collectNames = [&](Vec<TypeInfo*> const& entries) {
+		for (auto* entry : entries) {
+			if (entry->id == nullptr) {
+				auto* name = entry->typeInfo->getAggregateElement(0u)->getAggregateElement(0u);
+				if (auto* nameGlobal = llvm::dyn_cast<llvm::GlobalVariable>(name->stripPointerCasts())) {
+					strippedNames.insert(nameGlobal);
+				}
+				entry->typeInfo = nullptr;
+			}
+		}
+	};
+	collectNames(builtinTypeInfos);
+	for (auto* mod : modules) {
+		collectNames(mod->typeInfos);
+	}
+	for (auto* nameGlobal : strippedNames) {
+		ctx->remove_unused_text_constant(nameGlobal);
 	}
 }
 
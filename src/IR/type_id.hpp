@@ -19,12 +19,13 @@ namespace qat::ir {
 class Type;
 class Mod;
 class Ctx;
+struct TypeInfo;
 
 struct ModTypeInfo {
 	Mod*                  mod;
 	Mod*                  infoMod;
 	llvm::GlobalVariable* infoList;
-	Vec<llvm::Constant*>  typeInfos;
+	Vec<TypeInfo*>        typeInfos;
 
 	ModTypeInfo(Mod* _mod, Mod* _infoMod, llvm::GlobalVariable* _infoList)
 	    : mod(_mod), infoMod(_infoMod), infoList(_infoList), typeInfos() {}
@@ -41,12 +42,16 @@ struct TypeInfo {
 
 	static llvm::StructType* typeInfoType;
 
-	static Vec<llvm::Constant*> builtinTypeInfos;
+	static Vec<TypeInfo*> builtinTypeInfos;
 
 	static llvm::GlobalVariable* builtinGlobal;
 
 	static Vec<ModTypeInfo*> modules;
 
+	static u64 emittedCount;
+	static u64 strippedCount;
+	static u64 tableSize;
+
 	TypeInfo(llvm::Constant* _id, llvm::ConstantStruct* _typeInfo, Type* _type, Mod* _mod)
 	    : id(_id), typeInfo(_typeInfo), type(_type), mod(_mod) {
 		idMapping[id] = this;
@@ -56,12 +61,20 @@ struct TypeInfo {
 
 	useit static TypeInfo* create(ir::Ctx* ctx, Type* type, Mod* mod);
 
+	/// Emits the type information tables. Only the entries whose ids are used by the program are emitted, and the ids
+	/// of those entries are renumbered. Entries of types that were only used while compiling are stripped
 	static void finalise_type_infos(ir::Ctx* ctx);
 
+	useit static llvm::GlobalVariable* finalise_list(ir::Ctx* ctx, Mod* infoMod, llvm::GlobalVariable* placeholder,
+	                                                 Vec<TypeInfo*> const& entries);
+
 	llvm::Constant*       id;
 	llvm::ConstantStruct* typeInfo;
 	Type*                 type;
 	Mod*                  mod;
+
+	/// Results of the type traits queried on this type, by the name of the trait
+	Map<String, Pair<llvm::Constant*, Type*>> traitResults;
 };
 
 } // namespace qat::ir
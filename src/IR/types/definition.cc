@@ -190,17 +190,10 @@ DefinitionType* GenericDefinitionType::fill_generics(Vec<GenericToFill*>& types,
 	}
 	ir::fill_generics(ast::EmitCtx::get(irCtx, parent), generics, types, range);
 	if (constraint.has_value()) {
-		auto checkVal = constraint.value()->emit(ast::EmitCtx::get(irCtx, parent));
-		if (checkVal->get_ir_type()->is_bool()) {
-			if (not llvm::cast<llvm::ConstantInt>(checkVal->get_llvm_constant())->getValue().getBoolValue()) {
-				irCtx->Error(
-				    "The provided generic parameters for the generic function do not satisfy the constraints", range,
-				    Pair<String, FileRange>{"The constraint can be found here", constraint.value()->fileRange});
-			}
-		} else {
-			irCtx->Error("The constraints for generic parameters should be of " + irCtx->color("bool") +
-			                 " type. Got an expression of " + irCtx->color(checkVal->get_ir_type()->to_string()),
-			             constraint.value()->fileRange);
+		if (not ir::evaluate_constraint(ast::EmitCtx::get(irCtx, parent), constraint.value(), parent, name)) {
+			irCtx->Error("The provided generic parameters for the generic function do not satisfy the constraints",
+			             range,
+			             Pair<String, FileRange>{"The constraint can be found here", constraint.value()->fileRange});
 		}
 	}
 	Vec<ir::GenericArgument*> genParams;
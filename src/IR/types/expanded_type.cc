@@ -4,6 +4,8 @@
 #include "./function.hpp"
 #include "./reference.hpp"
 
+#include <type_traits>
+
 namespace qat::ir {
 
 ExpandedType::ExpandedType(Identifier _name, Vec<GenericArgument*> _generics, ir::Mod* _parent,
@@ -12,6 +14,59 @@ ExpandedType::ExpandedType(Identifier _name, Vec<GenericArgument*> _generics, ir
 
 bool ExpandedType::is_generic() const { return not generics.empty(); }
 
+void ExpandedType::index_method(Method* method) {
+	// emplace does not replace an existing entry, so the first method with a name wins, same as the linear lookups
+	switch (method->get_method_type()) {
+		case MethodType::normal: {
+			(method->is_variation_method() ? variationMethodIndex : normalMethodIndex)
+			    .emplace(method->get_name().value, method);
+			break;
+		}
+		case MethodType::valueMethod: {
+			valuedMethodIndex.emplace(method->get_name().value, method);
+			break;
+		}
+		case MethodType::staticFn: {
+			staticMethodIndex.emplace(method->get_name().value, method);
+			break;
+		}
+		case MethodType::unaryOperator: {
+			unaryOperatorIndex.emplace(method->get_name().value, method);
+			break;
+		}
+		case MethodType::binaryOperator: {
+			(method->is_variation_method() ? variationBinaryOperatorIndex : normalBinaryOperatorIndex)[method->get_name()
+			                                                                                               .value]
+			    .push_back(method);
+			break;
+		}
+		case MethodType::constructor: {
+			constructorIndex[method->get_ir_type()->as_function()->get_argument_count() - 1].push_back(method);
+			break;
+		}
+		default:
+			break;
+	}
+}
+
+void ExpandedType::build_method_index() {
+	normalMethodIndex.clear();
+	variationMethodIndex.clear();
+	valuedMethodIndex.clear();
+	staticMethodIndex.clear();
+	unaryOperatorIndex.clear();
+	normalBinaryOperatorIndex.clear();
+	variationBinaryOperatorIndex.clear();
+	constructorIndex.clear();
+	for (auto* list : {&memberFunctions, &valuedMemberFunctions, &staticFunctions, &unaryOperators,
+	                   &normalBinaryOperators, &variationBinaryOperators, &constructors}) {
+		for (auto* method : *list) {
+			index_method(method);
+		}
+	}
+	hasMethodIndex = true;
+}
+
 bool ExpandedType::has_generic_parameter(const String& name) const {
 	for (auto* gen : generics) {
 		if (gen->is_same(name)) {
@@ -75,10 +130,16 @@ Maybe<Method*> ExpandedType::check_valued_function(const Vec<Method*>& valuedMem
 }
 
 bool ExpandedType::has_valued_method(String const& name) const {
+	if (hasMethodIndex) {
+		return valuedMethodIndex.contains(name);
+	}
 	return check_valued_function(valuedMemberFunctions, name).has_value();
 }
 
 Method* ExpandedType::get_valued_method(String const& name) const {
+	if (hasMethodIndex) {
+		return valuedMethodIndex.at(name);
+	}
 	return check_valued_function(valuedMemberFunctions, name).value();
 }
 
@@ -92,6 +153,9 @@ Maybe<Method*> ExpandedType::check_normal_method(const Vec<Method*>& memberFunct
 }
 
 bool ExpandedType::has_normal_method(const String& fnName) const {
+	if (hasMethodIndex) {
+		return normalMethodIndex.contains(fnName);
+	}
 	return check_normal_method(memberFunctions, fnName).has_value();
 }
 
@@ -105,14 +169,23 @@ Maybe<Method*> ExpandedType::check_variation(Vec<Method*> const& variationFuncti
 }
 
 bool ExpandedType::has_variation(String const& fnName) const {
+	if (hasMethodIndex) {
+		return variationMethodIndex.contains(fnName);
+	}
 	return check_variation(memberFunctions, fnName).has_value();
 }
 
 Method* ExpandedType::get_normal_method(const String& fnName) const {
+	if (hasMethodIndex) {
+		return normalMethodIndex.at(fnName);
+	}
 	return check_normal_method(memberFunctions, fnName).value();
 }
 
 Method* ExpandedType::get_variation(const String& fnName) const {
+	if (hasMethodIndex) {
+		return variationMethodIndex.at(fnName);
+	}
 	return check_variation(memberFunctions, fnName).value();
 }
 
@@ -126,10 +199,16 @@ Maybe<ir::Method*> ExpandedType::check_static_method(Vec<ir::Method*> const& sta
 }
 
 bool ExpandedType::has_static_method(const String& fnName) const {
+	if (hasMethodIndex) {
+		return staticMethodIndex.contains(fnName);
+	}
 	return check_static_method(staticFunctions, fnName).has_value();
 }
 
 Method* ExpandedType::get_static_method(const String& fnName) const {
+	if (hasMethodIndex) {
+		return staticMethodIndex.at(fnName);
+	}
 	return check_static_method(staticFunctions, fnName).value();
 }
 
@@ -150,20 +229,42 @@ Maybe<ir::Method*> ExpandedType::check_binary_operator(Vec<ir::Method*> const& b
 	return None;
 }
 
+// Narrows a list of methods down to the candidates registered under the key, if the index is available
+template <typename K>
+static Vec<Method*> const& indexed_candidates(bool hasIndex, std::unordered_map<K, Vec<Method*>> const& index,
+                                              std::type_identity_t<K> const& key, Vec<Method*> const& all) {
+	static const Vec<Method*> noCandidates;
+	if (not hasIndex) {
+		return all;
+	}
+	auto entry = index.find(key);
+	return (entry != index.end()) ? entry->second : noCandidates;
+}
+
 bool ExpandedType::has_normal_binary_operator(const String& opr, Pair<Maybe<bool>, ir::Type*> argType) const {
-	return check_binary_operator(normalBinaryOperators, opr, argType).has_value();
+	return check_binary_operator(
+	           indexed_candidates(hasMethodIndex, normalBinaryOperatorIndex, opr, normalBinaryOperators), opr, argType)
+	    .has_value();
 }
 
 Method* ExpandedType::get_normal_binary_operator(const String& opr, Pair<Maybe<bool>, ir::Type*> argType) const {
-	return check_binary_operator(normalBinaryOperators, opr, argType).value();
+	return check_binary_operator(
+	           indexed_candidates(hasMethodIndex, normalBinaryOperatorIndex, opr, normalBinaryOperators), opr, argType)
+	    .value();
 }
 
 bool ExpandedType::has_variation_binary_operator(const String& opr, Pair<Maybe<bool>, ir::Type*> argType) const {
-	return check_binary_operator(variationBinaryOperators, opr, argType).has_value();
+	return check_binary_operator(
+	           indexed_candidates(hasMethodIndex, variationBinaryOperatorIndex, opr, variationBinaryOperators), opr,
+	           argType)
+	    .has_value();
 }
 
 Method* ExpandedType::get_variation_binary_operator(const String& opr, Pair<Maybe<bool>, ir::Type*> argType) const {
-	return check_binary_operator(variationBinaryOperators, opr, argType).value();
+	return check_binary_operator(
+	           indexed_candidates(hasMethodIndex, variationBinaryOperatorIndex, opr, variationBinaryOperators), opr,
+	           argType)
+	    .value();
 }
 
 Maybe<ir::Method*> ExpandedType::check_unary_operator(Vec<ir::Method*> const& unaryOperators, const String& opr) {
@@ -176,10 +277,16 @@ Maybe<ir::Method*> ExpandedType::check_unary_operator(Vec<ir::Method*> const& un
 }
 
 bool ExpandedType::has_unary_operator(const String& opr) const {
+	if (hasMethodIndex) {
+		return unaryOperatorIndex.contains(opr);
+	}
 	return check_unary_operator(unaryOperators, opr).has_value();
 }
 
 Method* ExpandedType::get_unary_operator(const String& opr) const {
+	if (hasMethodIndex) {
+		return unaryOperatorIndex.at(opr);
+	}
 	return check_unary_operator(unaryOperators, opr).value();
 }
 
@@ -222,11 +329,15 @@ Maybe<ir::Method*> ExpandedType::check_constructor_with_types(Vec<ir::Method*> c
 }
 
 bool ExpandedType::has_constructor_with_types(Vec<Pair<Maybe<bool>, ir::Type*>> const& argTypes) const {
-	return check_constructor_with_types(constructors, argTypes).has_value();
+	return check_constructor_with_types(
+	           indexed_candidates(hasMethodIndex, constructorIndex, argTypes.size(), constructors), argTypes)
+	    .has_value();
 }
 
 Method* ExpandedType::get_constructor_with_types(Vec<Pair<Maybe<bool>, ir::Type*>> const& argTypes) const {
-	return check_constructor_with_types(constructors, argTypes).value();
+	return check_constructor_with_types(
+	           indexed_candidates(hasMethodIndex, constructorIndex, argTypes.size(), constructors), argTypes)
+	    .value();
 }
 
 Maybe<ir::Method*> ExpandedType::check_from_convertor(Vec<ir::Method*> const& fromConvs, Maybe<bool> isValueVar,
@@ -6,6 +6,8 @@
 #include "./opaque.hpp"
 #include "./qat_type.hpp"
 
+#include <unordered_map>
+
 namespace qat::ast {
 class DefineStructType;
 class DefineMixType;
@@ -54,11 +56,27 @@ class ExpandedType : public Type {
 
 	VisibilityInfo visibility;
 
+	// Hash indices over the methods above. These are built when the type reaches its complete phase and are kept in
+	// sync by Method after that. Until then, lookups scan the vectors
+	bool                                     hasMethodIndex = false;
+	std::unordered_map<String, Method*>      normalMethodIndex;
+	std::unordered_map<String, Method*>      variationMethodIndex;
+	std::unordered_map<String, Method*>      valuedMethodIndex;
+	std::unordered_map<String, Method*>      staticMethodIndex;
+	std::unordered_map<String, Method*>      unaryOperatorIndex;
+	std::unordered_map<String, Vec<Method*>> normalBinaryOperatorIndex;
+	std::unordered_map<String, Vec<Method*>> variationBinaryOperatorIndex;
+	std::unordered_map<usize, Vec<Method*>>  constructorIndex; // By number of arguments
+
+	void index_method(Method* method);
+
 	ExpandedType(Identifier _name, Vec<GenericArgument*> _generics, Mod* _parent, const VisibilityInfo& _visib);
 
   public:
 	useit bool is_generic() const;
 
+	void build_method_index();
+
 	useit bool has_generic_parameter(const String& name) const;
 
 	useit GenericArgument* get_generic_parameter(const String& name) const;
@@ -26,6 +26,10 @@ MixType::MixType(Identifier _name, ir::OpaqueType* _opaquedTy, Vec<GenericArgume
     : ExpandedType(std::move(_name), std::move(_generics), _parent, _visibility),
       EntityOverview("mixType", Json(), _name.range), subtypes(std::move(_subtypes)), isPack(_isPacked),
       defaultVal(_defaultVal), fileRange(std::move(_fileRange)), metaInfo(_metaInfo), opaquedType(_opaquedTy) {
+	variantIndex.reserve(subtypes.size());
+	for (usize i = 0; i < subtypes.size(); i++) {
+		variantIndex.emplace(subtypes[i].first.value, i);
+	}
 	for (const auto& sub : subtypes) {
 		if (sub.second.has_value()) {
 			auto* typ = sub.second.value();
@@ -125,37 +129,27 @@ void MixType::findTagBitWidth() {
 	while (std::pow(2, tagBitWidth) <= (subtypes.size() + 1)) {
 		tagBitWidth++;
 	}
+	// Mix types do not have member definitions of their own, so the type is complete at this point
+	build_method_index();
 }
 
-usize MixType::get_index_of(const String& name) const {
-	for (usize i = 0; i < subtypes.size(); i++) {
-		if (subtypes.at(i).first.value == name) {
-			return i + 1;
-		}
-	}
-	// NOLINTNEXTLINE(clang-diagnostic-return-type)
-}
+usize MixType::get_index_of(const String& name) const { return variantIndex.at(name) + 1; }
 
 bool MixType::has_default_variant() const { return defaultVal.has_value(); }
 
 usize MixType::get_default_index() const { return defaultVal.value_or(0u); }
 
 Pair<bool, bool> MixType::has_variant_with_name(const String& sname) const {
-	for (const auto& sTy : subtypes) {
-		if (sTy.first.value == sname) {
-			return {true, sTy.second.has_value()};
-		}
+	auto entry = variantIndex.find(sname);
+	if (entry != variantIndex.end()) {
+		return {true, subtypes.at(entry->second).second.has_value()};
 	}
 	return {false, false};
 }
 
 Type* MixType::get_variant_with_name(const String& sname) const {
-	for (const auto& sTy : subtypes) {
-		if (sTy.first.value == sname) {
-			return sTy.second.value();
-		}
-	}
-	return nullptr;
+	auto entry = variantIndex.find(sname);
+	return (entry != variantIndex.end()) ? subtypes.at(entry->second).second.value() : nullptr;
 }
 
 void MixType::get_missing_names(Vec<Identifier>& vals, Vec<Identifier>& missing) const {
@@ -10,6 +10,7 @@
 #include "./qat_type.hpp"
 
 #include <llvm/IR/LLVMContext.h>
+#include <unordered_map>
 
 namespace qat::ir {
 
@@ -18,6 +19,7 @@ class Mod;
 class MixType : public ExpandedType, public EntityOverview {
   private:
 	Vec<Pair<Identifier, Maybe<Type*>>> subtypes;
+	std::unordered_map<String, usize>   variantIndex;
 
 	u64  maxSize      = 8u;
 	bool isPack       = false;
@@ -1,30 +1,45 @@
 #include "./region.hpp"
+#include "../../cli/config.hpp"
 #include "../../show.hpp"
+#include "./function.hpp"
 #include "./pointer.hpp"
 #include "./struct_type.hpp"
+#include "./unsigned.hpp"
+#include "./void.hpp"
 
 #include <llvm/IR/BasicBlock.h>
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/DerivedTypes.h>
 #include <llvm/IR/Function.h>
 #include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/MDBuilder.h>
 
-#define BLOCK_HEADER_SIZE 24u
-#define DATA_HEADER_SIZE  24u
+#define BLOCK_HEADER_SIZE    24u
+#define DATA_HEADER_SIZE     24u
+#define MAX_GROWN_BLOCK_SIZE (64u * 1024u * 1024u)
 
 namespace qat::ir {
 
-Region* Region::get(Identifier name, usize blockSize, Mod* parent, const VisibilityInfo& visibInfo, ir::Ctx* irCtx,
-                    FileRange fileRange) {
-	return std::construct_at(OwnNormal(Region), std::move(name), blockSize, parent, visibInfo, irCtx,
-	                         std::move(fileRange));
+Region* Region::get(Identifier name, usize blockSize, u64 growth, RegionThreading threading, RegionMapping mapping,
+                    Mod* parent, const VisibilityInfo& visibInfo, ir::Ctx* irCtx, FileRange fileRange) {
+	return std::construct_at(OwnNormal(Region), std::move(name), blockSize, growth, threading, mapping, parent,
+	                         visibInfo, irCtx, std::move(fileRange));
 }
 
-Region::Region(Identifier _name, usize _blockSize, Mod* _module, const VisibilityInfo& _visibInfo, ir::Ctx* irCtx,
-               FileRange _fileRange)
-    : EntityOverview("region", Json()._("moduleID", _module->get_id())._("visibility", _visibInfo), _name.range),
-      name(std::move(_name)), blockSize(_blockSize), parent(_module), visibInfo(_visibInfo),
-      fileRange(std::move(_fileRange)) {
+Region::Region(Identifier _name, usize _blockSize, u64 _growth, RegionThreading _threading, RegionMapping _mapping,
+               Mod* _module, const VisibilityInfo& _visibInfo, ir::Ctx* irCtx, FileRange _fileRange)
+    : EntityOverview("region",
+                     Json()
+                         ._("moduleID", _module->get_id())
+                         ._("visibility", _visibInfo)
+                         ._("blockSize", _blockSize)
+                         ._("growth", _growth)
+                         ._("threading", region_threading_to_string(_threading))
+                         ._("mapping", region_mapping_to_string(_mapping)),
+                     _name.range),
+      name(std::move(_name)), blockSize(_blockSize), growth(_growth), threading(_threading), mapping(_mapping),
+      parent(_module), visibInfo(_visibInfo), fileRange(std::move(_fileRange)), generation(nullptr),
+      threadGeneration(nullptr), exitRegistered(nullptr), threadExitFn(nullptr), stats(nullptr), reportFn(nullptr) {
 	parent->regions.push_back(this);
 	auto linkNames     = parent->get_link_names().newWith(LinkNameUnit(_name.value, LinkUnitType::region), None);
 	linkingName        = linkNames.toName();
@@ -40,6 +55,52 @@ Region::Region(Identifier _name, usize _blockSize, Mod* _module, const Visibilit
 	blockCount = new llvm::GlobalVariable(
 	    *parent->get_llvm_module(), Ty64Int, false, llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage, zero64Bit,
 	    linkNames.newWith(LinkNameUnit("count", LinkUnitType::global), None).toName());
+	// The tail block and the free range in it are kept separately, so that most allocations only bump the cursor
+	tailBlock = new llvm::GlobalVariable(
+	    *parent->get_llvm_module(), llvm::PointerType::get(llvm::Type::getInt8Ty(llCtx), addressSpace), false,
+	    llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+	    llvm::ConstantPointerNull::get(llvm::PointerType::get(llvm::Type::getInt8Ty(llCtx), addressSpace)),
+	    linkNames.newWith(LinkNameUnit("tail", LinkUnitType::global), None).toName());
+	cursor = new llvm::GlobalVariable(
+	    *parent->get_llvm_module(), llvm::PointerType::get(llvm::Type::getInt8Ty(llCtx), addressSpace), false,
+	    llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+	    llvm::ConstantPointerNull::get(llvm::PointerType::get(llvm::Type::getInt8Ty(llCtx), addressSpace)),
+	    linkNames.newWith(LinkNameUnit("cursor", LinkUnitType::global), None).toName());
+	blockEnd = new llvm::GlobalVariable(
+	    *parent->get_llvm_module(), llvm::PointerType::get(llvm::Type::getInt8Ty(llCtx), addressSpace), false,
+	    llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+	    llvm::ConstantPointerNull::get(llvm::PointerType::get(llvm::Type::getInt8Ty(llCtx), addressSpace)),
+	    linkNames.newWith(LinkNameUnit("block_end", LinkUnitType::global), None).toName());
+	// A thread local region has a separate chain of blocks in every thread. A concurrent region shares the chain, but
+	// the block that is being filled is separate for every thread, so that the fast path does not need any atomics
+	if (threading != RegionThreading::shared) {
+		for (auto* threadGlobal : {tailBlock, cursor, blockEnd}) {
+			threadGlobal->setThreadLocalMode(llvm::GlobalValue::GeneralDynamicTLSModel);
+		}
+		if (threading == RegionThreading::local) {
+			blocks->setThreadLocalMode(llvm::GlobalValue::GeneralDynamicTLSModel);
+			blockCount->setThreadLocalMode(llvm::GlobalValue::GeneralDynamicTLSModel);
+		}
+	}
+	// Any thread can end a concurrent region, which advances the generation of the region. A thread only uses the
+	// block it has cached if the region has not ended since the thread last allocated in it
+	if (threading == RegionThreading::concurrent) {
+		generation = new llvm::GlobalVariable(
+		    *parent->get_llvm_module(), Ty64Int, false, llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage, zero64Bit,
+		    linkNames.newWith(LinkNameUnit("generation", LinkUnitType::global), None).toName());
+		threadGeneration = new llvm::GlobalVariable(
+		    *parent->get_llvm_module(), Ty64Int, false, llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage, zero64Bit,
+		    linkNames.newWith(LinkNameUnit("thread_generation", LinkUnitType::global), None).toName());
+		threadGeneration->setThreadLocalMode(llvm::GlobalValue::GeneralDynamicTLSModel);
+	}
+	// The blocks of a thread local region are freed when the thread exits, by a handler registered once in the thread
+	if (threading == RegionThreading::local) {
+		exitRegistered = new llvm::GlobalVariable(
+		    *parent->get_llvm_module(), llvm::Type::getInt1Ty(llCtx), false,
+		    llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage, llvm::ConstantInt::getFalse(llCtx),
+		    linkNames.newWith(LinkNameUnit("exit_registered", LinkUnitType::global), None).toName());
+		exitRegistered->setThreadLocalMode(llvm::GlobalValue::GeneralDynamicTLSModel);
+	}
 	ownFn = llvm::Function::Create(
 	    llvm::FunctionType::get(llvm::PointerType::get(llvm::Type::getInt8Ty(llCtx), addressSpace),
 	                            {/* Count */ Ty64Int, /* Size of type */ Ty64Int,
@@ -48,10 +109,96 @@ Region::Region(Identifier _name, usize _blockSize, Mod* _module, const Visibilit
 	                            false),
 	    llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
 	    linkNames.newWith(LinkNameUnit("own", LinkUnitType::function), None).toName(), parent->get_llvm_module());
+	ownSlowFn = llvm::Function::Create(
+	    ownFn->getFunctionType(), llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+	    linkNames.newWith(LinkNameUnit("own_slow", LinkUnitType::function), None).toName(), parent->get_llvm_module());
+	ownFn->addFnAttr(llvm::Attribute::InlineHint);
+	ownSlowFn->addFnAttr(llvm::Attribute::NoInline);
+	ownSlowFn->addFnAttr(llvm::Attribute::Cold);
 	destructor = llvm::Function::Create(llvm::FunctionType::get(llvm::Type::getVoidTy(llCtx), {}, false),
 	                                    llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
 	                                    linkNames.newWith(LinkNameUnit("end", LinkUnitType::function), None).toName(),
 	                                    parent->get_llvm_module());
+	if (threading == RegionThreading::local) {
+		threadExitFn = llvm::Function::Create(
+		    llvm::FunctionType::get(llvm::Type::getVoidTy(llCtx),
+		                            {llvm::PointerType::get(llvm::Type::getInt8Ty(llCtx), addressSpace)}, false),
+		    llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+		    linkNames.newWith(LinkNameUnit("thread_exit", LinkUnitType::function), None).toName(),
+		    parent->get_llvm_module());
+	}
+	destroyFromFn = llvm::Function::Create(
+	    llvm::FunctionType::get(llvm::Type::getVoidTy(llCtx),
+	                            {llvm::PointerType::get(llvm::Type::getInt8Ty(llCtx), addressSpace), Ty64Int}, false),
+	    llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+	    linkNames.newWith(LinkNameUnit("destroy_from", LinkUnitType::function), None).toName(),
+	    parent->get_llvm_module());
+	// The operations available in the language are always emitted, as they can be called from other modules
+	markFn = llvm::Function::Create(
+	    llvm::FunctionType::get(Ty64Int, {}, false), llvm::GlobalValue::LinkageTypes::WeakODRLinkage,
+	    linkNames.newWith(LinkNameUnit("mark", LinkUnitType::function), None).toName(), parent->get_llvm_module());
+	rewindFn = llvm::Function::Create(
+	    llvm::FunctionType::get(llvm::Type::getVoidTy(llCtx), {Ty64Int}, false),
+	    llvm::GlobalValue::LinkageTypes::WeakODRLinkage,
+	    linkNames.newWith(LinkNameUnit("rewind", LinkUnitType::function), None).toName(), parent->get_llvm_module());
+	resetFn = llvm::Function::Create(
+	    llvm::FunctionType::get(llvm::Type::getVoidTy(llCtx), {}, false),
+	    llvm::GlobalValue::LinkageTypes::WeakODRLinkage,
+	    linkNames.newWith(LinkNameUnit("reset", LinkUnitType::function), None).toName(), parent->get_llvm_module());
+	auto triple = irCtx->clangTargetInfo->getTriple();
+	if ((mapping != RegionMapping::none) && not triple.isOSLinux() && not triple.isOSDarwin()) {
+		irCtx->Error("The region " + irCtx->color(get_full_name()) +
+		                 " uses mapped blocks, which are only supported for Linux and macOS targets",
+		             fileRange);
+	}
+	if (cli::Config::get()->has_region_stats()) {
+		// The counters are shared by all threads even for a thread local region, so that the report covers the region
+		// as a whole
+		auto* statsType = llvm::ArrayType::get(Ty64Int, REGION_STAT_COUNT);
+		stats           = new llvm::GlobalVariable(
+            *parent->get_llvm_module(), statsType, false, llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+            llvm::ConstantAggregateZero::get(statsType),
+            linkNames.newWith(LinkNameUnit("stats", LinkUnitType::global), None).toName());
+		for (usize i = 0; i < REGION_STAT_COUNT; i++) {
+			statFns.push_back(llvm::Function::Create(
+			    llvm::FunctionType::get(Ty64Int, {}, false), llvm::GlobalValue::LinkageTypes::WeakODRLinkage,
+			    linkNames.newWith(LinkNameUnit(region_stat_to_string((RegionStat)i), LinkUnitType::function), None)
+			        .toName(),
+			    parent->get_llvm_module()));
+		}
+		reportFn = llvm::Function::Create(
+		    llvm::FunctionType::get(llvm::Type::getVoidTy(llCtx), {}, false),
+		    llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage,
+		    linkNames.newWith(LinkNameUnit("report_stats", LinkUnitType::function), None).toName(),
+		    parent->get_llvm_module());
+	}
+	auto statPtr = [&](RegionStat stat) {
+		return irCtx->builder.CreateConstInBoundsGEP2_64(stats->getValueType(), stats, 0u, (u64)stat);
+	};
+	// Adds the provided value to a counter of `--region-stats`, and provides the new value of the counter. The
+	// counters of a shared region are only updated by one thread at a time, like the rest of the region
+	auto addStat = [&](RegionStat stat, llvm::Value* value) -> llvm::Value* {
+		if (threading == RegionThreading::shared) {
+			auto* result = irCtx->builder.CreateAdd(irCtx->builder.CreateLoad(Ty64Int, statPtr(stat)), value);
+			irCtx->builder.CreateStore(result, statPtr(stat));
+			return result;
+		}
+		return irCtx->builder.CreateAdd(irCtx->builder.CreateAtomicRMW(llvm::AtomicRMWInst::Add, statPtr(stat), value,
+		                                                               llvm::MaybeAlign(),
+		                                                               llvm::AtomicOrdering::Monotonic),
+		                                value);
+	};
+	auto updatePeak = [&](llvm::Value* reserved) {
+		if (threading == RegionThreading::shared) {
+			auto* peakVal = irCtx->builder.CreateLoad(Ty64Int, statPtr(RegionStat::peakBytes));
+			irCtx->builder.CreateStore(
+			    irCtx->builder.CreateSelect(irCtx->builder.CreateICmpUGT(reserved, peakVal), reserved, peakVal),
+			    statPtr(RegionStat::peakBytes));
+		} else {
+			irCtx->builder.CreateAtomicRMW(llvm::AtomicRMWInst::UMax, statPtr(RegionStat::peakBytes), reserved,
+			                               llvm::MaybeAlign(), llvm::AtomicOrdering::Monotonic);
+		}
+	};
 	// #if NDEBUG
 	// #define LogInProgram(val)
 	// #else
@@ -69,371 +216,524 @@ Region::Region(Identifier _name, usize _blockSize, Mod* _module, const Visibilit
 	// #endif
 	{
 		SHOW("Creating the own function for region: " << get_full_name())
-		// FIXME - Use UIntPtr instead of u64
 		auto* entry = llvm::BasicBlock::Create(llCtx, "entry", ownFn);
 		irCtx->builder.SetInsertPoint(entry);
-		auto* lastBlock =
-		    irCtx->builder.CreateAlloca(llvm::Type::getInt8Ty(llCtx)->getPointerTo(
-		                                    parent->get_llvm_module()->getDataLayout().getProgramAddressSpace()),
-		                                nullptr, "lastBlock");
-		auto* blockIndex         = irCtx->builder.CreateAlloca(Ty64Int, nullptr, "blockIndex");
-		auto* reqSize            = irCtx->builder.CreateMul(ownFn->getArg(0u), ownFn->getArg(1u));
-		auto* zeroCheckTrueBlock = llvm::BasicBlock::Create(llCtx, "zeroCheckTrue", ownFn);
-		auto* zeroCheckRestBlock = llvm::BasicBlock::Create(llCtx, "zeroCheckRest", ownFn);
-		SHOW("Creating condition to check if block count is zero")
-		irCtx->builder.CreateCondBr(
-		    irCtx->builder.CreateICmpEQ(irCtx->builder.CreateLoad(Ty64Int, blockCount), zero64Bit), zeroCheckTrueBlock,
-		    zeroCheckRestBlock);
-		irCtx->builder.SetInsertPoint(zeroCheckTrueBlock);
-		auto* defaultBlockSize             = llvm::ConstantInt::get(Ty64Int, blockSize);
-		auto* zeroCheckSizeCheckTrueBlock  = llvm::BasicBlock::Create(llCtx, "zeroCheckSizeCheckTrue", ownFn);
-		auto* zeroCheckSizeCheckFalseBlock = llvm::BasicBlock::Create(llCtx, "zeroCheckSizeCheckFalse", ownFn);
-		auto* zeroCheckSizeCheckRestBlock  = llvm::BasicBlock::Create(llCtx, "zeroCheckSizeCheckRest", ownFn);
-		SHOW("Checking if requested size is greater than or equal to default block size")
-		irCtx->builder.CreateCondBr(
-		    irCtx->builder.CreateICmpUGE(
-		        irCtx->builder.CreateAdd(reqSize,
-		                                 llvm::ConstantInt::get(Ty64Int, BLOCK_HEADER_SIZE + DATA_HEADER_SIZE)),
-		        defaultBlockSize),
-		    zeroCheckSizeCheckTrueBlock, zeroCheckSizeCheckFalseBlock);
-		irCtx->builder.SetInsertPoint(zeroCheckSizeCheckTrueBlock);
-		auto* largerBlockSize =
-		    irCtx->builder.CreateAdd(reqSize, llvm::ConstantInt::get(Ty64Int, BLOCK_HEADER_SIZE + DATA_HEADER_SIZE));
-		irCtx->builder.CreateBr(zeroCheckSizeCheckRestBlock);
-		irCtx->builder.SetInsertPoint(zeroCheckSizeCheckFalseBlock);
-		irCtx->builder.CreateBr(zeroCheckSizeCheckRestBlock);
-		irCtx->builder.SetInsertPoint(zeroCheckSizeCheckRestBlock);
-		auto* zeroCheckSizePhi = irCtx->builder.CreatePHI(Ty64Int, 2u);
-		zeroCheckSizePhi->addIncoming(largerBlockSize, zeroCheckSizeCheckTrueBlock);
-		zeroCheckSizePhi->addIncoming(defaultBlockSize, zeroCheckSizeCheckFalseBlock);
-		auto  mallocName = parent->link_internal_dependency(InternalDependency::malloc, irCtx, fileRange);
-		auto* mallocFn   = parent->get_llvm_module()->getFunction(mallocName);
-		// FIXME - Allow to change block size
-		// FIXME - Throw/Panic if malloc fails
-		auto* firstBlock = irCtx->builder.CreateCall(mallocFn->getFunctionType(), mallocFn, {zeroCheckSizePhi});
-		irCtx->builder.CreateStore(firstBlock, blocks, true);
-		irCtx->builder.CreateStore(llvm::ConstantInt::get(Ty64Int, 1u), blockCount);
-		auto* zeroCheckBlockSizePtr =
-		    irCtx->builder.CreatePointerCast(firstBlock, llvm::PointerType::get(Ty64Int, addressSpace));
-		irCtx->builder.CreateStore(zeroCheckSizePhi, zeroCheckBlockSizePtr);
-		auto* zeroCheckBlockOccupiedPtr =
-		    irCtx->builder.CreateInBoundsGEP(Ty64Int, zeroCheckBlockSizePtr, {llvm::ConstantInt::get(Ty64Int, 1u)});
-		irCtx->builder.CreateStore(irCtx->builder.CreateAdd(reqSize, llvm::ConstantInt::get(Ty64Int, DATA_HEADER_SIZE)),
-		                           zeroCheckBlockOccupiedPtr);
-		auto* ptrToVoidPtrTy = llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace)->getPointerTo(addressSpace);
-		auto* zeroCheckBlockNextBlockPtrPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(Ty64Int, zeroCheckBlockOccupiedPtr, {llvm::ConstantInt::get(Ty64Int, 1u)}),
-		    ptrToVoidPtrTy);
-		irCtx->builder.CreateStore(
-		    llvm::ConstantPointerNull::get(llvm::PointerType::get(llvm::Type::getInt8Ty(llCtx), addressSpace)),
-		    zeroCheckBlockNextBlockPtrPtr);
-		auto* zeroCheckDataCountPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace),
-		                                     zeroCheckBlockNextBlockPtrPtr, {llvm::ConstantInt::get(Ty64Int, 1u)}),
-		    Ty64Int->getPointerTo());
-		irCtx->builder.CreateStore(ownFn->getArg(0), zeroCheckDataCountPtr);
-		SHOW("Count of instances to allocate for")
-		auto* zeroCheckDataTypeSizePtr =
-		    irCtx->builder.CreateInBoundsGEP(Ty64Int, zeroCheckDataCountPtr, {llvm::ConstantInt::get(Ty64Int, 1u)});
-		irCtx->builder.CreateStore(ownFn->getArg(1), zeroCheckDataTypeSizePtr);
-		SHOW("Size of type")
-		auto* zeroCheckDataDestructorPtrPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(Ty64Int, zeroCheckDataTypeSizePtr, {llvm::ConstantInt::get(Ty64Int, 1u)}),
-		    llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace)->getPointerTo(addressSpace));
-		irCtx->builder.CreateStore(ownFn->getArg(2u), zeroCheckDataDestructorPtrPtr);
-		auto* zeroCheckDataReturnPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace),
-		                                     zeroCheckDataDestructorPtrPtr, {llvm::ConstantInt::get(Ty64Int, 1u)}),
-		    llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace));
-		irCtx->builder.CreateRet(zeroCheckDataReturnPtr);
-		irCtx->builder.SetInsertPoint(zeroCheckRestBlock);
-		SHOW("Storing last block pointer")
+		auto* i8PtrTy     = llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace);
+		auto* totalSize   = irCtx->builder.CreateAdd(irCtx->builder.CreateMul(ownFn->getArg(0u), ownFn->getArg(1u)),
+		                                             llvm::ConstantInt::get(Ty64Int, DATA_HEADER_SIZE));
+		auto* cursorVal   = irCtx->builder.CreateLoad(i8PtrTy, cursor);
+		auto* blockEndVal = irCtx->builder.CreateLoad(i8PtrTy, blockEnd);
+		auto* newCursor   = irCtx->builder.CreateGEP(llvm::Type::getInt8Ty(llCtx), cursorVal, {totalSize});
+		auto* bumpBlock   = llvm::BasicBlock::Create(llCtx, "bump", ownFn);
+		auto* slowBlock   = llvm::BasicBlock::Create(llCtx, "slow", ownFn);
+		// The cursor and the end are null until the first block is allocated, and a size that overflows the cursor
+		// cannot fit in the block either
+		auto* fitsBlock = irCtx->builder.CreateAnd(
+		    irCtx->builder.CreateAnd(irCtx->builder.CreateIsNotNull(cursorVal),
+		                             irCtx->builder.CreateICmpUGE(newCursor, cursorVal)),
+		    irCtx->builder.CreateICmpULE(newCursor, blockEndVal));
+		if (threading == RegionThreading::concurrent) {
+			auto* generationVal = irCtx->builder.CreateLoad(Ty64Int, generation);
+			generationVal->setAtomic(llvm::AtomicOrdering::Monotonic);
+			fitsBlock = irCtx->builder.CreateAnd(
+			    fitsBlock,
+			    irCtx->builder.CreateICmpEQ(generationVal, irCtx->builder.CreateLoad(Ty64Int, threadGeneration)));
+		}
+		irCtx->builder.CreateCondBr(fitsBlock, bumpBlock, slowBlock,
+		                            llvm::MDBuilder(llCtx).createBranchWeights(2000u, 1u));
+		irCtx->builder.SetInsertPoint(bumpBlock);
+		auto* countPtr = irCtx->builder.CreatePointerCast(cursorVal, Ty64Int->getPointerTo(addressSpace));
+		irCtx->builder.CreateStore(ownFn->getArg(0u), countPtr);
+		auto* typeSizePtr = irCtx->builder.CreateInBoundsGEP(Ty64Int, countPtr, {llvm::ConstantInt::get(Ty64Int, 1u)});
+		irCtx->builder.CreateStore(ownFn->getArg(1u), typeSizePtr);
+		auto* destructorPtrPtr = irCtx->builder.CreatePointerCast(
+		    irCtx->builder.CreateInBoundsGEP(Ty64Int, typeSizePtr, {llvm::ConstantInt::get(Ty64Int, 1u)}),
+		    i8PtrTy->getPointerTo(addressSpace));
+		irCtx->builder.CreateStore(ownFn->getArg(2u), destructorPtrPtr);
+		irCtx->builder.CreateStore(newCursor, cursor);
+		auto* tailOccupiedPtr = irCtx->builder.CreateInBoundsGEP(
+		    Ty64Int,
+		    irCtx->builder.CreatePointerCast(irCtx->builder.CreateLoad(i8PtrTy, tailBlock),
+		                                     Ty64Int->getPointerTo(addressSpace)),
+		    {llvm::ConstantInt::get(Ty64Int, 1u)});
 		irCtx->builder.CreateStore(
-		    irCtx->builder.CreateLoad(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace), blocks), lastBlock);
-		irCtx->builder.CreateStore(zero64Bit, blockIndex);
-		auto* findLastCondBlock = llvm::BasicBlock::Create(llCtx, "findLastBlockCond", ownFn);
-		auto* findLastTrueBlock = llvm::BasicBlock::Create(llCtx, "findLastBlockTrue", ownFn);
-		auto* findLastRestBlock = llvm::BasicBlock::Create(llCtx, "findLastBlockRest", ownFn);
-		irCtx->builder.CreateBr(findLastCondBlock);
-		irCtx->builder.SetInsertPoint(findLastCondBlock);
-		SHOW("Creating condition to check block index")
-		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpULT(irCtx->builder.CreateLoad(Ty64Int, blockIndex),
-		                                                         irCtx->builder.CreateLoad(Ty64Int, blockCount)),
-		                            findLastTrueBlock, findLastRestBlock);
-		irCtx->builder.SetInsertPoint(findLastTrueBlock);
-		SHOW("Find last true block")
+		    irCtx->builder.CreateAdd(irCtx->builder.CreateLoad(Ty64Int, tailOccupiedPtr), totalSize), tailOccupiedPtr);
+		if (stats != nullptr) {
+			(void)addStat(RegionStat::requestedBytes, irCtx->builder.CreateMul(ownFn->getArg(0u), ownFn->getArg(1u)));
+			(void)addStat(RegionStat::overheadBytes, llvm::ConstantInt::get(Ty64Int, DATA_HEADER_SIZE));
+		}
+		irCtx->builder.CreateRet(irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), cursorVal,
+		                                                          {llvm::ConstantInt::get(Ty64Int, DATA_HEADER_SIZE)}));
+		irCtx->builder.SetInsertPoint(slowBlock);
+		auto* slowCall = irCtx->builder.CreateCall(ownSlowFn->getFunctionType(), ownSlowFn,
+		                                           {ownFn->getArg(0u), ownFn->getArg(1u), ownFn->getArg(2u)});
+		slowCall->setTailCall();
+		irCtx->builder.CreateRet(slowCall);
+	}
+	auto* i8PtrTy = llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace);
+	// Provides a pointer to a field of the header of a block. The fields are the size of the block, the size occupied
+	// by the data in the block, and the next block in the chain
+	auto blockField = [&](llvm::Value* block, u64 index, llvm::Type* fieldType) {
+		return irCtx->builder.CreatePointerCast(
+		    irCtx->builder.CreateInBoundsGEP(
+		        Ty64Int, irCtx->builder.CreatePointerCast(block, Ty64Int->getPointerTo(addressSpace)),
+		        {llvm::ConstantInt::get(Ty64Int, index)}),
+		    fieldType->getPointerTo(addressSpace));
+	};
+	// Writes the header of the data being allocated at the start of the block, and provides the data
+	auto writeData = [&](llvm::Value* block) {
+		auto* countPtr = irCtx->builder.CreatePointerCast(
+		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), block,
+		                                     {llvm::ConstantInt::get(Ty64Int, BLOCK_HEADER_SIZE)}),
+		    Ty64Int->getPointerTo(addressSpace));
+		irCtx->builder.CreateStore(ownSlowFn->getArg(0u), countPtr);
+		auto* typeSizePtr = irCtx->builder.CreateInBoundsGEP(Ty64Int, countPtr, {llvm::ConstantInt::get(Ty64Int, 1u)});
+		irCtx->builder.CreateStore(ownSlowFn->getArg(1u), typeSizePtr);
 		irCtx->builder.CreateStore(
-		    irCtx->builder.CreateLoad(
-		        llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace),
-		        irCtx->builder.CreatePointerCast(
-		            irCtx->builder.CreateInBoundsGEP(
-		                Ty64Int,
-		                irCtx->builder.CreatePointerCast(
-		                    irCtx->builder.CreateLoad(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace),
-		                                              lastBlock),
-		                    Ty64Int->getPointerTo()),
-		                {llvm::ConstantInt::get(Ty64Int, 2u)}),
-		            llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace)->getPointerTo(addressSpace))),
-		    lastBlock);
-		SHOW("Storing incremented block index")
-		irCtx->builder.CreateStore(irCtx->builder.CreateAdd(irCtx->builder.CreateLoad(Ty64Int, blockIndex),
-		                                                    llvm::ConstantInt::get(Ty64Int, 1u)),
-		                           blockIndex);
-		irCtx->builder.CreateBr(findLastCondBlock);
-		irCtx->builder.SetInsertPoint(findLastRestBlock);
-		SHOW("Setting findLastRestBlock as active")
-		auto* lastBlockSizePtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateLoad(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace), lastBlock),
-		    llvm::Type::getInt64Ty(llCtx)->getPointerTo(addressSpace));
-		auto* lastBlockOccupiedPtr = irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt64Ty(llCtx), lastBlockSizePtr,
-		                                                              {llvm::ConstantInt::get(Ty64Int, 1u)});
-		auto* lastBlockSpaceLeftBlock = llvm::BasicBlock::Create(llCtx, "lastBlockSpaceLeftBlock", ownFn);
-		auto* newBlockNeededBlock     = llvm::BasicBlock::Create(llCtx, "newBlockNeeded", ownFn);
-		irCtx->builder.CreateCondBr(
-		    irCtx->builder.CreateICmpUGE(
-		        irCtx->builder.CreateSub(irCtx->builder.CreateSub(irCtx->builder.CreateLoad(Ty64Int, lastBlockSizePtr),
-		                                                          llvm::ConstantInt::get(Ty64Int, BLOCK_HEADER_SIZE)),
-		                                 irCtx->builder.CreateLoad(Ty64Int, lastBlockOccupiedPtr)),
-		        irCtx->builder.CreateAdd(reqSize, llvm::ConstantInt::get(Ty64Int, DATA_HEADER_SIZE))),
-		    lastBlockSpaceLeftBlock, newBlockNeededBlock);
-		irCtx->builder.SetInsertPoint(lastBlockSpaceLeftBlock);
-		auto* lastBlockDataStartPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(Ty64Int, lastBlockSizePtr, {llvm::ConstantInt::get(Ty64Int, 3u)}),
-		    llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace));
-		auto* lastBlockTargetStartPtr =
-		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), lastBlockDataStartPtr,
-		                                     {irCtx->builder.CreateLoad(Ty64Int, lastBlockOccupiedPtr)});
-		auto* lastBlockTargetCountPtr =
-		    irCtx->builder.CreatePointerCast(lastBlockTargetStartPtr, Ty64Int->getPointerTo());
-		SHOW("Last Block: Storing count of instances")
-		irCtx->builder.CreateStore(ownFn->getArg(0u), lastBlockTargetCountPtr);
-		auto* lastBlockTargetSizePtr =
-		    irCtx->builder.CreateInBoundsGEP(Ty64Int, lastBlockTargetCountPtr, {llvm::ConstantInt::get(Ty64Int, 1u)});
-		SHOW("Last Block: Storing size of one instance")
-		irCtx->builder.CreateStore(ownFn->getArg(1u), lastBlockTargetSizePtr);
-		auto* lastBlockTargetDestructorPtrPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(Ty64Int, lastBlockTargetSizePtr, {llvm::ConstantInt::get(Ty64Int, 1u)}),
-		    llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace)->getPointerTo(addressSpace));
-		SHOW("Last Block: Storing destructor pointer")
-		irCtx->builder.CreateStore(ownFn->getArg(2u), lastBlockTargetDestructorPtrPtr);
+		    ownSlowFn->getArg(2u),
+		    irCtx->builder.CreatePointerCast(
+		        irCtx->builder.CreateInBoundsGEP(Ty64Int, countPtr, {llvm::ConstantInt::get(Ty64Int, 2u)}),
+		        i8PtrTy->getPointerTo(addressSpace)));
+		auto* dataOffset = llvm::ConstantInt::get(Ty64Int, BLOCK_HEADER_SIZE + DATA_HEADER_SIZE);
+		return irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), block, {dataOffset});
+	};
+	// Makes the provided block the tail block, with the first allocation of the provided size already in it
+	auto updateTail = [&](llvm::Value* block, llvm::Value* size, llvm::Value* reqSize) {
+		irCtx->builder.CreateStore(block, tailBlock);
 		irCtx->builder.CreateStore(
+		    irCtx->builder.CreateInBoundsGEP(
+		        llvm::Type::getInt8Ty(llCtx), block,
+		        {irCtx->builder.CreateAdd(reqSize,
+		                                  llvm::ConstantInt::get(Ty64Int, BLOCK_HEADER_SIZE + DATA_HEADER_SIZE))}),
+		    cursor);
+		irCtx->builder.CreateStore(irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), block, {size}),
+		                           blockEnd);
+	};
+	// Allocates a block of the provided size, providing null if the allocation failed
+	auto allocateBlock = [&](llvm::Value* size) -> llvm::Value* {
+		if (mapping == RegionMapping::none) {
+			auto  mallocName = parent->link_internal_dependency(InternalDependency::malloc, irCtx, fileRange);
+			auto* mallocFn   = parent->get_llvm_module()->getFunction(mallocName);
+			return irCtx->builder.CreateCall(mallocFn->getFunctionType(), mallocFn, {size});
+		}
+		auto  mmapName = parent->link_internal_dependency(InternalDependency::mmap, irCtx, fileRange);
+		auto* mmapFn   = parent->get_llvm_module()->getFunction(mmapName);
+		auto* i32Ty    = llvm::Type::getInt32Ty(llCtx);
+		// PROT_READ | PROT_WRITE, and MAP_PRIVATE | MAP_ANONYMOUS, whose value is different on Darwin
+		auto* mapped = irCtx->builder.CreateCall(
+		    mmapFn->getFunctionType(), mmapFn,
+		    {llvm::ConstantPointerNull::get(i8PtrTy), size, llvm::ConstantInt::get(i32Ty, 0x3u),
+		     llvm::ConstantInt::get(i32Ty, triple.isOSDarwin() ? 0x1002u : 0x22u),
+		     llvm::ConstantInt::get(i32Ty, -1, true), llvm::ConstantInt::get(Ty64Int, 0u)});
+		if ((mapping == RegionMapping::hugePages) && triple.isOSLinux()) {
+			// MADV_HUGEPAGE is only a hint, so the result is ignored
+			auto  madviseName = parent->link_internal_dependency(InternalDependency::madvise, irCtx, fileRange);
+			auto* madviseFn   = parent->get_llvm_module()->getFunction(madviseName);
+			irCtx->builder.CreateCall(madviseFn->getFunctionType(), madviseFn,
+			                          {mapped, size, llvm::ConstantInt::get(i32Ty, 14u)});
+		}
+		return irCtx->builder.CreateSelect(
+		    irCtx->builder.CreateICmpEQ(irCtx->builder.CreatePtrToInt(mapped, Ty64Int),
+		                                llvm::ConstantInt::get(Ty64Int, -1, true)),
+		    llvm::ConstantPointerNull::get(i8PtrTy), mapped);
+	};
+	auto freeBlock = [&](llvm::Value* block) {
+		if (mapping == RegionMapping::none) {
+			auto  freeName = parent->link_internal_dependency(InternalDependency::free, irCtx, fileRange);
+			auto* freeFn   = parent->get_llvm_module()->getFunction(freeName);
+			irCtx->builder.CreateCall(freeFn->getFunctionType(), freeFn, {block});
+		} else {
+			auto  munmapName = parent->link_internal_dependency(InternalDependency::munmap, irCtx, fileRange);
+			auto* munmapFn   = parent->get_llvm_module()->getFunction(munmapName);
+			irCtx->builder.CreateCall(munmapFn->getFunctionType(), munmapFn,
+			                          {block, irCtx->builder.CreateLoad(Ty64Int, blockField(block, 0u, Ty64Int))});
+		}
+	};
+	// Adds the provided block to the front of the shared chain of a concurrent region. The header of the block is
+	// complete before the block is published, and the chain is only walked by the destructor
+	auto pushBlock = [&](llvm::Value* block) {
+		auto* nextBlockPtr = blockField(block, 2u, i8PtrTy);
+		auto* currentBlock = irCtx->builder.GetInsertBlock();
+		auto* pushLoop     = llvm::BasicBlock::Create(llCtx, "pushBlock", ownSlowFn);
+		auto* pushDone     = llvm::BasicBlock::Create(llCtx, "pushBlockDone", ownSlowFn);
+		auto* initialHead  = irCtx->builder.CreateLoad(i8PtrTy, blocks);
+		initialHead->setAtomic(llvm::AtomicOrdering::Monotonic);
+		irCtx->builder.CreateBr(pushLoop);
+		irCtx->builder.SetInsertPoint(pushLoop);
+		auto* headPhi = irCtx->builder.CreatePHI(i8PtrTy, 2u);
+		headPhi->addIncoming(initialHead, currentBlock);
+		irCtx->builder.CreateStore(headPhi, nextBlockPtr);
+		auto* exchange = irCtx->builder.CreateAtomicCmpXchg(blocks, headPhi, block, llvm::MaybeAlign(),
+		                                                    llvm::AtomicOrdering::Release,
+		                                                    llvm::AtomicOrdering::Monotonic);
+		headPhi->addIncoming(irCtx->builder.CreateExtractValue(exchange, {0u}), pushLoop);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateExtractValue(exchange, {1u}), pushDone, pushLoop);
+		irCtx->builder.SetInsertPoint(pushDone);
+		irCtx->builder.CreateAtomicRMW(llvm::AtomicRMWInst::Add, blockCount, llvm::ConstantInt::get(Ty64Int, 1u),
+		                               llvm::MaybeAlign(), llvm::AtomicOrdering::Monotonic);
+	};
+	// Makes sure that the blocks of a thread local region are freed when the thread that allocated them exits
+	auto registerThreadExit = [&]() {
+		// FIXME - Free the blocks of other threads on exit on targets without a thread exit hook, like Windows and musl,
+		// where only the main thread frees its blocks
+		auto atExitDep = Mod::thread_exit_dependency(irCtx);
+		if (not atExitDep.has_value()) {
+			return;
+		}
+		auto  atExitName = parent->link_internal_dependency(atExitDep.value(), irCtx, fileRange);
+		auto* atExitFn   = parent->get_llvm_module()->getFunction(atExitName);
+		Vec<llvm::Value*> arguments{irCtx->builder.CreatePointerCast(threadExitFn, i8PtrTy),
+		                            llvm::ConstantPointerNull::get(i8PtrTy)};
+		// The last argument of __cxa_thread_atexit_impl is the handle of the shared object, which can be null
+		if (atExitDep.value() == InternalDependency::cxaThreadAtExit) {
+			arguments.push_back(llvm::ConstantPointerNull::get(i8PtrTy));
+		}
+		irCtx->builder.CreateCall(atExitFn->getFunctionType(), atExitFn, arguments);
+	};
+	{
+		SHOW("Creating the slow path of the own function for region: " << get_full_name())
+		// FIXME - Use UIntPtr instead of u64
+		auto* entry = llvm::BasicBlock::Create(llCtx, "entry", ownSlowFn);
+		irCtx->builder.SetInsertPoint(entry);
+		auto* reqSize          = irCtx->builder.CreateMul(ownSlowFn->getArg(0u), ownSlowFn->getArg(1u));
+		auto* totalSize        = irCtx->builder.CreateAdd(reqSize, llvm::ConstantInt::get(Ty64Int, DATA_HEADER_SIZE));
+		auto* requiredSize     =
+		    irCtx->builder.CreateAdd(totalSize, llvm::ConstantInt::get(Ty64Int, BLOCK_HEADER_SIZE));
+		auto* defaultBlockSize = llvm::ConstantInt::get(Ty64Int, blockSize);
+		if (stats != nullptr) {
+			(void)addStat(RegionStat::requestedBytes, reqSize);
+			(void)addStat(RegionStat::overheadBytes, llvm::ConstantInt::get(Ty64Int, DATA_HEADER_SIZE));
+		}
+		llvm::Value* tailVal = irCtx->builder.CreateLoad(i8PtrTy, tailBlock);
+		if (threading == RegionThreading::concurrent) {
+			// The tail block of this thread is forgotten if the region has ended since, as it is freed already
+			auto* generationVal = irCtx->builder.CreateLoad(Ty64Int, generation);
+			generationVal->setAtomic(llvm::AtomicOrdering::Monotonic);
+			tailVal = irCtx->builder.CreateSelect(
+			    irCtx->builder.CreateICmpEQ(generationVal, irCtx->builder.CreateLoad(Ty64Int, threadGeneration)),
+			    tailVal, llvm::ConstantPointerNull::get(i8PtrTy));
+			irCtx->builder.CreateStore(generationVal, threadGeneration);
+		}
+		auto* firstBlock       = llvm::BasicBlock::Create(llCtx, "firstBlock", ownSlowFn);
+		auto* growBlock        = llvm::BasicBlock::Create(llCtx, "growBlock", ownSlowFn);
+		auto* allocBlock       = llvm::BasicBlock::Create(llCtx, "allocateBlock", ownSlowFn);
+		if (threading == RegionThreading::concurrent) {
+			irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(tailVal), firstBlock, growBlock);
+		} else {
+			// Blocks after the tail block are only present after a reset or a rewind, and are empty
+			auto* checkNextBlock = llvm::BasicBlock::Create(llCtx, "checkNextBlock", ownSlowFn);
+			auto* hasNextBlock   = llvm::BasicBlock::Create(llCtx, "hasNextBlock", ownSlowFn);
+			auto* reuseBlock     = llvm::BasicBlock::Create(llCtx, "reuseBlock", ownSlowFn);
+			irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(tailVal), firstBlock, checkNextBlock);
+			irCtx->builder.SetInsertPoint(checkNextBlock);
+			auto* nextVal = irCtx->builder.CreateLoad(i8PtrTy, blockField(tailVal, 2u, i8PtrTy));
+			irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(nextVal), growBlock, hasNextBlock);
+			irCtx->builder.SetInsertPoint(hasNextBlock);
+			auto* nextSize = irCtx->builder.CreateLoad(Ty64Int, blockField(nextVal, 0u, Ty64Int));
+			irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpULE(requiredSize, nextSize), reuseBlock, growBlock);
+			irCtx->builder.SetInsertPoint(reuseBlock);
+			irCtx->builder.CreateStore(totalSize, blockField(nextVal, 1u, Ty64Int));
+			auto* reusedData = writeData(nextVal);
+			updateTail(nextVal, nextSize, reqSize);
+			irCtx->builder.CreateRet(reusedData);
+		}
+		irCtx->builder.SetInsertPoint(firstBlock);
+		irCtx->builder.CreateBr(allocBlock);
+		irCtx->builder.SetInsertPoint(growBlock);
+		llvm::Value* grownSize = defaultBlockSize;
+		if (growth > 1u) {
+			// Every new block is larger than the tail block by the growth factor, up to a limit
+			auto* tailSize   = irCtx->builder.CreateLoad(Ty64Int, blockField(tailVal, 0u, Ty64Int));
+			auto* scaledSize = irCtx->builder.CreateMul(tailSize, llvm::ConstantInt::get(Ty64Int, growth));
+			auto* maxSize    = llvm::ConstantInt::get(Ty64Int, MAX_GROWN_BLOCK_SIZE);
+			auto* cappedSize =
+			    irCtx->builder.CreateSelect(irCtx->builder.CreateICmpULT(scaledSize, maxSize), scaledSize, maxSize);
+			grownSize = irCtx->builder.CreateSelect(irCtx->builder.CreateICmpUGT(cappedSize, defaultBlockSize),
+			                                        cappedSize, defaultBlockSize);
+		}
+		irCtx->builder.CreateBr(allocBlock);
+		irCtx->builder.SetInsertPoint(allocBlock);
+		auto* sizePhi = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		sizePhi->addIncoming(defaultBlockSize, firstBlock);
+		sizePhi->addIncoming(grownSize, growBlock);
+		auto* previousTail = irCtx->builder.CreatePHI(i8PtrTy, 2u);
+		previousTail->addIncoming(llvm::ConstantPointerNull::get(i8PtrTy), firstBlock);
+		previousTail->addIncoming(tailVal, growBlock);
+		auto* newBlockSize =
+		    irCtx->builder.CreateSelect(irCtx->builder.CreateICmpUGT(requiredSize, sizePhi), requiredSize, sizePhi);
+		// FIXME - Panic if the allocation fails
+		auto* newBlock = allocateBlock(newBlockSize);
+		irCtx->builder.CreateStore(newBlockSize, blockField(newBlock, 0u, Ty64Int));
+		irCtx->builder.CreateStore(totalSize, blockField(newBlock, 1u, Ty64Int));
+		if (stats != nullptr) {
+			(void)addStat(RegionStat::blockCount, llvm::ConstantInt::get(Ty64Int, 1u));
+			(void)addStat(RegionStat::overheadBytes, llvm::ConstantInt::get(Ty64Int, BLOCK_HEADER_SIZE));
+			updatePeak(addStat(RegionStat::reservedBytes, newBlockSize));
+		}
+		if (threading == RegionThreading::concurrent) {
+			pushBlock(newBlock);
+		} else {
+			auto* headBlock   = llvm::BasicBlock::Create(llCtx, "headBlock", ownSlowFn);
+			auto* linkBlock   = llvm::BasicBlock::Create(llCtx, "linkBlock", ownSlowFn);
+			auto* linkedBlock = llvm::BasicBlock::Create(llCtx, "linkedBlock", ownSlowFn);
+			irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(previousTail), headBlock, linkBlock);
+			irCtx->builder.SetInsertPoint(headBlock);
+			irCtx->builder.CreateStore(llvm::ConstantPointerNull::get(i8PtrTy), blockField(newBlock, 2u, i8PtrTy));
+			irCtx->builder.CreateStore(newBlock, blocks);
+			if (threading == RegionThreading::local) {
+				auto* registerBlock   = llvm::BasicBlock::Create(llCtx, "registerThreadExit", ownSlowFn);
+				auto* registeredBlock = llvm::BasicBlock::Create(llCtx, "threadExitRegistered", ownSlowFn);
+				irCtx->builder.CreateCondBr(irCtx->builder.CreateLoad(llvm::Type::getInt1Ty(llCtx), exitRegistered),
+				                            registeredBlock, registerBlock);
+				irCtx->builder.SetInsertPoint(registerBlock);
+				registerThreadExit();
+				irCtx->builder.CreateStore(llvm::ConstantInt::getTrue(llCtx), exitRegistered);
+				irCtx->builder.CreateBr(registeredBlock);
+				irCtx->builder.SetInsertPoint(registeredBlock);
+			}
+			irCtx->builder.CreateBr(linkedBlock);
+			irCtx->builder.SetInsertPoint(linkBlock);
+			// The new block is inserted right after the tail block, before the empty blocks kept by a rewind
+			auto* previousNextPtr = blockField(previousTail, 2u, i8PtrTy);
+			irCtx->builder.CreateStore(irCtx->builder.CreateLoad(i8PtrTy, previousNextPtr),
+			                           blockField(newBlock, 2u, i8PtrTy));
+			irCtx->builder.CreateStore(newBlock, previousNextPtr);
+			irCtx->builder.CreateBr(linkedBlock);
+			irCtx->builder.SetInsertPoint(linkedBlock);
+			irCtx->builder.CreateStore(irCtx->builder.CreateAdd(irCtx->builder.CreateLoad(Ty64Int, blockCount),
+			                                                    llvm::ConstantInt::get(Ty64Int, 1u)),
+			                           blockCount);
+		}
+		auto* newData = writeData(newBlock);
+		updateTail(newBlock, newBlockSize, reqSize);
+		irCtx->builder.CreateRet(newData);
+	}
+	{
+		SHOW("Creating the function that destroys the data in a block after an offset")
+		auto* block  = destroyFromFn->getArg(0u);
+		auto* offset = destroyFromFn->getArg(1u);
+		auto* entry  = llvm::BasicBlock::Create(llCtx, "entry", destroyFromFn);
+		irCtx->builder.SetInsertPoint(entry);
+		auto* occupiedPtr  = blockField(block, 1u, Ty64Int);
+		auto* occupied     = irCtx->builder.CreateLoad(Ty64Int, occupiedPtr);
+		auto* dataStart    = irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), block,
+		                                                      {llvm::ConstantInt::get(Ty64Int, BLOCK_HEADER_SIZE)});
+		auto* dataCond     = llvm::BasicBlock::Create(llCtx, "dataCond", destroyFromFn);
+		auto* dataMain     = llvm::BasicBlock::Create(llCtx, "dataMain", destroyFromFn);
+		auto* instanceCond = llvm::BasicBlock::Create(llCtx, "instanceCond", destroyFromFn);
+		auto* instanceMain = llvm::BasicBlock::Create(llCtx, "instanceMain", destroyFromFn);
+		auto* dataNext     = llvm::BasicBlock::Create(llCtx, "dataNext", destroyFromFn);
+		auto* dataDone     = llvm::BasicBlock::Create(llCtx, "dataDone", destroyFromFn);
+		irCtx->builder.CreateBr(dataCond);
+		irCtx->builder.SetInsertPoint(dataCond);
+		auto* dataOffset = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		dataOffset->addIncoming(offset, entry);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpULT(dataOffset, occupied), dataMain, dataDone);
+		irCtx->builder.SetInsertPoint(dataMain);
+		auto* countPtr = irCtx->builder.CreatePointerCast(
+		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), dataStart, {dataOffset}),
+		    Ty64Int->getPointerTo(addressSpace));
+		auto* count    = irCtx->builder.CreateLoad(Ty64Int, countPtr);
+		auto* typeSize = irCtx->builder.CreateLoad(
+		    Ty64Int, irCtx->builder.CreateInBoundsGEP(Ty64Int, countPtr, {llvm::ConstantInt::get(Ty64Int, 1u)}));
+		auto* destructorType = llvm::FunctionType::get(llvm::Type::getVoidTy(llCtx), {i8PtrTy}, false);
+		auto* dataDestructor = irCtx->builder.CreateLoad(
+		    i8PtrTy, irCtx->builder.CreatePointerCast(
+		                 irCtx->builder.CreateInBoundsGEP(Ty64Int, countPtr, {llvm::ConstantInt::get(Ty64Int, 2u)}),
+		                 i8PtrTy->getPointerTo(addressSpace)));
+		auto* payload = irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), countPtr,
+		                                                 {llvm::ConstantInt::get(Ty64Int, DATA_HEADER_SIZE)});
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(dataDestructor), dataNext, instanceCond);
+		irCtx->builder.SetInsertPoint(instanceCond);
+		auto* instanceIndex = irCtx->builder.CreatePHI(Ty64Int, 2u);
+		instanceIndex->addIncoming(llvm::ConstantInt::get(Ty64Int, 0u), dataMain);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpULT(instanceIndex, count), instanceMain, dataNext);
+		irCtx->builder.SetInsertPoint(instanceMain);
+		irCtx->builder.CreateCall(
+		    destructorType, irCtx->builder.CreatePointerCast(dataDestructor, destructorType->getPointerTo()),
+		    {irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), payload,
+		                                      {irCtx->builder.CreateMul(instanceIndex, typeSize)})});
+		instanceIndex->addIncoming(irCtx->builder.CreateAdd(instanceIndex, llvm::ConstantInt::get(Ty64Int, 1u)),
+		                           instanceMain);
+		irCtx->builder.CreateBr(instanceCond);
+		irCtx->builder.SetInsertPoint(dataNext);
+		dataOffset->addIncoming(
 		    irCtx->builder.CreateAdd(
-		        irCtx->builder.CreateLoad(Ty64Int, lastBlockOccupiedPtr),
-		        irCtx->builder.CreateAdd(reqSize, llvm::ConstantInt::get(Ty64Int, DATA_HEADER_SIZE))),
-		    lastBlockOccupiedPtr);
-		SHOW("Last Block: Returning the got data pointer")
-		irCtx->builder.CreateRet(irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace),
-		                                     lastBlockTargetDestructorPtrPtr, {llvm::ConstantInt::get(Ty64Int, 1u)}),
-		    llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace)));
-		irCtx->builder.SetInsertPoint(newBlockNeededBlock);
-		auto* newBlockSizeCheckTrueBlock  = llvm::BasicBlock::Create(llCtx, "newBlockSizeCheckTrue", ownFn);
-		auto* newBlockSizeCheckFalseBlock = llvm::BasicBlock::Create(llCtx, "newBlockSizeCheckFalse", ownFn);
-		auto* newBlockSizeCheckRestBlock  = llvm::BasicBlock::Create(llCtx, "newBlockSizeCheckRest", ownFn);
-		SHOW("New Block: Size Check")
-		irCtx->builder.CreateCondBr(
-		    irCtx->builder.CreateICmpUGE(
-		        irCtx->builder.CreateAdd(reqSize,
-		                                 llvm::ConstantInt::get(Ty64Int, BLOCK_HEADER_SIZE + DATA_HEADER_SIZE)),
-		        defaultBlockSize),
-		    newBlockSizeCheckTrueBlock, newBlockSizeCheckFalseBlock);
-		irCtx->builder.SetInsertPoint(newBlockSizeCheckTrueBlock);
-		auto* newBlockLargerBlockSize =
-		    irCtx->builder.CreateAdd(reqSize, llvm::ConstantInt::get(Ty64Int, BLOCK_HEADER_SIZE + DATA_HEADER_SIZE));
-		irCtx->builder.CreateBr(newBlockSizeCheckRestBlock);
-		irCtx->builder.SetInsertPoint(newBlockSizeCheckFalseBlock);
-		irCtx->builder.CreateBr(newBlockSizeCheckRestBlock);
-		irCtx->builder.SetInsertPoint(newBlockSizeCheckRestBlock);
-		auto* newBlockSizePhi = irCtx->builder.CreatePHI(Ty64Int, 2u);
-		newBlockSizePhi->addIncoming(newBlockLargerBlockSize, newBlockSizeCheckTrueBlock);
-		newBlockSizePhi->addIncoming(defaultBlockSize, newBlockSizeCheckFalseBlock);
-		// FIXME - Add null check
-		auto* newBlockPtr = irCtx->builder.CreateCall(mallocFn->getFunctionType(), mallocFn, {newBlockSizePhi});
-		auto* lastBlockNextBlockPtrPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt64Ty(llCtx), lastBlockOccupiedPtr,
-		                                     {llvm::ConstantInt::get(Ty64Int, 1u)}),
-		    llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace)->getPointerTo(addressSpace));
-		irCtx->builder.CreateStore(newBlockPtr, lastBlockNextBlockPtrPtr);
-		irCtx->builder.CreateStore(irCtx->builder.CreateAdd(irCtx->builder.CreateLoad(Ty64Int, blockCount),
-		                                                    llvm::ConstantInt::get(Ty64Int, 1u)),
-		                           blockCount, true);
-		auto* newBlockSizePtr = irCtx->builder.CreatePointerCast(newBlockPtr, Ty64Int->getPointerTo());
-		irCtx->builder.CreateStore(newBlockSizePhi, newBlockSizePtr);
-		auto* newBlockOccupiedPtr =
-		    irCtx->builder.CreateInBoundsGEP(Ty64Int, newBlockSizePtr, {llvm::ConstantInt::get(Ty64Int, 1u)});
-		irCtx->builder.CreateStore(irCtx->builder.CreateAdd(reqSize, llvm::ConstantInt::get(Ty64Int, DATA_HEADER_SIZE)),
-		                           newBlockOccupiedPtr);
-		auto* newBlockNextBlockPtrPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(Ty64Int, newBlockOccupiedPtr, {llvm::ConstantInt::get(Ty64Int, 1u)}),
-		    llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace)->getPointerTo(addressSpace));
-		irCtx->builder.CreateStore(
-		    llvm::ConstantPointerNull::get(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace)),
-		    newBlockNextBlockPtrPtr);
-		auto* newDataCountPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace),
-		                                     newBlockNextBlockPtrPtr, {llvm::ConstantInt::get(Ty64Int, 1u)}),
-		    Ty64Int->getPointerTo());
-		irCtx->builder.CreateStore(ownFn->getArg(0), newDataCountPtr);
-		auto* newDataSizePtr =
-		    irCtx->builder.CreateInBoundsGEP(Ty64Int, newDataCountPtr, {llvm::ConstantInt::get(Ty64Int, 1u)});
-		irCtx->builder.CreateStore(ownFn->getArg(1), newDataSizePtr);
-		auto* newDataDestructorPtrPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(Ty64Int, newDataSizePtr, {llvm::ConstantInt::get(Ty64Int, 1u)}),
-		    llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace)->getPointerTo(addressSpace));
-		irCtx->builder.CreateStore(ownFn->getArg(2), newDataDestructorPtrPtr);
-		irCtx->builder.CreateRet(irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace),
-		                                     newDataDestructorPtrPtr, {llvm::ConstantInt::get(Ty64Int, 1u)}),
-		    llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace)));
+		        dataOffset, irCtx->builder.CreateAdd(irCtx->builder.CreateMul(count, typeSize),
+		                                             llvm::ConstantInt::get(Ty64Int, DATA_HEADER_SIZE))),
+		    dataNext);
+		irCtx->builder.CreateBr(dataCond);
+		irCtx->builder.SetInsertPoint(dataDone);
+		irCtx->builder.CreateStore(offset, occupiedPtr);
+		irCtx->builder.CreateRetVoid();
 	}
 	{
 		SHOW("Creating the destructor")
 		auto* entry = llvm::BasicBlock::Create(llCtx, "entry", destructor);
 		irCtx->builder.SetInsertPoint(entry);
-		auto* blockIndex = irCtx->builder.CreateAlloca(Ty64Int, nullptr, "blockIndex");
-		auto* lastBlockPtr =
-		    irCtx->builder.CreateAlloca(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace), nullptr, "lastBlock");
-		auto* dataCursor =
-		    irCtx->builder.CreateAlloca(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace), nullptr, "dataStart");
-		auto* dataInstanceIterator = irCtx->builder.CreateAlloca(Ty64Int, nullptr, "dataInstanceIterator");
-		irCtx->builder.CreateStore(llvm::ConstantInt::get(Ty64Int, 0u), blockIndex);
-		SHOW("Storing the block head pointer to lastBlockPtr")
+		if (threading == RegionThreading::concurrent) {
+			irCtx->builder.CreateAtomicRMW(llvm::AtomicRMWInst::Add, generation, llvm::ConstantInt::get(Ty64Int, 1u),
+			                               llvm::MaybeAlign(), llvm::AtomicOrdering::Monotonic);
+		}
+		auto* headVal = irCtx->builder.CreateLoad(i8PtrTy, blocks);
+		if (threading == RegionThreading::concurrent) {
+			headVal->setAtomic(llvm::AtomicOrdering::Acquire);
+		}
+		auto* blockCond  = llvm::BasicBlock::Create(llCtx, "blockCond", destructor);
+		auto* blockMain  = llvm::BasicBlock::Create(llCtx, "blockMain", destructor);
+		auto* blocksDone = llvm::BasicBlock::Create(llCtx, "blocksDone", destructor);
+		irCtx->builder.CreateBr(blockCond);
+		irCtx->builder.SetInsertPoint(blockCond);
+		auto* currentBlock = irCtx->builder.CreatePHI(i8PtrTy, 2u);
+		currentBlock->addIncoming(headVal, entry);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(currentBlock), blocksDone, blockMain);
+		irCtx->builder.SetInsertPoint(blockMain);
+		irCtx->builder.CreateCall(destroyFromFn->getFunctionType(), destroyFromFn,
+		                          {currentBlock, llvm::ConstantInt::get(Ty64Int, 0u)});
+		auto* nextVal = irCtx->builder.CreateLoad(i8PtrTy, blockField(currentBlock, 2u, i8PtrTy));
+		if (stats != nullptr) {
+			auto* freedSize = irCtx->builder.CreateLoad(Ty64Int, blockField(currentBlock, 0u, Ty64Int));
+			(void)addStat(RegionStat::reservedBytes, irCtx->builder.CreateNeg(freedSize));
+			(void)addStat(RegionStat::blockCount, llvm::ConstantInt::get(Ty64Int, -1, true));
+		}
+		freeBlock(currentBlock);
+		currentBlock->addIncoming(nextVal, irCtx->builder.GetInsertBlock());
+		irCtx->builder.CreateBr(blockCond);
+		irCtx->builder.SetInsertPoint(blocksDone);
+		// The blocks are all freed, so the next allocation starts from an empty region. The other threads of a
+		// concurrent region forget their blocks through the generation, but they should not allocate while it ends
+		auto* headStore  = irCtx->builder.CreateStore(llvm::ConstantPointerNull::get(i8PtrTy), blocks);
+		auto* countStore = irCtx->builder.CreateStore(llvm::ConstantInt::get(Ty64Int, 0u), blockCount);
+		// The chain of a concurrent region is also updated atomically by the slow path of the other threads
+		if (threading == RegionThreading::concurrent) {
+			headStore->setAtomic(llvm::AtomicOrdering::Monotonic);
+			countStore->setAtomic(llvm::AtomicOrdering::Monotonic);
+		}
+		for (auto* fastPathGlobal : {tailBlock, cursor, blockEnd}) {
+			irCtx->builder.CreateStore(llvm::ConstantPointerNull::get(i8PtrTy), fastPathGlobal);
+		}
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the rewind function")
+		// The blocks before the block of the mark are untouched, and every block after it is emptied. A mark of zero
+		// empties all blocks
+		auto* entry = llvm::BasicBlock::Create(llCtx, "entry", rewindFn);
+		irCtx->builder.SetInsertPoint(entry);
+		auto* markVal     = irCtx->builder.CreateIntToPtr(rewindFn->getArg(0u), i8PtrTy);
+		auto* isReset     = irCtx->builder.CreateIsNull(markVal);
+		auto* headVal     = irCtx->builder.CreateLoad(i8PtrTy, blocks);
+		auto* blockCond   = llvm::BasicBlock::Create(llCtx, "blockCond", rewindFn);
+		auto* blockMain   = llvm::BasicBlock::Create(llCtx, "blockMain", rewindFn);
+		auto* emptyBlock  = llvm::BasicBlock::Create(llCtx, "emptyBlock", rewindFn);
+		auto* checkBlock  = llvm::BasicBlock::Create(llCtx, "checkBlock", rewindFn);
+		auto* rewindBlock = llvm::BasicBlock::Create(llCtx, "rewindBlock", rewindFn);
+		auto* nextBlock   = llvm::BasicBlock::Create(llCtx, "nextBlock", rewindFn);
+		auto* blocksDone  = llvm::BasicBlock::Create(llCtx, "blocksDone", rewindFn);
+		auto* resetTail   = llvm::BasicBlock::Create(llCtx, "resetTail", rewindFn);
+		auto* rewindDone  = llvm::BasicBlock::Create(llCtx, "rewindDone", rewindFn);
+		irCtx->builder.CreateBr(blockCond);
+		irCtx->builder.SetInsertPoint(blockCond);
+		auto* currentBlock = irCtx->builder.CreatePHI(i8PtrTy, 2u);
+		auto* isFound      = irCtx->builder.CreatePHI(llvm::Type::getInt1Ty(llCtx), 2u);
+		currentBlock->addIncoming(headVal, entry);
+		isFound->addIncoming(isReset, entry);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateIsNull(currentBlock), blocksDone, blockMain);
+		irCtx->builder.SetInsertPoint(blockMain);
+		irCtx->builder.CreateCondBr(isFound, emptyBlock, checkBlock);
+		irCtx->builder.SetInsertPoint(emptyBlock);
+		irCtx->builder.CreateCall(destroyFromFn->getFunctionType(), destroyFromFn,
+		                          {currentBlock, llvm::ConstantInt::get(Ty64Int, 0u)});
+		irCtx->builder.CreateBr(nextBlock);
+		irCtx->builder.SetInsertPoint(checkBlock);
+		auto* dataStart  = irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), currentBlock,
+		                                                    {llvm::ConstantInt::get(Ty64Int, BLOCK_HEADER_SIZE)});
+		auto* markOffset = irCtx->builder.CreatePtrDiff(llvm::Type::getInt8Ty(llCtx), markVal, dataStart);
+		auto* occupied   = irCtx->builder.CreateLoad(Ty64Int, blockField(currentBlock, 1u, Ty64Int));
+		// A mark is only valid if it is within the occupied part of the block
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateAnd(irCtx->builder.CreateICmpUGE(markVal, dataStart),
+		                                                     irCtx->builder.CreateICmpULE(markOffset, occupied)),
+		                            rewindBlock, nextBlock);
+		irCtx->builder.SetInsertPoint(rewindBlock);
+		irCtx->builder.CreateCall(destroyFromFn->getFunctionType(), destroyFromFn, {currentBlock, markOffset});
+		irCtx->builder.CreateStore(currentBlock, tailBlock);
+		irCtx->builder.CreateStore(markVal, cursor);
+		auto* blockSizeVal = irCtx->builder.CreateLoad(Ty64Int, blockField(currentBlock, 0u, Ty64Int));
 		irCtx->builder.CreateStore(
-		    irCtx->builder.CreateLoad(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace), blocks), lastBlockPtr);
-		auto* hasBlocksBlock = llvm::BasicBlock::Create(llCtx, "hasBlocks", destructor);
-		auto* endBlock       = llvm::BasicBlock::Create(llCtx, "endBlock", destructor);
-		SHOW("Creating condition that block count is non zero and block head pointer is not null")
-		irCtx->builder.CreateCondBr(
-		    irCtx->builder.CreateAnd(
-		        irCtx->builder.CreateICmpNE(irCtx->builder.CreateLoad(Ty64Int, blockCount),
-		                                    llvm::ConstantInt::get(Ty64Int, 0u)),
-		        irCtx->builder.CreateICmpNE(
-		            irCtx->builder.CreatePtrDiff(
-		                llvm::Type::getInt8Ty(llCtx),
-		                irCtx->builder.CreateLoad(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace), blocks),
-		                llvm::ConstantPointerNull::get(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace))),
-		            llvm::ConstantInt::get(Ty64Int, 0u))),
-		    hasBlocksBlock, endBlock);
-		irCtx->builder.SetInsertPoint(hasBlocksBlock);
-		auto* blockLoopMainBlock = llvm::BasicBlock::Create(llCtx, "blockLoopMain", destructor);
-		irCtx->builder.CreateCondBr(irCtx->builder.CreateICmpULT(irCtx->builder.CreateLoad(Ty64Int, blockIndex),
-		                                                         irCtx->builder.CreateLoad(Ty64Int, blockCount)),
-		                            blockLoopMainBlock, endBlock);
-		irCtx->builder.SetInsertPoint(blockLoopMainBlock);
-		SHOW("Getting block data start pointer")
-		auto* blockDataStartPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(
-		        Ty64Int,
-		        irCtx->builder.CreatePointerCast(
-		            irCtx->builder.CreateLoad(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace), lastBlockPtr),
-		            llvm::Type::getInt64Ty(llCtx)->getPointerTo(addressSpace)),
-		        {llvm::ConstantInt::get(Ty64Int, 3u)}),
-		    llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace));
-		SHOW("Initialising data cursor") irCtx->builder.CreateStore(blockDataStartPtr, dataCursor);
-		auto* dataCursorCondBlock = llvm::BasicBlock::Create(llCtx, "dataCursorCond", destructor);
-		auto* dataCursorMainBlock = llvm::BasicBlock::Create(llCtx, "dataCursorMain", destructor);
-		auto* dataCursorRestBlock = llvm::BasicBlock::Create(llCtx, "dataCursorRest", destructor);
-		irCtx->builder.CreateBr(dataCursorCondBlock);
-		irCtx->builder.SetInsertPoint(dataCursorCondBlock);
-		irCtx->builder.CreateCondBr(
-		    irCtx->builder.CreateICmpULT(
-		        irCtx->builder.CreatePtrDiff(
-		            llvm::Type::getInt8Ty(llCtx),
-		            irCtx->builder.CreateLoad(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace), dataCursor),
-		            blockDataStartPtr),
-		        irCtx->builder.CreateLoad(
-		            Ty64Int, irCtx->builder.CreateInBoundsGEP(
-		                         Ty64Int,
-		                         irCtx->builder.CreatePointerCast(
-		                             irCtx->builder.CreateLoad(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace),
-		                                                       lastBlockPtr),
-		                             llvm::Type::getInt64Ty(llCtx)->getPointerTo(addressSpace)),
-		                         {llvm::ConstantInt::get(Ty64Int, 1u)}))),
-		    dataCursorMainBlock, dataCursorRestBlock);
-		irCtx->builder.SetInsertPoint(dataCursorMainBlock);
-		SHOW("Getting data count pointer")
-		auto* dataCountPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateLoad(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace), dataCursor),
-		    llvm::Type::getInt64Ty(llCtx)->getPointerTo(addressSpace));
-		SHOW("Getting data count") auto* dataCount = irCtx->builder.CreateLoad(Ty64Int, dataCountPtr);
-		SHOW("Getting data type size pointer")
-		auto* dataTypeSizePtr =
-		    irCtx->builder.CreateInBoundsGEP(Ty64Int, dataCountPtr, {llvm::ConstantInt::get(Ty64Int, 1u)});
-		auto* dataTypeSize = irCtx->builder.CreateLoad(Ty64Int, dataTypeSizePtr);
-		SHOW("Creating destructor type")
-		auto* destructorType = llvm::FunctionType::get(
-		    llvm::Type::getVoidTy(llCtx), {llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace)}, false);
-		auto* dataDestructorPtrPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(Ty64Int, dataTypeSizePtr, {llvm::ConstantInt::get(Ty64Int, 1u)}),
-		    llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace)->getPointerTo(addressSpace));
-		SHOW("Got destructor pointer ref")
-		auto* dataDestructorPtr = irCtx->builder.CreateBitCast(
-		    irCtx->builder.CreateLoad(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace), dataDestructorPtrPtr),
-		    destructorType->getPointerTo());
-		SHOW("Got destructor pointer")
-		auto* blockStartDataPtr = irCtx->builder.CreatePointerCast(
-		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace),
-		                                     dataDestructorPtrPtr, {llvm::ConstantInt::get(Ty64Int, 1u)}),
-		    llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace));
-		SHOW("Stored 0 in data instance iterator")
-		irCtx->builder.CreateStore(llvm::ConstantInt::get(Ty64Int, 0u), dataInstanceIterator);
-		auto* dataIndexCondBlock = llvm::BasicBlock::Create(llCtx, "dataIndexCondBlock", destructor);
-		auto* dataIndexTrueBlock = llvm::BasicBlock::Create(llCtx, "dataIndexTrueBlock", destructor);
-		auto* dataIndexRestBlock = llvm::BasicBlock::Create(llCtx, "dataIndexRestBlock", destructor);
-		irCtx->builder.CreateBr(dataIndexCondBlock);
-		irCtx->builder.SetInsertPoint(dataIndexCondBlock);
-		SHOW("Creating condition to check data instance index")
-		irCtx->builder.CreateCondBr(
-		    irCtx->builder.CreateAnd(
-		        irCtx->builder.CreateICmpULT(irCtx->builder.CreateLoad(Ty64Int, dataInstanceIterator), dataCount),
-		        irCtx->builder.CreateICmpNE(
-		            irCtx->builder.CreatePtrDiff(
-		                llvm::Type::getInt8Ty(llCtx),
-		                irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), blockStartDataPtr,
-		                                                 {irCtx->builder.CreateLoad(Ty64Int, dataInstanceIterator)}),
-		                llvm::ConstantPointerNull::get(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace))),
-		            llvm::ConstantInt::get(Ty64Int, 0u))),
-		    dataIndexTrueBlock, dataIndexRestBlock);
-		irCtx->builder.SetInsertPoint(dataIndexTrueBlock);
-		SHOW("Getting current instance pointer")
-		auto* currentInstancePtr =
-		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), blockStartDataPtr,
-		                                     {irCtx->builder.CreateLoad(Ty64Int, dataInstanceIterator)});
-		SHOW("Calling destructor") irCtx->builder.CreateCall(destructorType, dataDestructorPtr, {currentInstancePtr});
-		SHOW("Called destructor")
-		irCtx->builder.CreateStore(irCtx->builder.CreateAdd(irCtx->builder.CreateLoad(Ty64Int, dataInstanceIterator),
-		                                                    llvm::ConstantInt::get(Ty64Int, 1u)),
-		                           dataInstanceIterator);
-		SHOW("Incremented data instance iterator") irCtx->builder.CreateBr(dataIndexCondBlock);
-		irCtx->builder.SetInsertPoint(dataIndexRestBlock);
+		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), currentBlock, {blockSizeVal}), blockEnd);
+		irCtx->builder.CreateBr(nextBlock);
+		irCtx->builder.SetInsertPoint(nextBlock);
+		auto* foundNext = irCtx->builder.CreatePHI(llvm::Type::getInt1Ty(llCtx), 3u);
+		foundNext->addIncoming(llvm::ConstantInt::getTrue(llCtx), emptyBlock);
+		foundNext->addIncoming(llvm::ConstantInt::getFalse(llCtx), checkBlock);
+		foundNext->addIncoming(llvm::ConstantInt::getTrue(llCtx), rewindBlock);
+		currentBlock->addIncoming(irCtx->builder.CreateLoad(i8PtrTy, blockField(currentBlock, 2u, i8PtrTy)),
+		                          nextBlock);
+		isFound->addIncoming(foundNext, nextBlock);
+		irCtx->builder.CreateBr(blockCond);
+		irCtx->builder.SetInsertPoint(blocksDone);
+		irCtx->builder.CreateCondBr(irCtx->builder.CreateAnd(isReset, irCtx->builder.CreateIsNotNull(headVal)),
+		                            resetTail, rewindDone);
+		irCtx->builder.SetInsertPoint(resetTail);
+		irCtx->builder.CreateStore(headVal, tailBlock);
 		irCtx->builder.CreateStore(
-		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), blockStartDataPtr,
-		                                     {irCtx->builder.CreateMul(dataCount, dataTypeSize)}),
-		    dataCursor);
-		irCtx->builder.CreateBr(dataCursorCondBlock);
-		irCtx->builder.SetInsertPoint(dataCursorRestBlock);
-		irCtx->builder.CreateStore(irCtx->builder.CreateAdd(irCtx->builder.CreateLoad(Ty64Int, blockIndex),
-		                                                    llvm::ConstantInt::get(Ty64Int, 1u)),
-		                           blockIndex);
-		auto* doneBlockPtr =
-		    irCtx->builder.CreateLoad(llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace), lastBlockPtr);
-		SHOW("Updating last block pointer")
+		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), headVal,
+		                                     {llvm::ConstantInt::get(Ty64Int, BLOCK_HEADER_SIZE)}),
+		    cursor);
 		irCtx->builder.CreateStore(
-		    irCtx->builder.CreateLoad(
-		        llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace),
-		        irCtx->builder.CreatePointerCast(
-		            irCtx->builder.CreateInBoundsGEP(
-		                Ty64Int,
-		                irCtx->builder.CreatePointerCast(lastBlockPtr,
-		                                                 llvm::Type::getInt64Ty(llCtx)->getPointerTo(addressSpace)),
-		                {llvm::ConstantInt::get(Ty64Int, 2u)}),
-		            llvm::Type::getInt8Ty(llCtx)->getPointerTo(addressSpace)->getPointerTo(addressSpace))),
-		    lastBlockPtr);
-		auto  freeName = parent->link_internal_dependency(InternalDependency::free, irCtx, fileRange);
-		auto* freeFn   = parent->get_llvm_module()->getFunction(freeName);
-		irCtx->builder.CreateCall(freeFn->getFunctionType(), freeFn, {doneBlockPtr});
-		SHOW("Called free function") irCtx->builder.CreateBr(hasBlocksBlock);
-		irCtx->builder.SetInsertPoint(endBlock);
+		    irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(llCtx), headVal,
+		                                     {irCtx->builder.CreateLoad(Ty64Int, blockField(headVal, 0u, Ty64Int))}),
+		    blockEnd);
+		irCtx->builder.CreateBr(rewindDone);
+		irCtx->builder.SetInsertPoint(rewindDone);
+		irCtx->builder.CreateRetVoid();
+	}
+	{
+		SHOW("Creating the mark and reset functions")
+		irCtx->builder.SetInsertPoint(llvm::BasicBlock::Create(llCtx, "entry", markFn));
+		irCtx->builder.CreateRet(irCtx->builder.CreatePtrToInt(irCtx->builder.CreateLoad(i8PtrTy, cursor), Ty64Int));
+		irCtx->builder.SetInsertPoint(llvm::BasicBlock::Create(llCtx, "entry", resetFn));
+		irCtx->builder.CreateCall(rewindFn->getFunctionType(), rewindFn, {llvm::ConstantInt::get(Ty64Int, 0u)});
+		irCtx->builder.CreateRetVoid();
+	}
+	if (threadExitFn != nullptr) {
+		irCtx->builder.SetInsertPoint(llvm::BasicBlock::Create(llCtx, "entry", threadExitFn));
+		irCtx->builder.CreateCall(destructor->getFunctionType(), destructor, {});
+		irCtx->builder.CreateRetVoid();
+	}
+	if (stats != nullptr) {
+		SHOW("Creating the functions for the statistics of the region")
+		for (usize i = 0; i < REGION_STAT_COUNT; i++) {
+			irCtx->builder.SetInsertPoint(llvm::BasicBlock::Create(llCtx, "entry", statFns[i]));
+			auto* counter = irCtx->builder.CreateLoad(Ty64Int, statPtr((RegionStat)i));
+			if (threading != RegionThreading::shared) {
+				counter->setAtomic(llvm::AtomicOrdering::Monotonic);
+			}
+			irCtx->builder.CreateRet(counter);
+		}
+		irCtx->builder.SetInsertPoint(llvm::BasicBlock::Create(llCtx, "entry", reportFn));
+		Vec<llvm::Value*> counters;
+		for (usize i = 0; i < REGION_STAT_COUNT; i++) {
+			counters.push_back(irCtx->builder.CreateCall(statFns[i]->getFunctionType(), statFns[i], {}));
+		}
+		// Reserved bytes and the block count are reported before the blocks are freed by the destructor
+		String format = cli::Config::get()->has_region_stats_as_json()
+		                    ? ("{\"region\":\"" + get_full_name() +
+		                       "\",\"requestedBytes\":%llu,\"reservedBytes\":%llu,\"blockCount\":%llu,"
+		                       "\"overheadBytes\":%llu,\"peakBytes\":%llu}\n")
+		                    : ("region " + get_full_name() +
+		                       " -> requested %llu bytes, reserved %llu bytes, blocks %llu, overhead %llu bytes, peak "
+		                       "%llu bytes\n");
+		Vec<llvm::Value*> arguments{irCtx->get_text_constant(format, parent->get_llvm_module())};
+		arguments.insert(arguments.end(), counters.begin(), counters.end());
+		// FIXME - Write to the standard error on Windows, where dprintf is not available
+		auto printDep = triple.isOSWindows() ? InternalDependency::printf : InternalDependency::dprintf;
+		if (not triple.isOSWindows()) {
+			arguments.insert(arguments.begin(), llvm::ConstantInt::get(llvm::Type::getInt32Ty(llCtx), 2u));
+		}
+		auto  printName = parent->link_internal_dependency(printDep, irCtx, fileRange);
+		auto* printFn   = parent->get_llvm_module()->getFunction(printName);
+		irCtx->builder.CreateCall(printFn->getFunctionType(), printFn, arguments);
 		irCtx->builder.CreateRetVoid();
 	}
 }
@@ -470,9 +770,45 @@ ir::Value* Region::ownData(ir::Type* otype, Maybe<llvm::Value*> _count, ir::Ctx*
 }
 
 void Region::destroyObjects(ir::Ctx* irCtx) {
+	if (reportFn != nullptr) {
+		irCtx->builder.CreateCall(reportFn->getFunctionType(), reportFn, {});
+	}
 	irCtx->builder.CreateCall(destructor->getFunctionType(), destructor, {});
 }
 
+ir::Value* Region::get_operation(String const& name, ir::Mod* destMod, ir::Ctx* irCtx) {
+	auto*           u64Ty  = ir::UnsignedType::create(64u, irCtx);
+	auto*           voidTy = ir::VoidType::get(irCtx->llctx);
+	llvm::Function* function;
+	FunctionType*   fnType;
+	if (name == "reset") {
+		function = resetFn;
+		fnType   = FunctionType::create(ReturnType::get(voidTy), {}, irCtx->llctx);
+	} else if (name == "mark") {
+		function = markFn;
+		fnType   = FunctionType::create(ReturnType::get(u64Ty), {}, irCtx->llctx);
+	} else if (name == "rewind") {
+		function = rewindFn;
+		fnType   = FunctionType::create(ReturnType::get(voidTy), {ArgumentType::create_normal(u64Ty, "mark", false)},
+		                                irCtx->llctx);
+	} else {
+		function = statFns[(usize)region_stat_from_string(name).value()];
+		fnType   = FunctionType::create(ReturnType::get(u64Ty), {}, irCtx->llctx);
+	}
+	if (destMod->get_id() != parent->get_id()) {
+		if (not destMod->get_llvm_module()->getFunction(function->getName())) {
+			llvm::Function::Create(function->getFunctionType(), llvm::GlobalValue::LinkageTypes::ExternalLinkage,
+			                       function->getAddressSpace(), function->getName(), destMod->get_llvm_module());
+		}
+		function = destMod->get_llvm_module()->getFunction(function->getName());
+		if (not parent->is_parent_mod_of(destMod)) {
+			destMod->add_dependency(parent);
+		}
+	}
+	return ir::Value::get(function, ir::PtrType::get(false, fnType, true, PtrOwner::of_anonymous(), false, irCtx),
+	                      false);
+}
+
 ir::Mod* Region::get_module() const { return parent; }
 
 void Region::update_overview() { ovInfo._("typeID", get_id())._("fullName", get_full_name()); }
@@ -10,25 +10,144 @@ namespace qat::ir {
 
 class Mod;
 
+/// How the blocks of a region are shared between the threads of the program
+enum class RegionThreading {
+	// One chain of blocks for the whole program, without any synchronisation
+	shared,
+	// Every thread has its own chain of blocks, which is freed when the thread exits
+	local,
+	// One chain of blocks for the whole program, but every thread allocates from a block of its own. New blocks are
+	// added to the chain atomically. Ending the region makes every thread start again from a new block
+	concurrent,
+};
+
+useit inline String region_threading_to_string(RegionThreading threading) {
+	switch (threading) {
+		case RegionThreading::shared:
+			return "shared";
+		case RegionThreading::local:
+			return "local";
+		case RegionThreading::concurrent:
+			return "concurrent";
+	}
+}
+
+useit inline Maybe<RegionThreading> region_threading_from_string(String const& value) {
+	if (value == "shared") {
+		return RegionThreading::shared;
+	} else if (value == "local") {
+		return RegionThreading::local;
+	} else if (value == "concurrent") {
+		return RegionThreading::concurrent;
+	}
+	return None;
+}
+
+/// Where the blocks of a region come from. Mapped blocks avoid the allocator of the C runtime for large regions
+enum class RegionMapping {
+	// The blocks are allocated using malloc
+	none,
+	// The blocks are mapped from the operating system using mmap
+	pages,
+	// Same as pages, but the kernel is advised to back the blocks with transparent huge pages where supported
+	hugePages,
+};
+
+useit inline String region_mapping_to_string(RegionMapping mapping) {
+	switch (mapping) {
+		case RegionMapping::none:
+			return "none";
+		case RegionMapping::pages:
+			return "pages";
+		case RegionMapping::hugePages:
+			return "hugePages";
+	}
+}
+
+useit inline Maybe<RegionMapping> region_mapping_from_string(String const& value) {
+	if (value == "none") {
+		return RegionMapping::none;
+	} else if (value == "pages") {
+		return RegionMapping::pages;
+	} else if (value == "hugePages") {
+		return RegionMapping::hugePages;
+	}
+	return None;
+}
+
+/// The counters kept for every region with `--region-stats`. Reserved bytes and the block count are for the blocks
+/// currently held by the region, and the peak is the highest number of reserved bytes
+enum class RegionStat : u8 {
+	requestedBytes,
+	reservedBytes,
+	blockCount,
+	overheadBytes,
+	peakBytes,
+};
+
+constexpr usize REGION_STAT_COUNT = 5u;
+
+useit inline String region_stat_to_string(RegionStat stat) {
+	switch (stat) {
+		case RegionStat::requestedBytes:
+			return "requested_bytes";
+		case RegionStat::reservedBytes:
+			return "reserved_bytes";
+		case RegionStat::blockCount:
+			return "block_count";
+		case RegionStat::overheadBytes:
+			return "overhead_bytes";
+		case RegionStat::peakBytes:
+			return "peak_bytes";
+	}
+}
+
+useit inline Maybe<RegionStat> region_stat_from_string(String const& value) {
+	for (usize i = 0; i < REGION_STAT_COUNT; i++) {
+		if (region_stat_to_string((RegionStat)i) == value) {
+			return (RegionStat)i;
+		}
+	}
+	return None;
+}
+
 class Region : public Type, public EntityOverview {
   private:
-	Identifier     name;
-	usize          blockSize;
-	Mod*           parent;
-	VisibilityInfo visibInfo;
-	FileRange      fileRange;
+	Identifier      name;
+	usize           blockSize;
+	u64             growth;
+	RegionThreading threading;
+	RegionMapping   mapping;
+	Mod*            parent;
+	VisibilityInfo  visibInfo;
+	FileRange       fileRange;
 
 	llvm::GlobalVariable* blocks;
 	llvm::GlobalVariable* blockCount;
+	llvm::GlobalVariable* tailBlock;
+	llvm::GlobalVariable* cursor;
+	llvm::GlobalVariable* blockEnd;
+	llvm::GlobalVariable* generation;
+	llvm::GlobalVariable* threadGeneration;
+	llvm::GlobalVariable* exitRegistered;
 	llvm::Function*       ownFn;
+	llvm::Function*       ownSlowFn;
 	llvm::Function*       destructor;
+	llvm::Function*       threadExitFn;
+	llvm::Function*       destroyFromFn;
+	llvm::Function*       markFn;
+	llvm::Function*       rewindFn;
+	llvm::Function*       resetFn;
+	llvm::GlobalVariable* stats;
+	Vec<llvm::Function*>  statFns;
+	llvm::Function*       reportFn;
 
   public:
-	Region(Identifier _name, usize _blockSize, Mod* _module, const VisibilityInfo& visibInfo, ir::Ctx* irCtx,
-	       FileRange fileRange);
+	Region(Identifier _name, usize _blockSize, u64 _growth, RegionThreading _threading, RegionMapping _mapping,
+	       Mod* _module, const VisibilityInfo& visibInfo, ir::Ctx* irCtx, FileRange fileRange);
 
-	static Region* get(Identifier name, usize blockSize, Mod* parent, const VisibilityInfo& visibInfo, ir::Ctx* irCtx,
-	                   FileRange fileRange);
+	static Region* get(Identifier name, usize blockSize, u64 growth, RegionThreading threading, RegionMapping mapping,
+	                   Mod* parent, const VisibilityInfo& visibInfo, ir::Ctx* irCtx, FileRange fileRange);
 
 	useit Identifier get_name() const;
 
@@ -36,6 +155,24 @@ class Region : public Type, public EntityOverview {
 
 	useit usize get_block_size() const { return blockSize; }
 
+	useit u64 get_growth() const { return growth; }
+
+	useit RegionThreading get_threading() const { return threading; }
+
+	useit RegionMapping get_mapping() const { return mapping; }
+
+	useit bool has_stats() const { return stats != nullptr; }
+
+	useit static bool has_operation(String const& name) {
+		return (name == "reset") || (name == "mark") || (name == "rewind") || region_stat_from_string(name).has_value();
+	}
+
+	/// Provides `reset`, `mark` or `rewind` of the region as a function pointer that can be called in the provided
+	/// module. `mark` gives the current position in the region, and `rewind` destroys everything owned after the
+	/// position, keeping the blocks for later allocations. `reset` is the same as rewinding to the start. The counters
+	/// of `--region-stats` are also provided as functions, by the names in `region_stat_to_string`
+	useit ir::Value* get_operation(String const& name, ir::Mod* destMod, ir::Ctx* irCtx);
+
 	useit ir::Mod* get_module() const;
 
 	useit ir::Value* ownData(ir::Type* _type, Maybe<llvm::Value*> count, ir::Ctx* irCtx);
@@ -22,8 +22,10 @@ StructType::StructType(Mod* mod, Identifier _name, Vec<GenericArgument*> _generi
       opaquedType(_opaqued), members(std::move(_members)), metaInfo(_metaInfo) {
 	SHOW("Generating LLVM Type for struct type members")
 	Vec<llvm::Type*> subtypes;
-	for (auto* mem : members) {
-		subtypes.push_back(mem->type->get_llvm_type());
+	fieldIndex.reserve(members.size());
+	for (usize i = 0; i < members.size(); i++) {
+		subtypes.push_back(members[i]->type->get_llvm_type());
+		fieldIndex.emplace(members[i]->name.value, i);
 	}
 	metaInfo = opaquedType->metaInfo;
 	SHOW("All members' LLVM types obtained")
@@ -122,80 +124,39 @@ u64 StructType::get_field_count() const { return members.size(); }
 
 Vec<StructField*>& StructType::get_members() { return members; }
 
-bool StructType::has_field_with_name(const String& member) const {
-	for (auto* mem : members) {
-		if (mem->name.value == member) {
-			return true;
-		}
-	}
-	return false;
-}
+bool StructType::has_field_with_name(const String& member) const { return fieldIndex.contains(member); }
 
 StructField* StructType::get_field_with_name(const String& member) const {
-	for (auto* mem : members) {
-		if (mem->name.value == member) {
-			return mem;
-		}
-	}
-	return nullptr;
+	auto entry = fieldIndex.find(member);
+	return (entry != fieldIndex.end()) ? members.at(entry->second) : nullptr;
 }
 
 StructField* StructType::get_field_at(u64 index) { return members.at(index); }
 
 Maybe<usize> StructType::get_index_of(const String& member) const {
-	Maybe<usize> result;
-	for (usize i = 0; i < members.size(); i++) {
-		if (members.at(i)->name.value == member) {
-			result = i;
-			break;
-		}
+	auto entry = fieldIndex.find(member);
+	if (entry != fieldIndex.end()) {
+		return entry->second;
 	}
-	return result;
+	return None;
 }
 
 String StructType::get_field_name_at(u64 index) const {
 	return (index < members.size()) ? members.at(index)->name.value : "";
 }
 
-usize StructType::get_field_index(String const& memName) const {
-	for (usize i = 0; i < members.size(); i++) {
-		if (members[i]->name.value == memName) {
-			return i;
-		}
-	}
-}
+usize StructType::get_field_index(String const& memName) const { return fieldIndex.at(memName); }
 
 Type* StructType::get_type_of_field(const String& member) const {
-	Maybe<usize> result;
-	for (usize i = 0; i < members.size(); i++) {
-		if (members.at(i)->name.value == member) {
-			result = i;
-			break;
-		}
-	}
-	if (result) {
-		return members.at(result.value())->type;
-	} else {
-		return nullptr;
-	}
+	auto entry = fieldIndex.find(member);
+	return (entry != fieldIndex.end()) ? members.at(entry->second)->type : nullptr;
 }
 
-bool StructType::has_static_field(const String& _name) const {
-	for (auto* stm : staticMembers) {
-		if (stm->get_name().value == _name) {
-			return true;
-		}
-	}
-	return false;
-}
+bool StructType::has_static_field(const String& _name) const { return staticFieldIndex.contains(_name); }
 
 StaticMember* StructType::get_static_field(String const& name) const {
-	for (auto* stm : staticMembers) {
-		if (stm->get_name().value == name) {
-			return stm;
-		}
-	}
-	return nullptr;
+	auto entry = staticFieldIndex.find(name);
+	return (entry != staticFieldIndex.end()) ? entry->second : nullptr;
 }
 
 bool StructType::is_type_sized() const { return not members.empty(); }
@@ -415,6 +376,7 @@ void StructType::destroy_value(ir::Ctx* irCtx, ir::Value* instance, ir::Function
 void StructType::add_static_member(Identifier const& name, Type* type, bool variability, Value* initial,
                                    VisibilityInfo const& visibility, llvm::LLVMContext& llctx) {
 	staticMembers.push_back(StaticMember::get(this, name, type, variability, initial, visibility));
+	staticFieldIndex.emplace(name.value, staticMembers.back());
 }
 
 TypeKind StructType::type_kind() const { return TypeKind::STRUCT; }
@@ -489,13 +451,7 @@ Type* GenericStructType::fill_generics(Vec<GenericToFill*>& toFillTypes, ir::Ctx
 	auto* ctx = ast::EmitCtx::get(irCtx, parent);
 	ir::fill_generics(ctx, generics, toFillTypes, range);
 	if (constraint != nullptr) {
-		auto checkVal = constraint->emit(ctx);
-		if (not checkVal->get_ir_type()->is_bool()) {
-			irCtx->Error("The constraints for generic parameters should be of " + irCtx->color("bool") +
-			                 " type. Got an expression of " + irCtx->color(checkVal->get_ir_type()->to_string()),
-			             constraint->fileRange);
-		}
-		if (not llvm::cast<llvm::ConstantInt>(checkVal->get_llvm_constant())->getValue().getBoolValue()) {
+		if (not ir::evaluate_constraint(ctx, constraint, parent, name)) {
 			irCtx->Error("The provided parameters for the generic struct type do not satisfy the constraints", range,
 			             Pair<String, FileRange>{"The constraint can be found here", constraint->fileRange});
 		}
@@ -12,6 +12,7 @@
 
 #include <llvm/IR/LLVMContext.h>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -60,6 +61,9 @@ class StructType final : public ExpandedType, public EntityOverview {
 	Vec<StaticMember*> staticMembers;
 	Maybe<MetaInfo>    metaInfo;
 
+	std::unordered_map<String, usize>         fieldIndex;
+	std::unordered_map<String, StaticMember*> staticFieldIndex;
+
   public:
 	StructType(Mod* mod, Identifier _name, Vec<GenericArgument*> _generics, ir::OpaqueType* _opaqued,
 	           Vec<StructField*> _members, const VisibilityInfo& _visibility, llvm::LLVMContext& llctx,
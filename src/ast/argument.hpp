@@ -35,15 +35,15 @@ class Argument {
 	    : isVar(_isVar), name(_name), type(_type), kind(_kind) {}
 
 	useit static Argument* create_normal(Identifier name, bool isVar, Type* type) {
-		return std::construct_at(OwnNormal(Argument), ArgKind::NORMAL, name, isVar, type);
+		return std::construct_at(OwnAST(Argument), ArgKind::NORMAL, name, isVar, type);
 	}
 
 	useit static Argument* create_member(Identifier name, bool isVar, Type* type) {
-		return std::construct_at(OwnNormal(Argument), ArgKind::MEMBER, name, isVar, type);
+		return std::construct_at(OwnAST(Argument), ArgKind::MEMBER, name, isVar, type);
 	}
 
 	useit static Argument* create_variadic(FileRange range) {
-		return std::construct_at(OwnNormal(Argument), ArgKind::VARIADIC, Identifier{"", range}, false, nullptr);
+		return std::construct_at(OwnAST(Argument), ArgKind::VARIADIC, Identifier{"", range}, false, nullptr);
 	}
 
 	useit Identifier get_name() const { return name; }
@@ -14,7 +14,7 @@ class BringBitwidths : public Node {
 	    : Node(_fileRange), broughtTypes(_broughtTypes) {}
 
 	useit static BringBitwidths* create(Vec<ast::Type*> _broughtTypes, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(BringBitwidths), _broughtTypes, _fileRange);
+		return std::construct_at(OwnAST(BringBitwidths), _broughtTypes, _fileRange);
 	}
 
 	void           create_module(ir::Mod* mod, ir::Ctx* irCtx) const final;
@@ -26,7 +26,7 @@ class BroughtGroup {
 	    : relative(_relative), entity(std::move(_entity)), alias(std::move(_alias)), fileRange(std::move(_fileRange)) {}
 
 	useit static BroughtGroup* create(u32 relative, Vec<Identifier> parent, Maybe<Identifier> alias, FileRange range) {
-		return std::construct_at(OwnNormal(BroughtGroup), relative, std::move(parent), std::move(alias),
+		return std::construct_at(OwnAST(BroughtGroup), relative, std::move(parent), std::move(alias),
 		                         std::move(range));
 	}
 
@@ -51,7 +51,7 @@ class BringEntities final : public IsEntity {
 
 	useit static BringEntities* create(Vec<BroughtGroup*> _entities, Maybe<VisibilitySpec> _visibSpec,
 	                                   FileRange _fileRange) {
-		return std::construct_at(OwnNormal(BringEntities), _entities, _visibSpec, _fileRange);
+		return std::construct_at(OwnAST(BringEntities), _entities, _visibSpec, _fileRange);
 	}
 
 	void create_entity(ir::Mod* mod, ir::Ctx* irCtx) final;
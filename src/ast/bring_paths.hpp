@@ -19,7 +19,7 @@ class BringPaths final : public Node {
 
 	useit static BringPaths* create(bool _isMember, Vec<StringLiteral*> _paths, Vec<Maybe<StringLiteral*>> _names,
 	                                Maybe<VisibilitySpec> _visibSpec, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(BringPaths), _isMember, _paths, _names, _visibSpec, _fileRange);
+		return std::construct_at(OwnAST(BringPaths), _isMember, _paths, _names, _visibSpec, _fileRange);
 	}
 
 	void handle_fs_brings(ir::Mod* mod, ir::Ctx* irCtx) const final;
@@ -48,25 +48,25 @@ class ConstructorPrototype {
 	static ConstructorPrototype* Normal(FileRange nameRange, Vec<Argument*> args, Maybe<VisibilitySpec> visibSpec,
 	                                    FileRange fileRange, PrerunExpression* defineChecker,
 	                                    Maybe<MetaInfo> metaInfo) {
-		return std::construct_at(OwnNormal(ConstructorPrototype), ConstructorType::normal, nameRange, std::move(args),
+		return std::construct_at(OwnAST(ConstructorPrototype), ConstructorType::normal, nameRange, std::move(args),
 		                         visibSpec, std::move(fileRange), None, defineChecker, metaInfo);
 	}
 
 	static ConstructorPrototype* Default(Maybe<VisibilitySpec> visibSpec, FileRange nameRange, FileRange fileRange,
 	                                     PrerunExpression* defineChecker, Maybe<MetaInfo> metaInfo) {
-		return std::construct_at(OwnNormal(ConstructorPrototype), ConstructorType::Default, nameRange, Vec<Argument*>{},
+		return std::construct_at(OwnAST(ConstructorPrototype), ConstructorType::Default, nameRange, Vec<Argument*>{},
 		                         visibSpec, std::move(fileRange), None, defineChecker, metaInfo);
 	}
 
 	static ConstructorPrototype* Copy(Maybe<VisibilitySpec> visibSpec, FileRange nameRange, FileRange fileRange,
 	                                  Identifier _argName, PrerunExpression* defineChecker, Maybe<MetaInfo> metaInfo) {
-		return std::construct_at(OwnNormal(ConstructorPrototype), ConstructorType::copy, nameRange, Vec<Argument*>{},
+		return std::construct_at(OwnAST(ConstructorPrototype), ConstructorType::copy, nameRange, Vec<Argument*>{},
 		                         visibSpec, std::move(fileRange), _argName, defineChecker, metaInfo);
 	}
 
 	static ConstructorPrototype* Move(Maybe<VisibilitySpec> visibSpec, FileRange nameRange, FileRange fileRange,
 	                                  Identifier _argName, PrerunExpression* defineChecker, Maybe<MetaInfo> metaInfo) {
-		return std::construct_at(OwnNormal(ConstructorPrototype), ConstructorType::move, nameRange, Vec<Argument*>{},
+		return std::construct_at(OwnAST(ConstructorPrototype), ConstructorType::move, nameRange, Vec<Argument*>{},
 		                         visibSpec, std::move(fileRange), _argName, defineChecker, metaInfo);
 	}
 
@@ -100,7 +100,7 @@ class ConstructorDefinition {
 
 	useit static ConstructorDefinition* create(ConstructorPrototype* _prototype, Vec<Sentence*> _sentences,
 	                                           FileRange _fileRange) {
-		return std::construct_at(OwnNormal(ConstructorDefinition), _prototype, _sentences, _fileRange);
+		return std::construct_at(OwnAST(ConstructorDefinition), _prototype, _sentences, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) {
@@ -43,14 +43,14 @@ class ConvertorPrototype {
 	                                       bool _is_member_argument, Maybe<VisibilitySpec> _visibSpec,
 	                                       const FileRange& _fileRange, PrerunExpression* _defineCondition,
 	                                       Maybe<MetaInfo> _metaInfo) {
-		return std::construct_at(OwnNormal(ConvertorPrototype), true, _nameRange, _argName, _candidateType,
+		return std::construct_at(OwnAST(ConvertorPrototype), true, _nameRange, _argName, _candidateType,
 		                         _is_member_argument, _visibSpec, _fileRange, _defineCondition, std::move(_metaInfo));
 	}
 
 	static ConvertorPrototype* create_to(FileRange _nameRange, Type* _candidateType, Maybe<VisibilitySpec> _visibSpec,
 	                                     const FileRange& _fileRange, PrerunExpression* _defineCondition,
 	                                     Maybe<MetaInfo> _metaInfo) {
-		return std::construct_at(OwnNormal(ConvertorPrototype), false, _nameRange, None, _candidateType, false,
+		return std::construct_at(OwnAST(ConvertorPrototype), false, _nameRange, None, _candidateType, false,
 		                         _visibSpec, _fileRange, _defineCondition, std::move(_metaInfo));
 	}
 
@@ -86,7 +86,7 @@ class ConvertorDefinition {
 
 	useit static ConvertorDefinition* create(ConvertorPrototype* _prototype, Vec<Sentence*> _sentences,
 	                                         FileRange _fileRange) {
-		return std::construct_at(OwnNormal(ConvertorDefinition), _prototype, _sentences, _fileRange);
+		return std::construct_at(OwnAST(ConvertorDefinition), _prototype, _sentences, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) {
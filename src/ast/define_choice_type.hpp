@@ -29,7 +29,7 @@ class DefineChoiceType : public IsEntity {
 	                                      Vec<Pair<Vec<Identifier>, Maybe<ast::PrerunExpression*>>> _fields,
 	                                      Maybe<ast::Type*> _providedTy, Maybe<usize> _defaultVal,
 	                                      Maybe<VisibilitySpec> _visibSpec, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(DefineChoiceType), _name, _fields, _providedTy, _defaultVal, _visibSpec,
+		return std::construct_at(OwnAST(DefineChoiceType), _name, _fields, _providedTy, _defaultVal, _visibSpec,
 		                         _fileRange);
 	}
 
@@ -28,7 +28,7 @@ class DefineFlagType final : public IsEntity {
 
 	useit static DefineFlagType* create(Identifier name, Vec<FlagVariant> variants, Type* providedType,
 	                                    Maybe<VisibilitySpec> visibSpec, FileRange range) {
-		return std::construct_at(OwnNormal(DefineFlagType), std::move(name), std::move(variants), providedType,
+		return std::construct_at(OwnAST(DefineFlagType), std::move(name), std::move(variants), providedType,
 		                         std::move(visibSpec), std::move(range));
 	}
 
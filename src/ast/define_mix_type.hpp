@@ -34,7 +34,7 @@ class DefineMixType final : public IsEntity {
 	                                   Vec<Pair<Identifier, Maybe<Type*>>> _subTypes, Vec<FileRange> _ranges,
 	                                   Maybe<usize> _defaultVal, bool _isPacked, Maybe<VisibilitySpec> _visibSpec,
 	                                   FileRange _fileRange) {
-		return std::construct_at(OwnNormal(DefineMixType), _name, _defineChecker, _genericConstraint, _subTypes,
+		return std::construct_at(OwnAST(DefineMixType), _name, _defineChecker, _genericConstraint, _subTypes,
 		                         _ranges, _defaultVal, _isPacked, _visibSpec, _fileRange);
 	}
 
@@ -22,7 +22,7 @@ class DefineOpaqueType final : public IsEntity {
 	useit static DefineOpaqueType* create(Identifier _name, Maybe<PrerunExpression*> _condition,
 	                                      Maybe<VisibilitySpec> _visibSpec, Maybe<MetaInfo> _metaInfo,
 	                                      FileRange _fileRange) {
-		return std::construct_at(OwnNormal(DefineOpaqueType), _name, _condition, _visibSpec, _metaInfo, _fileRange);
+		return std::construct_at(OwnAST(DefineOpaqueType), _name, _condition, _visibSpec, _metaInfo, _fileRange);
 	}
 
 	void create_entity(ir::Mod* parent, ir::Ctx* irCtx) final;
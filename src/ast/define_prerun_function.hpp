@@ -26,7 +26,7 @@ class DefinePrerunFunction : public IsEntity {
 	useit static DefinePrerunFunction* create(Identifier name, Type* returnType, Vec<Argument*> arguments,
 	                                          PrerunExpression* defineChecker, Vec<PrerunSentence*> sentences,
 	                                          Maybe<VisibilitySpec> visibSpec, FileRange fileRange) {
-		return std::construct_at(OwnNormal(DefinePrerunFunction), std::move(name), returnType, std::move(arguments),
+		return std::construct_at(OwnAST(DefinePrerunFunction), std::move(name), returnType, std::move(arguments),
 		                         defineChecker, std::move(sentences), visibSpec, std::move(fileRange));
 	}
 
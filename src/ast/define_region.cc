@@ -1,6 +1,7 @@
 #include "./define_region.hpp"
 #include "../IR/logic.hpp"
 #include "../IR/types/region.hpp"
+#include "../IR/types/text.hpp"
 #include "./emit_ctx.hpp"
 #include "./expression.hpp"
 #include "./node.hpp"
@@ -14,33 +15,83 @@ void DefineRegion::create_entity(ir::Mod* mod, ir::Ctx* irCtx) {
 }
 
 void DefineRegion::update_entity_dependencies(ir::Mod* mod, ir::Ctx* irCtx) {
-	if (blockSize) {
-		blockSize->update_dependencies(ir::EmitPhase::phase_1, ir::DependType::complete, entityState,
-		                               EmitCtx::get(irCtx, mod));
+	for (auto* attribute : {blockSize, growth, threading, mapping}) {
+		if (attribute) {
+			attribute->update_dependencies(ir::EmitPhase::phase_1, ir::DependType::complete, entityState,
+			                               EmitCtx::get(irCtx, mod));
+		}
 	}
 }
 
 void DefineRegion::do_phase(ir::EmitPhase phase, ir::Mod* mod, ir::Ctx* irCtx) {
-	usize blockSizeResult = 4096;
-	auto  ctx             = EmitCtx::get(irCtx, mod);
-	if (blockSize) {
-		if (blockSize->has_type_inferrance()) {
-			blockSize->as_type_inferrable()->set_inference_type(ir::UnsignedType::create(64u, irCtx));
-		}
-		auto blRes = blockSize->emit(ctx);
-		if ((not blRes->get_ir_type()->is_unsigned()) || (blRes->get_ir_type()->as_unsigned()->get_bitwidth() != 64u)) {
-			irCtx->Error("The value provided has a type of " + irCtx->color(blRes->get_ir_type()->to_string()) +
-			                 ", but the block size is expected to be of " + irCtx->color("u64") + " type",
-			             blockSize->fileRange);
+	auto ctx = EmitCtx::get(irCtx, mod);
+	// Both the block size and the growth factor are u64 values that cannot be zero
+	auto emitSize = [&](PrerunExpression* attribute, String const& attrName, u64 defaultValue) -> u64 {
+		if (not attribute) {
+			return defaultValue;
 		}
-	}
-	(void)ir::Region::get(name, blockSizeResult, mod, ctx->get_visibility_info(visibSpec), irCtx, fileRange);
+		if (attribute->has_type_inferrance()) {
+			attribute->as_type_inferrable()->set_inference_type(ir::UnsignedType::create(64u, irCtx));
+		}
+		auto attrRes = attribute->emit(ctx);
+		if ((not attrRes->get_ir_type()->is_unsigned()) ||
+		    (attrRes->get_ir_type()->as_unsigned()->get_bitwidth() != 64u)) {
+			irCtx->Error("The value provided has a type of " + irCtx->color(attrRes->get_ir_type()->to_string()) +
+			                 ", but the " + attrName + " is expected to be of " + irCtx->color("u64") + " type",
+			             attribute->fileRange);
+		}
+		auto result = llvm::cast<llvm::ConstantInt>(attrRes->get_llvm_constant())->getZExtValue();
+		if (result == 0u) {
+			irCtx->Error("The " + attrName + " of the region cannot be zero", attribute->fileRange);
+		}
+		return result;
+	};
+	// Both the threading and the mapping are text values, one of the provided options
+	auto emitOption = [&](PrerunExpression* attribute, String const& attrName,
+	                      Vec<String> const& options) -> Maybe<String> {
+		if (not attribute) {
+			return None;
+		}
+		auto attrRes = attribute->emit(ctx);
+		if (not attrRes->get_ir_type()->is_text()) {
+			irCtx->Error("The value provided has a type of " + irCtx->color(attrRes->get_ir_type()->to_string()) +
+			                 ", but the " + attrName + " of the region is expected to be of " + irCtx->color("text") +
+			                 " type",
+			             attribute->fileRange);
+		}
+		auto result = ir::TextType::value_to_string(attrRes->as_prerun());
+		if (std::find(options.begin(), options.end(), result) == options.end()) {
+			String optionsText;
+			for (usize i = 0; i < options.size(); i++) {
+				optionsText += ((i == 0) ? "" : ((i + 1 == options.size()) ? " or " : ", ")) + irCtx->color(options[i]);
+			}
+			irCtx->Error("The " + attrName + " of the region is expected to be one of " + optionsText,
+			             attribute->fileRange);
+		}
+		return result;
+	};
+	auto blockSizeResult = emitSize(blockSize, "block size", 4096u);
+	auto growthResult    = emitSize(growth, "growth factor", 1u);
+	auto threadingResult = emitOption(threading, "threading", {"shared", "local", "concurrent"});
+	auto mappingResult   = emitOption(mapping, "mapping", {"none", "pages", "hugePages"});
+	(void)ir::Region::get(name, blockSizeResult, growthResult,
+	                      ir::region_threading_from_string(threadingResult.value_or("shared")).value(),
+	                      ir::region_mapping_from_string(mappingResult.value_or("none")).value(), mod,
+	                      ctx->get_visibility_info(visibSpec), irCtx, fileRange);
 }
 
 Json DefineRegion::to_json() const {
 	return Json()
 	    ._("nodeType", "defineRegion")
 	    ._("name", name)
+	    ._("hasBlockSize", blockSize != nullptr)
+	    ._("blockSize", blockSize ? blockSize->to_json() : JsonValue())
+	    ._("hasGrowth", growth != nullptr)
+	    ._("growth", growth ? growth->to_json() : JsonValue())
+	    ._("hasThreading", threading != nullptr)
+	    ._("threading", threading ? threading->to_json() : JsonValue())
+	    ._("hasMapping", mapping != nullptr)
+	    ._("mapping", mapping ? mapping->to_json() : JsonValue())
 	    ._("hasVisibility", visibSpec.has_value())
 	    ._("visibility", visibSpec.has_value() ? visibSpec->to_json() : JsonValue())
 	    ._("fileRange", fileRange);
@@ -10,15 +10,23 @@ class DefineRegion : public IsEntity {
   private:
 	Identifier            name;
 	PrerunExpression*     blockSize;
+	PrerunExpression*     growth;
+	PrerunExpression*     threading;
+	PrerunExpression*     mapping;
 	Maybe<VisibilitySpec> visibSpec;
 
   public:
-	DefineRegion(Identifier _name, PrerunExpression* _blockSize, Maybe<VisibilitySpec> _visibSpec, FileRange _fileRange)
-	    : IsEntity(_fileRange), name(_name), blockSize(_blockSize), visibSpec(_visibSpec) {}
-
-	useit static DefineRegion* create(Identifier name, PrerunExpression* blockSize, Maybe<VisibilitySpec> visibSpec,
-	                                  FileRange fileRange) {
-		return std::construct_at(OwnNormal(DefineRegion), name, blockSize, visibSpec, fileRange);
+	DefineRegion(Identifier _name, PrerunExpression* _blockSize, PrerunExpression* _growth,
+	             PrerunExpression* _threading, PrerunExpression* _mapping, Maybe<VisibilitySpec> _visibSpec,
+	             FileRange _fileRange)
+	    : IsEntity(_fileRange), name(_name), blockSize(_blockSize), growth(_growth), threading(_threading),
+	      mapping(_mapping), visibSpec(_visibSpec) {}
+
+	useit static DefineRegion* create(Identifier name, PrerunExpression* blockSize, PrerunExpression* growth,
+	                                  PrerunExpression* threading, PrerunExpression* mapping,
+	                                  Maybe<VisibilitySpec> visibSpec, FileRange fileRange) {
+		return std::construct_at(OwnAST(DefineRegion), name, blockSize, growth, threading, mapping, visibSpec,
+		                         fileRange);
 	}
 
 	void create_entity(ir::Mod* mod, ir::Ctx* irCtx) final;
@@ -110,7 +110,7 @@ class DefineSkill final : public IsEntity {
 	                                 Maybe<VisibilitySpec> visibSpec, Vec<SkillTypeDefinition> typeDefs,
 	                                 Vec<SkillMethod> methods, PrerunExpression* defineChecker,
 	                                 PrerunExpression* genericConstraint, FileRange fileRange) {
-		return std::construct_at(OwnNormal(DefineSkill), std::move(name), std::move(generics), visibSpec,
+		return std::construct_at(OwnAST(DefineSkill), std::move(name), std::move(generics), visibSpec,
 		                         std::move(typeDefs), std::move(methods), defineChecker, genericConstraint,
 		                         std::move(fileRange));
 	}
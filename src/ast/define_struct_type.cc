@@ -318,6 +318,8 @@ void DefineStructType::do_define(ir::StructType* resultTy, ir::Mod* mod, ir::Ctx
 		oFn->define(state, irCtx);
 		parentState->operators.push_back(state);
 	}
+	// All members of the type are known at this point
+	resultTy->build_method_index();
 }
 
 void DefineStructType::create_entity(ir::Mod* mod, ir::Ctx* irCtx) {
@@ -22,7 +22,7 @@ class DefineStructType final : public IsEntity, public Commentable, public Membe
 
 		useit static Member* create(Type* _type, Identifier _name, bool _variability, Maybe<VisibilitySpec> _visibSpec,
 		                            Maybe<Expression*> _expression, FileRange _fileRange) {
-			return std::construct_at(OwnNormal(Member), _type, _name, _variability, _visibSpec, _expression,
+			return std::construct_at(OwnAST(Member), _type, _name, _variability, _visibSpec, _expression,
 			                         _fileRange);
 		}
 
@@ -45,7 +45,7 @@ class DefineStructType final : public IsEntity, public Commentable, public Membe
 
 		useit static StaticMember* create(Type* _type, Identifier _name, bool _variability, Expression* _value,
 		                                  Maybe<VisibilitySpec> _visibSpec, FileRange _fileRange) {
-			return std::construct_at(OwnNormal(StaticMember), _type, _name, _variability, _value, _visibSpec,
+			return std::construct_at(OwnAST(StaticMember), _type, _name, _variability, _value, _visibSpec,
 			                         _fileRange);
 		}
 
@@ -92,7 +92,7 @@ class DefineStructType final : public IsEntity, public Commentable, public Membe
 	                                      Maybe<VisibilitySpec> _visibSpec, FileRange _fileRange,
 	                                      Vec<ast::GenericAbstractType*> _generics, PrerunExpression* _constraint,
 	                                      Maybe<MetaInfo> _metaInfo) {
-		return std::construct_at(OwnNormal(DefineStructType), _name, _checker, _visibSpec, _fileRange, _generics,
+		return std::construct_at(OwnAST(DefineStructType), _name, _checker, _visibSpec, _fileRange, _generics,
 		                         _constraint, _metaInfo);
 	}
 
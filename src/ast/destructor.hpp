@@ -32,7 +32,7 @@ class DestructorDefinition {
 	useit static DestructorDefinition* create(FileRange nameRange, PrerunExpression* _defineChecker,
 	                                          Maybe<MetaInfo> metaInfo, Vec<Sentence*> _sentences,
 	                                          FileRange fileRange) {
-		return std::construct_at(OwnNormal(DestructorDefinition), nameRange, _defineChecker, std::move(metaInfo),
+		return std::construct_at(OwnAST(DestructorDefinition), nameRange, _defineChecker, std::move(metaInfo),
 		                         std::move(_sentences), fileRange);
 	}
 
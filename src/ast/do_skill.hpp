@@ -21,7 +21,7 @@ class DoSkill final : public IsEntity, public MemberParentLike {
 	    : IsEntity(_fileRange), isDefaultSkill(_isDef), name(_name), targetType(_targetType) {}
 
 	useit static DoSkill* create(bool _isDef, Maybe<SkillEntity> _name, ast::Type* _targetType, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(DoSkill), _isDef, _name, _targetType, _fileRange);
+		return std::construct_at(OwnAST(DoSkill), _isDef, _name, _targetType, _fileRange);
 	}
 
 	void create_entity(ir::Mod* parent, ir::Ctx* irCtx) final;
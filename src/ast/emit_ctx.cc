@@ -342,6 +342,22 @@ void EmitCtx::Error(const String& message, Maybe<FileRange> fileRange, Maybe<Pai
 	irCtx->Error(mod, message, fileRange, pointTo);
 }
 
+bool EmitCtx::should_check_bounds(ir::Value* index, ir::Value* instance) const {
+	if (has_fn() && not fn->has_bound_checks()) {
+		return false;
+	}
+	if (not index->is_local_value() || not instance->is_local_value()) {
+		return true;
+	}
+	for (auto const& info : loopsInfo) {
+		if (info.index && info.boundedLocalID.has_value() && (info.index->get_id() == index->get_local_id().value()) &&
+		    (info.boundedLocalID.value() == instance->get_local_id().value())) {
+			return false;
+		}
+	}
+	return true;
+}
+
 bool EmitCtx::has_generic_with_name(String const& name) const {
 	for (auto it = generics.rbegin(); it != generics.rend(); it++) {
 		if ((*it)->get_name().value == name) {
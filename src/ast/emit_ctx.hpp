@@ -25,12 +25,21 @@ struct LoopInfo {
 	ir::LocalValue*   index;
 	LoopType          type;
 
+	/// The local value that the index of the loop is always a valid index of. The length of the local cannot change
+	/// inside the loop, and the loop stops before the index reaches the length
+	Maybe<u64> boundedLocalID;
+
 	LoopInfo(Maybe<Identifier> _name, ir::Block* _mainB, ir::Block* _condB, ir::Block* _restB, ir::LocalValue* _index,
 	         LoopType _type)
 	    : name(_name), mainBlock(_mainB), condBlock(_condB), restBlock(_restB), index(_index), type(_type) {}
 
 	void set_secondary_name(Identifier other) { secondaryName = std::move(other); }
 
+	void set_index_bound(ir::LocalValue* _index, u64 localID) {
+		index          = _index;
+		boundedLocalID = localID;
+	}
+
 	useit bool isTimes() const { return type == LoopType::TO_COUNT; }
 };
 
@@ -79,7 +88,7 @@ struct EmitCtx {
 	      prerunCallState(nullptr) {}
 
 	useit static EmitCtx* get(ir::Ctx* _irCtx, ir::Mod* _mod) {
-		return std::construct_at(OwnNormal(EmitCtx), _irCtx, _mod);
+		return std::construct_at(OwnAST(EmitCtx), _irCtx, _mod);
 	}
 
 	EmitCtx* with_skill(ir::Skill* _skill) {
@@ -136,6 +145,10 @@ struct EmitCtx {
 
 	useit String color(String const& message) const;
 
+	/// Whether indexing the instance with the index needs a check at runtime. This is not necessary if the function
+	/// disables the checks, or if the index is the index of an enclosing loop that is bounded by the instance
+	useit bool should_check_bounds(ir::Value* index, ir::Value* instance) const;
+
 	void genericNameCheck(String const& name, FileRange const& range);
 
 	void name_check_in_module(const Identifier& name, const String& entityType, Maybe<u64> genericID = None,
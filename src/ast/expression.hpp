@@ -1,6 +1,7 @@
 #ifndef QAT_AST_EXPRESSION_HPP
 #define QAT_AST_EXPRESSION_HPP
 
+#include "../IR/prerun_bytecode.hpp"
 #include "./emit_ctx.hpp"
 #include "./node.hpp"
 
@@ -121,6 +122,10 @@ class PrerunExpression : public Expression {
 	useit NodeType         nodeType() const override       = 0;
 	useit Json             to_json() const override        = 0;
 	useit virtual String   to_string() const               = 0;
+
+	/// Lowers this expression to the bytecode of the enclosing prerun function, and provides the register that holds
+	/// the result. None means that the expression is not supported by the bytecode
+	useit virtual Maybe<u32> lower_to_bytecode(ir::PreCompiler* compiler) { return None; }
 };
 
 } // namespace qat::ast
@@ -12,7 +12,7 @@ class AddressOf final : public Expression {
 	AddressOf(Expression* _instance, FileRange _fileRange) : Expression(_fileRange), instance(_instance) {}
 
 	useit static AddressOf* create(Expression* _instance, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(AddressOf), _instance, _fileRange);
+		return std::construct_at(OwnAST(AddressOf), _instance, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
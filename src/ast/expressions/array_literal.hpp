@@ -20,7 +20,7 @@ class ArrayLiteral final : public Expression,
 	    : Expression(std::move(_fileRange)), values(std::move(_values)) {}
 
 	useit static ArrayLiteral* create(Vec<Expression*> values, FileRange fileRange) {
-		return std::construct_at(OwnNormal(ArrayLiteral), values, fileRange);
+		return std::construct_at(OwnAST(ArrayLiteral), values, fileRange);
 	}
 
 	LOCAL_DECL_COMPATIBLE_FUNCTIONS
@@ -25,7 +25,7 @@ class AssemblyBlock : public Expression {
 	useit static AssemblyBlock* create(Type* functionType, PrerunExpression* asmValue, Vec<Expression*> arguments,
 	                                   FileRange argsRange, PrerunExpression* clobbers, Maybe<FileRange> volatileRange,
 	                                   PrerunExpression* volatileExp, FileRange fileRange) {
-		return std::construct_at(OwnNormal(AssemblyBlock), functionType, asmValue, arguments, argsRange, clobbers,
+		return std::construct_at(OwnAST(AssemblyBlock), functionType, asmValue, arguments, argsRange, clobbers,
 		                         volatileRange, volatileExp, fileRange);
 	}
 
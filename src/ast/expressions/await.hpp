@@ -13,7 +13,7 @@ class Await final : public Expression {
 	Await(Expression* _exp, FileRange _fileRange) : Expression(std::move(_fileRange)), exp(_exp) {}
 
 	useit static Await* create(Expression* exp, FileRange fileRange) {
-		return std::construct_at(OwnNormal(Await), exp, fileRange);
+		return std::construct_at(OwnAST(Await), exp, fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -19,7 +19,7 @@ class BinaryExpression final : public Expression {
 
 	useit static BinaryExpression* create(Expression* _lhs, const String& _binaryOperator, Expression* _rhs,
 	                                      FileRange _fileRange) {
-		return std::construct_at(OwnNormal(BinaryExpression), _lhs, _binaryOperator, _rhs, _fileRange);
+		return std::construct_at(OwnAST(BinaryExpression), _lhs, _binaryOperator, _rhs, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
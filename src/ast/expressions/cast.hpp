@@ -15,7 +15,7 @@ class Cast final : public Expression {
 	    : Expression(_fileRange), instance(_mainExp), destination(_dest) {}
 
 	useit static Cast* create(Expression* mainExp, Type* value, FileRange fileRange) {
-		return std::construct_at(OwnNormal(Cast), mainExp, value, fileRange);
+		return std::construct_at(OwnAST(Cast), mainExp, value, fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
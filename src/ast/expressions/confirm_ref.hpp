@@ -14,7 +14,7 @@ class ConfirmRef : public Expression {
 	    : Expression(std::move(_fileRange)), subExpr(_subExpr), isVar(_isVar) {}
 
 	useit static ConfirmRef* create(Expression* subExpr, bool isVar, FileRange fileRange) {
-		return std::construct_at(OwnNormal(ConfirmRef), subExpr, isVar, std::move(fileRange));
+		return std::construct_at(OwnAST(ConfirmRef), subExpr, isVar, std::move(fileRange));
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx);
@@ -21,7 +21,7 @@ class ConstructorCall final : public Expression,
 	    : Expression(_fileRange), type(_type), args(_args) {}
 
 	useit static ConstructorCall* create(TypeLike _type, Vec<Expression*> _args, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(ConstructorCall), _type, _args, _fileRange);
+		return std::construct_at(OwnAST(ConstructorCall), _type, _args, _fileRange);
 	}
 
 	LOCAL_DECL_COMPATIBLE_FUNCTIONS
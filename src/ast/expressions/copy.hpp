@@ -20,7 +20,7 @@ class Copy final : public Expression, public LocalDeclCompatible, public InPlace
 	    : Expression(std::move(_fileRange)), exp(_exp), isExpSelf(_isExpSelf) {}
 
 	useit static Copy* create(Expression* exp, bool _isExpSelf, FileRange fileRange) {
-		return std::construct_at(OwnNormal(Copy), exp, _isExpSelf, fileRange);
+		return std::construct_at(OwnAST(Copy), exp, _isExpSelf, fileRange);
 	}
 
 	LOCAL_DECL_COMPATIBLE_FUNCTIONS
@@ -18,7 +18,7 @@ class Default final : public Expression, public LocalDeclCompatible, public InPl
 	    : Expression(std::move(_fileRange)), providedType(_providedType) {}
 
 	useit static Default* create(ast::Type* _providedType, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(Default), _providedType, _fileRange);
+		return std::construct_at(OwnAST(Default), _providedType, _fileRange);
 	}
 
 	LOCAL_DECL_COMPATIBLE_FUNCTIONS
@@ -12,7 +12,7 @@ class Dereference final : public Expression {
 	Dereference(Expression* _exp, FileRange _fileRange) : Expression(_fileRange), exp(_exp) {}
 
 	useit static Dereference* create(Expression* _exp, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(Dereference), _exp, _fileRange);
+		return std::construct_at(OwnAST(Dereference), _exp, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -22,11 +22,19 @@ class Entity final : public Expression {
 	    : Expression(std::move(_fileRange)), names(std::move(_name)), relative(_relative) {}
 
 	static Entity* create(u32 relative, Vec<Identifier> _name, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(Entity), relative, _name, _fileRange);
+		return std::construct_at(OwnAST(Entity), relative, _name, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final;
 
+	/// The name of the entity if it is a single name that is not relative, which is how local values are named
+	useit Maybe<Identifier> get_single_name() const {
+		if ((relative == 0u) && (names.size() == 1u)) {
+			return names.front();
+		}
+		return None;
+	}
+
 	useit ir::Value* emit(EmitCtx* ctx);
 	useit Json       to_json() const final;
 	useit NodeType   nodeType() const final { return NodeType::ENTITY; }
@@ -18,7 +18,7 @@ class ErrorExpression : public Expression, public LocalDeclCompatible, public In
 
 	useit static ErrorExpression* create(Expression* value, Maybe<Pair<FileRange, ast::PrerunExpression*>> isPacked,
 	                                     Maybe<Pair<Type*, Type*>> providedType, FileRange fileRange) {
-		return std::construct_at(OwnNormal(ErrorExpression), value, isPacked, providedType, fileRange);
+		return std::construct_at(OwnAST(ErrorExpression), value, isPacked, providedType, fileRange);
 	}
 
 	TYPE_INFERRABLE_FUNCTIONS
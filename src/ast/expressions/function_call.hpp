@@ -15,7 +15,7 @@ class FunctionCall final : public Expression {
 	    : Expression(std::move(_fileRange)), fnExpr(_fnExpr), values(_arguments) {}
 
 	useit static FunctionCall* create(Expression* _fnExpr, Vec<Expression*> _arguments, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(FunctionCall), _fnExpr, _arguments, _fileRange);
+		return std::construct_at(OwnAST(FunctionCall), _fnExpr, _arguments, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -19,7 +19,7 @@ class GenericEntity final : public Expression {
 
 	useit static GenericEntity* create(u32 _relative, Vec<Identifier> _names, Vec<FillGeneric*> _genericTypes,
 	                                   FileRange _fileRange) {
-		return std::construct_at(OwnNormal(GenericEntity), _relative, _names, _genericTypes, _fileRange);
+		return std::construct_at(OwnAST(GenericEntity), _relative, _names, _genericTypes, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final;
@@ -18,7 +18,7 @@ class GetIntrinsic final : public Expression {
 	GetIntrinsic(Vec<PrerunExpression*> _types, FileRange _fileRange) : Expression(_fileRange), args(_types) {}
 
 	useit static GetIntrinsic* create(Vec<PrerunExpression*> _args, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(GetIntrinsic), _args, _fileRange);
+		return std::construct_at(OwnAST(GetIntrinsic), _args, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
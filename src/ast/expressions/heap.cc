@@ -47,7 +47,8 @@ ir::Value* HeapGet::emit(EmitCtx* ctx) {
 		    llvm::ConstantInt::get(llvm::Type::getInt64Ty(ctx->irCtx->llctx),
 		                           mod->get_llvm_module()->getDataLayout().getTypeAllocSize(typRes->get_llvm_type()));
 	}
-	auto  mallocName = mod->link_internal_dependency(ir::InternalDependency::malloc, ctx->irCtx, fileRange);
+	auto  mallocName =
+	    mod->link_internal_dependency(ir::Mod::heap_dependency(ir::InternalDependency::malloc), ctx->irCtx, fileRange);
 	auto* resTy      = ir::PtrType::get(true, typRes, false, ir::PtrOwner::of_heap(), count != nullptr, ctx->irCtx);
 	auto* mallocFn   = mod->get_llvm_module()->getFunction(mallocName);
 	if (resTy->is_multi()) {
@@ -113,7 +114,8 @@ ir::Value* HeapPut::emit(EmitCtx* ctx) {
 	candExp =
 	    expTy->as_ptr()->is_multi() ? ctx->irCtx->builder.CreateExtractValue(exp->get_llvm(), {0u}) : exp->get_llvm();
 	auto* mod      = ctx->mod;
-	auto  freeName = mod->link_internal_dependency(ir::InternalDependency::free, ctx->irCtx, fileRange);
+	auto  freeName =
+	    mod->link_internal_dependency(ir::Mod::heap_dependency(ir::InternalDependency::free), ctx->irCtx, fileRange);
 	auto* freeFn   = mod->get_llvm_module()->getFunction(freeName);
 	ctx->irCtx->builder.CreateCall(
 	    freeFn->getFunctionType(), freeFn,
@@ -205,7 +207,8 @@ ir::Value* HeapGrow::emit(EmitCtx* ctx) {
 		                   countVal->get_ir_type()->as_ref()->get_subtype(), false);
 	}
 	if (countVal->get_ir_type()->is_native_type() && countVal->get_ir_type()->as_native_type()->is_usize()) {
-		auto  reallocName = ctx->mod->link_internal_dependency(ir::InternalDependency::realloc, ctx->irCtx, fileRange);
+		auto  reallocName = ctx->mod->link_internal_dependency(
+		    ir::Mod::heap_dependency(ir::InternalDependency::realloc), ctx->irCtx, fileRange);
 		auto* reallocFn   = ctx->mod->get_llvm_module()->getFunction(reallocName);
 		auto* ptrRes      = ctx->irCtx->builder.CreatePointerCast(
             ctx->irCtx->builder.CreateCall(
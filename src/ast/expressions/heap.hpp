@@ -16,7 +16,7 @@ class HeapGet final : public Expression {
 	    : Expression(std::move(_fileRange)), type(_type), count(_count) {}
 
 	useit static HeapGet* create(Type* _type, Expression* _count, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(HeapGet), _type, _count, _fileRange);
+		return std::construct_at(OwnAST(HeapGet), _type, _count, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -39,7 +39,7 @@ class HeapPut final : public Expression {
 	HeapPut(Expression* pointer, FileRange _fileRange) : Expression(std::move(_fileRange)), ptr(pointer) {}
 
 	useit static HeapPut* create(Expression* _pointer, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(HeapPut), _pointer, _fileRange);
+		return std::construct_at(OwnAST(HeapPut), _pointer, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -63,7 +63,7 @@ class HeapGrow final : public Expression {
 	    : Expression(_fileRange), type(_type), ptr(_ptr), count(_count) {}
 
 	useit static HeapGrow* create(Type* type, Expression* ptr, Expression* count, FileRange fileRange) {
-		return std::construct_at(OwnNormal(HeapGrow), type, ptr, count, fileRange);
+		return std::construct_at(OwnAST(HeapGrow), type, ptr, count, fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
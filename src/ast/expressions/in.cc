@@ -3,6 +3,7 @@
 #include "../../IR/logic.hpp"
 #include "../../IR/types/region.hpp"
 #include "../types/qat_type.hpp"
+#include "./to_conversion.hpp"
 #include "llvm/IR/Constants.h"
 
 namespace qat::ast {
@@ -20,6 +21,14 @@ void InExpression::update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType
 }
 
 ir::Value* InExpression::emit(EmitCtx* ctx) {
+	// A conversion to text in a region gives text whose characters are owned by the region, instead of a pointer
+	if (is_target_region() && (candidate->nodeType() == NodeType::TO_CONVERSION)) {
+		auto* conversion = (ToConversion*)candidate;
+		if (conversion->get_destination_type()->emit(ctx)->is_text()) {
+			conversion->set_text_region(target_as_region());
+			return conversion->emit(ctx)->with_range(fileRange);
+		}
+	}
 	ir::PtrType* finalTy = nullptr;
 	if (is_type_inferred()) {
 		if (not inferredType->is_ptr()) {
@@ -83,7 +92,8 @@ ir::Value* InExpression::emit(EmitCtx* ctx) {
 		auto currBlock = ctx->get_fn()->get_block();
 		startBlock->set_active(ctx->irCtx->builder);
 		if (is_target_heap()) {
-			auto mallocName = ctx->mod->link_internal_dependency(ir::InternalDependency::malloc, ctx->irCtx, fileRange);
+			auto mallocName = ctx->mod->link_internal_dependency(
+			    ir::Mod::heap_dependency(ir::InternalDependency::malloc), ctx->irCtx, fileRange);
 			auto mallocFn   = ctx->mod->get_llvm_module()->getFunction(mallocName);
 			auto mallocCall = ctx->irCtx->builder.CreateCall(
 			    mallocFn,
@@ -129,7 +139,8 @@ ir::Value* InExpression::emit(EmitCtx* ctx) {
 		auto currBlock = ctx->get_fn()->get_block();
 		startBlock->set_active(ctx->irCtx->builder);
 		if (is_target_heap()) {
-			auto mallocName = ctx->mod->link_internal_dependency(ir::InternalDependency::malloc, ctx->irCtx, fileRange);
+			auto mallocName = ctx->mod->link_internal_dependency(
+			    ir::Mod::heap_dependency(ir::InternalDependency::malloc), ctx->irCtx, fileRange);
 			auto mallocFn   = ctx->mod->get_llvm_module()->getFunction(mallocName);
 			auto mallocCall = ctx->irCtx->builder.CreateCall(
 			    mallocFn,
@@ -28,6 +28,8 @@ ir::Value* IndexAccess::emit(EmitCtx* ctx) {
 	auto* ind     = index->emit(ctx);
 	auto* indType = ind->get_ir_type();
 	auto* zero64  = llvm::ConstantInt::get(llvm::Type::getInt64Ty(ctx->irCtx->llctx), 0u);
+	// This uses the local values of the index and the instance, before any of them are loaded
+	auto checkBounds = ctx->should_check_bounds(ind, inst);
 	if (instType->is_tuple()) {
 		if (indType->is_unsigned() && ind->is_prerun_value()) {
 			if (indType->as_unsigned()->get_bitwidth() > 32u) {
@@ -98,24 +100,27 @@ ir::Value* IndexAccess::emit(EmitCtx* ctx) {
 				if (not instType->as_ptr()->is_multi()) {
 					ctx->Error("Only values of multi-pointer type can be indexed into", fileRange);
 				}
-				auto* lenExceedTrueBlock = ir::Block::create(ctx->get_fn(), ctx->get_fn()->get_block());
-				auto* restBlock          = ir::Block::create(ctx->get_fn(), ctx->get_fn()->get_block()->get_parent());
-				restBlock->link_previous_block(ctx->get_fn()->get_block());
-				auto ptrLen = ctx->irCtx->builder.CreateLoad(
-				    ir::NativeType::get_usize(ctx->irCtx)->get_llvm_type(),
-				    ctx->irCtx->builder.CreateStructGEP(instType->get_llvm_type(), inst->get_llvm(), 1u));
-				ctx->irCtx->builder.CreateCondBr(ctx->irCtx->builder.CreateICmpUGE(ind->get_llvm(), ptrLen),
-				                                 lenExceedTrueBlock->get_bb(), restBlock->get_bb());
-				lenExceedTrueBlock->set_active(ctx->irCtx->builder);
-				ir::Logic::panic_in_function(
-				    ctx->get_fn(),
-				    {ir::TextType::create_value(ctx->irCtx, ctx->mod, "The index is "), ind,
-				     ir::TextType::create_value(ctx->irCtx, ctx->mod,
-				                                " which is not less than the length of the multi-pointer, which is "),
-				     ir::Value::get(ptrLen, ir::NativeType::get_usize(ctx->irCtx), false)},
-				    {}, index->fileRange, ctx);
-				(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
-				restBlock->set_active(ctx->irCtx->builder);
+				if (checkBounds) {
+					auto* currBlock          = ctx->get_fn()->get_block();
+					auto* lenExceedTrueBlock = ir::Block::create(ctx->get_fn(), currBlock);
+					auto* restBlock          = ir::Block::create(ctx->get_fn(), currBlock->get_parent());
+					restBlock->link_previous_block(currBlock);
+					auto ptrLen = ctx->irCtx->builder.CreateLoad(
+					    ir::NativeType::get_usize(ctx->irCtx)->get_llvm_type(),
+					    ctx->irCtx->builder.CreateStructGEP(instType->get_llvm_type(), inst->get_llvm(), 1u));
+					ctx->irCtx->builder.CreateCondBr(ctx->irCtx->builder.CreateICmpUGE(ind->get_llvm(), ptrLen),
+					                                 lenExceedTrueBlock->get_bb(), restBlock->get_bb());
+					lenExceedTrueBlock->set_active(ctx->irCtx->builder);
+					ir::Logic::panic_in_function(
+					    ctx->get_fn(),
+					    {ir::TextType::create_value(ctx->irCtx, ctx->mod, "The index is "), ind,
+					     ir::TextType::create_value(ctx->irCtx, ctx->mod,
+					                                " which is not less than the length of the multi-pointer, which is "),
+					     ir::Value::get(ptrLen, ir::NativeType::get_usize(ctx->irCtx), false)},
+					    {}, index->fileRange, ctx);
+					(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
+					restBlock->set_active(ctx->irCtx->builder);
+				}
 				Vec<llvm::Value*> idxs;
 				idxs.push_back(ind->get_llvm());
 				return ir::Value::get(
@@ -181,26 +186,29 @@ ir::Value* IndexAccess::emit(EmitCtx* ctx) {
 			if (inst->is_ref()) {
 				inst->load_ghost_ref(ctx->irCtx->builder);
 			}
-			auto  usizeTy = ir::NativeType::get_usize(ctx->irCtx);
-			auto* strTy   = ir::TextType::get(ctx->irCtx);
-			auto* strLen  = ctx->irCtx->builder.CreateLoad(
-                usizeTy->get_llvm_type(),
-                ctx->irCtx->builder.CreateStructGEP(strTy->get_llvm_type(), inst->get_llvm(), 1u));
-			auto* currBlock          = ctx->get_fn()->get_block();
-			auto* lenExceedTrueBlock = ir::Block::create(ctx->get_fn(), currBlock);
-			auto* restBlock          = ir::Block::create(ctx->get_fn(), currBlock->get_parent());
-			restBlock->link_previous_block(currBlock);
-			ctx->irCtx->builder.CreateCondBr(ctx->irCtx->builder.CreateICmpUGE(ind->get_llvm(), strLen),
-			                                 lenExceedTrueBlock->get_bb(), restBlock->get_bb());
-			lenExceedTrueBlock->set_active(ctx->irCtx->builder);
-			ir::Logic::panic_in_function(
-			    ctx->get_fn(),
-			    {ir::TextType::create_value(ctx->irCtx, ctx->mod, "Index for text is "), ind,
-			     ir::TextType::create_value(ctx->irCtx, ctx->mod, " which is not less than its length, which is "),
-			     ir::Value::get(strLen, ir::UnsignedType::create(64u, ctx->irCtx), false)},
-			    {}, fileRange, ctx);
-			(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
-			restBlock->set_active(ctx->irCtx->builder);
+			if (checkBounds) {
+				auto  usizeTy = ir::NativeType::get_usize(ctx->irCtx);
+				auto* strTy   = ir::TextType::get(ctx->irCtx);
+				auto* strLen  = ctx->irCtx->builder.CreateLoad(
+				    usizeTy->get_llvm_type(),
+				    ctx->irCtx->builder.CreateStructGEP(strTy->get_llvm_type(), inst->get_llvm(), 1u));
+				auto* currBlock          = ctx->get_fn()->get_block();
+				auto* lenExceedTrueBlock = ir::Block::create(ctx->get_fn(), currBlock);
+				auto* restBlock          = ir::Block::create(ctx->get_fn(), currBlock->get_parent());
+				restBlock->link_previous_block(currBlock);
+				ctx->irCtx->builder.CreateCondBr(ctx->irCtx->builder.CreateICmpUGE(ind->get_llvm(), strLen),
+				                                 lenExceedTrueBlock->get_bb(), restBlock->get_bb());
+				lenExceedTrueBlock->set_active(ctx->irCtx->builder);
+				ir::Logic::panic_in_function(
+				    ctx->get_fn(),
+				    {ir::TextType::create_value(ctx->irCtx, ctx->mod, "Index for text is "), ind,
+				     ir::TextType::create_value(ctx->irCtx, ctx->mod,
+				                                " which is not less than its length, which is "),
+				     ir::Value::get(strLen, ir::UnsignedType::create(64u, ctx->irCtx), false)},
+				    {}, fileRange, ctx);
+				(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
+				restBlock->set_active(ctx->irCtx->builder);
+			}
 			auto* strData = ctx->irCtx->builder.CreateStructGEP(ir::TextType::get(ctx->irCtx)->get_llvm_type(),
 			                                                    inst->get_llvm(), 0u);
 			SHOW("Got string data")
@@ -241,21 +249,23 @@ ir::Value* IndexAccess::emit(EmitCtx* ctx) {
 				           index->fileRange);
 			}
 		} else {
-			auto* strTy              = ir::TextType::get(ctx->irCtx);
-			auto* strLen             = ctx->irCtx->builder.CreateExtractValue(inst->get_llvm(), {1u});
-			auto* currBlock          = ctx->get_fn()->get_block();
-			auto* lenExceedTrueBlock = ir::Block::create(ctx->get_fn(), currBlock);
-			auto* restBlock          = ir::Block::create(ctx->get_fn(), currBlock->get_parent());
-			restBlock->link_previous_block(currBlock);
-			ctx->irCtx->builder.CreateCondBr(ctx->irCtx->builder.CreateICmpUGE(ind->get_llvm(), strLen),
-			                                 lenExceedTrueBlock->get_bb(), restBlock->get_bb());
-			lenExceedTrueBlock->set_active(ctx->irCtx->builder);
-			ir::Logic::panic_in_function(
-			    ctx->get_fn(),
-			    {ir::TextType::create_value(ctx->irCtx, ctx->mod, "Index of text is not less than its length")}, {},
-			    fileRange, ctx);
-			(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
-			restBlock->set_active(ctx->irCtx->builder);
+			if (checkBounds) {
+				auto* strTy              = ir::TextType::get(ctx->irCtx);
+				auto* strLen             = ctx->irCtx->builder.CreateExtractValue(inst->get_llvm(), {1u});
+				auto* currBlock          = ctx->get_fn()->get_block();
+				auto* lenExceedTrueBlock = ir::Block::create(ctx->get_fn(), currBlock);
+				auto* restBlock          = ir::Block::create(ctx->get_fn(), currBlock->get_parent());
+				restBlock->link_previous_block(currBlock);
+				ctx->irCtx->builder.CreateCondBr(ctx->irCtx->builder.CreateICmpUGE(ind->get_llvm(), strLen),
+				                                 lenExceedTrueBlock->get_bb(), restBlock->get_bb());
+				lenExceedTrueBlock->set_active(ctx->irCtx->builder);
+				ir::Logic::panic_in_function(
+				    ctx->get_fn(),
+				    {ir::TextType::create_value(ctx->irCtx, ctx->mod, "Index of text is not less than its length")},
+				    {}, fileRange, ctx);
+				(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
+				restBlock->set_active(ctx->irCtx->builder);
+			}
 			return ir::Value::get(
 			    ctx->irCtx->builder.CreateInBoundsGEP(llvm::Type::getInt8Ty(ctx->irCtx->llctx),
 			                                          ctx->irCtx->builder.CreateExtractValue(inst->get_llvm(), {0u}),
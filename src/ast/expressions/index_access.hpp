@@ -16,7 +16,7 @@ class IndexAccess final : public Expression {
 	    : Expression(_fileRange), instance(_instance), index(_index) {}
 
 	useit static IndexAccess* create(Expression* _instance, Expression* _index, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(IndexAccess), _instance, _index, _fileRange);
+		return std::construct_at(OwnAST(IndexAccess), _instance, _index, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
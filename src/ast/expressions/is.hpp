@@ -18,7 +18,7 @@ class IsExpression final : public Expression,
 	IsExpression(Expression* _subExpr, FileRange _fileRange) : Expression(_fileRange), subExpr(_subExpr) {}
 
 	useit static IsExpression* create(Expression* subExpr, FileRange fileRange) {
-		return std::construct_at(OwnNormal(IsExpression), subExpr, fileRange);
+		return std::construct_at(OwnAST(IsExpression), subExpr, fileRange);
 	}
 
 	LOCAL_DECL_COMPATIBLE_FUNCTIONS
@@ -21,7 +21,7 @@ class MemberAccess final : public Expression {
 
 	useit static MemberAccess* create(Expression* _instance, bool isExpSelf, Maybe<bool> _isVariationAccess,
 	                                  Identifier _name, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(MemberAccess), _instance, isExpSelf, _isVariationAccess, _name, _fileRange);
+		return std::construct_at(OwnAST(MemberAccess), _instance, isExpSelf, _isVariationAccess, _name, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -41,6 +41,9 @@ class MemberAccess final : public Expression {
 		}
 	}
 
+	useit Expression*       get_instance() const { return instance; }
+	useit Identifier const& get_member_name() const { return name; }
+
 	useit ir::Value* emit(EmitCtx* ctx) override;
 	useit Json       to_json() const override;
 	useit NodeType   nodeType() const override { return NodeType::MEMBER_ACCESS; }
@@ -22,7 +22,7 @@ class MethodCall final : public Expression {
 
 	useit static MethodCall* create(Expression* _instance, bool _isExpSelf, Identifier _memberName,
 	                                Vec<Expression*> _arguments, Maybe<bool> _variation, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(MethodCall), _instance, _isExpSelf, _memberName, _arguments, _variation,
+		return std::construct_at(OwnAST(MethodCall), _instance, _isExpSelf, _memberName, _arguments, _variation,
 		                         _fileRange);
 	}
 
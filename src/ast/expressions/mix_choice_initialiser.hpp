@@ -23,7 +23,7 @@ class MixOrChoiceInitialiser final : public Expression,
 
 	useit static MixOrChoiceInitialiser* create(TypeLike type, Identifier subName, Expression* expression,
 	                                            FileRange fileRange) {
-		return std::construct_at(OwnNormal(MixOrChoiceInitialiser), type, subName, expression, fileRange);
+		return std::construct_at(OwnAST(MixOrChoiceInitialiser), type, subName, expression, fileRange);
 	}
 
 	LOCAL_DECL_COMPATIBLE_FUNCTIONS
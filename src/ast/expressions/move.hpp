@@ -20,7 +20,7 @@ class Move final : public Expression, public LocalDeclCompatible, public InPlace
 	    : Expression(std::move(_fileRange)), exp(_exp), isExpSelf(_isExpSelf) {}
 
 	useit static Move* create(Expression* _exp, bool _isExpSelf, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(Move), _exp, _isExpSelf, _fileRange);
+		return std::construct_at(OwnAST(Move), _exp, _isExpSelf, _fileRange);
 	}
 
 	LOCAL_DECL_COMPATIBLE_FUNCTIONS
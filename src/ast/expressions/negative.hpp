@@ -12,7 +12,7 @@ class Negative final : public Expression, public TypeInferrable {
 	Negative(Expression* _value, FileRange _fileRange) : Expression(_fileRange), value(_value) {}
 
 	useit static Negative* create(Expression* value, FileRange fileRange) {
-		return std::construct_at(OwnNormal(Negative), value, fileRange);
+		return std::construct_at(OwnAST(Negative), value, fileRange);
 	}
 
 	TYPE_INFERRABLE_FUNCTIONS
@@ -12,7 +12,7 @@ class LogicalNot final : public Expression {
 	LogicalNot(Expression* _exp, FileRange _range) : Expression(_range), exp(_exp) {}
 
 	useit static LogicalNot* create(Expression* _exp, FileRange _range) {
-		return std::construct_at(OwnNormal(LogicalNot), _exp, _range);
+		return std::construct_at(OwnAST(LogicalNot), _exp, _range);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -20,7 +20,7 @@ class OkExpression final : public Expression,
 
 	useit static OkExpression* create(Expression* subExpr, Maybe<Pair<FileRange, PrerunExpression*>> isPacked,
 	                                  Maybe<Pair<Type*, Type*>> providedType, FileRange fileRange) {
-		return std::construct_at(OwnNormal(OkExpression), subExpr, isPacked, providedType, fileRange);
+		return std::construct_at(OwnAST(OkExpression), subExpr, isPacked, providedType, fileRange);
 	}
 
 	LOCAL_DECL_COMPATIBLE_FUNCTIONS
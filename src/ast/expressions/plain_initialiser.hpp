@@ -25,7 +25,7 @@ class PlainInitialiser final : public Expression,
 
 	useit static PlainInitialiser* create(TypeLike _type, Vec<Pair<String, FileRange>> _fields,
 	                                      Vec<Expression*> _fieldValues, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(PlainInitialiser), _type, _fields, _fieldValues, _fileRange);
+		return std::construct_at(OwnAST(PlainInitialiser), _type, _fields, _fieldValues, _fileRange);
 	}
 
 	LOCAL_DECL_COMPATIBLE_FUNCTIONS
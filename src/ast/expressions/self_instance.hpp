@@ -11,7 +11,7 @@ class SelfInstance final : public Expression {
 	explicit SelfInstance(FileRange _fileRange) : Expression(_fileRange) {}
 
 	useit static SelfInstance* create(FileRange _fileRange) {
-		return std::construct_at(OwnNormal(SelfInstance), _fileRange);
+		return std::construct_at(OwnAST(SelfInstance), _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -13,7 +13,7 @@ class Spawn : public Expression {
 	Spawn(Vec<Sentence*> _sentences, FileRange _fileRange) : Expression(_fileRange), sentences(_sentences) {}
 
 	useit static Spawn* create(Vec<Sentence*> sentences, FileRange fileRange) {
-		return std::construct_at(OwnNormal(Spawn), sentences, fileRange);
+		return std::construct_at(OwnAST(Spawn), sentences, fileRange);
 	}
 
 	useit ir::Value* emit(EmitCtx* ctx) final;
@@ -20,7 +20,7 @@ class SubEntity final : public Expression {
 
 	useit static SubEntity* create(Maybe<FileRange> skill, Maybe<FileRange> doneSkill, Vec<Identifier> names,
 	                               TypeLike parentType, FileRange fileRange) {
-		return std::construct_at(OwnNormal(SubEntity), std::move(skill), std::move(doneSkill), std::move(names),
+		return std::construct_at(OwnAST(SubEntity), std::move(skill), std::move(doneSkill), std::move(names),
 		                         parentType, std::move(fileRange));
 	}
 
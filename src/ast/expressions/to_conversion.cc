@@ -2,6 +2,7 @@
 #include "../../IR/control_flow.hpp"
 #include "../../IR/logic.hpp"
 #include "../../IR/types/native_type.hpp"
+#include "../../IR/types/region.hpp"
 #include "../../IR/types/text.hpp"
 
 #include <llvm/IR/Instructions.h>
@@ -38,6 +39,22 @@ ir::Value* ToConversion::emit(EmitCtx* ctx) {
 		if (valType->is_native_type()) {
 			valType = valType->as_native_type()->get_subtype();
 		}
+		ir::Region* region = nullptr;
+		if (textRegion != nullptr) {
+			if (not(valType->is_integer() || valType->is_unsigned() || valType->is_float())) {
+				ctx->Error("Only the conversion of integers and floats to " + ctx->color("text") +
+				               " can be provided with a region. The type of the expression is " +
+				               ctx->color(typ->to_string()),
+				           fileRange);
+			}
+			auto* regionTy = textRegion->emit(ctx);
+			if (not regionTy->is_region()) {
+				ctx->Error("Expected this type to be a region as suggested by the in-expression, but got the type " +
+				               ctx->color(regionTy->to_string()) + " instead",
+				           textRegion->fileRange);
+			}
+			region = regionTy->as_region();
+		}
 		if (valType->is_ptr()) {
 			if (destTy->is_ptr()) {
 				loadRef();
@@ -186,6 +203,8 @@ ir::Value* ToConversion::emit(EmitCtx* ctx) {
 				loadRef();
 				return ir::Value::get(ctx->irCtx->builder.CreateSIToFP(val->get_llvm(), destTy->get_llvm_type()),
 				                      destTy, false);
+			} else if (destTy->is_text()) {
+				return ir::Logic::number_to_text(ctx, val, region, fileRange);
 			} else {
 				ctx->Error("Conversion from " + ctx->color(typ->to_string()) + " to " +
 				               ctx->color(destTy->to_string()) + " is not supported",
@@ -213,6 +232,8 @@ ir::Value* ToConversion::emit(EmitCtx* ctx) {
 				loadRef();
 				return ir::Value::get(ctx->irCtx->builder.CreateUIToFP(val->get_llvm(), destTy->get_llvm_type()),
 				                      destTy, false);
+			} else if (destTy->is_text()) {
+				return ir::Logic::number_to_text(ctx, val, region, fileRange);
 			} else {
 				ctx->Error("Conversion from " + ctx->color(typ->to_string()) + " to " +
 				               ctx->color(destTy->to_string()) + " is not supported",
@@ -234,6 +255,8 @@ ir::Value* ToConversion::emit(EmitCtx* ctx) {
 				loadRef();
 				return ir::Value::get(ctx->irCtx->builder.CreateFPToUI(val->get_llvm(), destTy->get_llvm_type()),
 				                      destTy, false);
+			} else if (destTy->is_text()) {
+				return ir::Logic::number_to_text(ctx, val, region, fileRange);
 			} else {
 				ctx->Error("Conversion from " + ctx->color(typ->to_string()) + " to " +
 				               ctx->color(destTy->to_string()) + " is not supported",
@@ -9,15 +9,21 @@ namespace qat::ast {
 class ToConversion final : public Expression {
 	Expression* source;
 	Type*       destinationType;
+	Type*       textRegion = nullptr;
 
   public:
 	ToConversion(Expression* _source, Type* _destinationType, FileRange _fileRange)
 	    : Expression(_fileRange), source(_source), destinationType(_destinationType) {}
 
 	useit static ToConversion* create(Expression* _source, Type* _destinationType, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(ToConversion), _source, _destinationType, _fileRange);
+		return std::construct_at(OwnAST(ToConversion), _source, _destinationType, _fileRange);
 	}
 
+	/// The region that owns the characters of a number converted to text, as in `value'to:[text]'in:region(R)`
+	void set_text_region(Type* region) { textRegion = region; }
+
+	useit Type* get_destination_type() const { return destinationType; }
+
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
 		UPDATE_DEPS(source);
 		UPDATE_DEPS(destinationType);
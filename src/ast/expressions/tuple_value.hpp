@@ -17,7 +17,7 @@ class TupleValue final : public Expression, public LocalDeclCompatible, public I
 	TupleValue(Vec<Expression*> _members, FileRange _fileRange) : Expression(_fileRange), members(_members) {}
 
 	useit static TupleValue* create(Vec<Expression*> _members, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(TupleValue), _members, _fileRange);
+		return std::construct_at(OwnAST(TupleValue), _members, _fileRange);
 	}
 
 	LOCAL_DECL_COMPATIBLE_FUNCTIONS
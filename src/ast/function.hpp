@@ -46,7 +46,7 @@ class FunctionPrototype final : public IsEntity {
 	                                       Maybe<VisibilitySpec> _visibSpec, const FileRange& _fileRange,
 	                                       Vec<GenericAbstractType*>              _generics,
 	                                       Maybe<Pair<Vec<Sentence*>, FileRange>> _definition) {
-		return std::construct_at(OwnNormal(FunctionPrototype), _name, _arguments, _isVariadic, _returnType, _checker,
+		return std::construct_at(OwnAST(FunctionPrototype), _name, _arguments, _isVariadic, _returnType, _checker,
 		                         _genericConstraint, _metaInfo, _visibSpec, _fileRange, _generics, _definition);
 	}
 
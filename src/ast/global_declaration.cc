@@ -66,6 +66,8 @@ void GlobalDeclaration::define(ir::Mod* mod, ir::Ctx* irCtx) {
 			        ? llvm::ConstantPointerNull::get(llvm::cast<llvm::PointerType>(typ->get_llvm_type()))
 			        : llvm::Constant::getNullValue(typ->get_llvm_type()),
 			    linkingName);
+			mod->add_runtime_global(
+			    ir::RuntimeGlobal{name, gvar, irCtx->getGlobalLinkageForVisibility(visibInfo), is_variable});
 			value.value()->asInPlaceCreatable()->setCreateIn(ir::Value::get(gvar, typ, false));
 			SHOW("Emitting in-place creatable")
 			(void)value.value()->emit(valEmitCtx);
@@ -89,7 +91,6 @@ void GlobalDeclaration::define(ir::Mod* mod, ir::Ctx* irCtx) {
 				if (typ->is_ref()) {
 					typ = typ->as_ref()->get_subtype();
 				}
-				mod->add_non_const_global_counter();
 				gvar = std::construct_at(
 				    OwnNormal(llvm::GlobalVariable), *mod->get_llvm_module(), typ->get_llvm_type(), false,
 				    llvm::GlobalValue::LinkageTypes::WeakAnyLinkage,
@@ -97,6 +98,8 @@ void GlobalDeclaration::define(ir::Mod* mod, ir::Ctx* irCtx) {
 				        ? llvm::ConstantPointerNull::get(llvm::cast<llvm::PointerType>(typ->get_llvm_type()))
 				        : llvm::Constant::getNullValue(typ->get_llvm_type()),
 				    linkingName);
+				mod->add_runtime_global(
+				    ir::RuntimeGlobal{name, gvar, irCtx->getGlobalLinkageForVisibility(visibInfo), is_variable});
 				if (val->is_value()) {
 					irCtx->builder.CreateStore(val->get_llvm(), gvar);
 				} else {
@@ -28,7 +28,7 @@ class GlobalDeclaration : public IsEntity {
 	useit static GlobalDeclaration* create(Identifier _name, Type* _type, Maybe<Expression*> _value, bool _isVariable,
 	                                       Maybe<VisibilitySpec> _visibSpec, Maybe<MetaInfo> _metaInfo,
 	                                       FileRange _fileRange) {
-		return std::construct_at(OwnNormal(GlobalDeclaration), _name, _type, _value, _isVariable, _visibSpec, _metaInfo,
+		return std::construct_at(OwnAST(GlobalDeclaration), _name, _type, _value, _isVariable, _visibSpec, _metaInfo,
 		                         _fileRange);
 	}
 
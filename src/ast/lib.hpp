@@ -22,7 +22,7 @@ class Lib : public Node {
 
 	useit static Lib* create(Identifier _name, Vec<Node*> _members, Maybe<VisibilitySpec> _visibSpec,
 	                         const FileRange& _file_range) {
-		return std::construct_at(OwnNormal(Lib), _name, _members, _visibSpec, _file_range);
+		return std::construct_at(OwnAST(Lib), _name, _members, _visibSpec, _file_range);
 	}
 
 	void create_module(ir::Mod* mod, ir::Ctx* irCtx) const final;
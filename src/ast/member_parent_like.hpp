@@ -61,7 +61,7 @@ struct MethodParentState {
 	      moveConstructor(parent), copyAssignment(parent), moveAssignment(parent), destructor(parent) {}
 
 	useit static MethodParentState* get(ir::MethodParent* parent) {
-		return std::construct_at(OwnNormal(MethodParentState), parent);
+		return std::construct_at(OwnAST(MethodParentState), parent);
 	}
 };
 
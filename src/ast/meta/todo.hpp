@@ -13,7 +13,7 @@ class PrerunMetaTodo : public PrerunSentence {
 	PrerunMetaTodo(Maybe<String> _message, FileRange _fileRange) : PrerunSentence(_fileRange), message(_message) {}
 
 	useit static PrerunMetaTodo* create(Maybe<String> message, FileRange fileRange) {
-		return std::construct_at(OwnNormal(PrerunMetaTodo), message, fileRange);
+		return std::construct_at(OwnAST(PrerunMetaTodo), message, fileRange);
 	}
 
 	void emit(EmitCtx* ctx) final;
@@ -26,7 +26,7 @@ class MetaTodo : public Sentence {
 	MetaTodo(Maybe<String> _message, FileRange _fileRange) : Sentence(_fileRange), message(_message) {}
 
 	useit static MetaTodo* create(Maybe<String> message, FileRange fileRange) {
-		return std::construct_at(OwnNormal(MetaTodo), message, fileRange);
+		return std::construct_at(OwnAST(MetaTodo), message, fileRange);
 	}
 
 	virtual void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent,
@@ -58,6 +58,19 @@ struct MetaInfo {
 					               ctx->color(irVal->get_ir_type()->to_string()) + " instead",
 					           kv.second->fileRange);
 				}
+			} else if (kv.first.value == ir::MetaInfo::boundsChecksKey) {
+				if (not isParentFunction) {
+					ctx->Error("This " + ctx->color("meta") + " info does not belong to a function, and hence the " +
+					               ctx->color(ir::MetaInfo::boundsChecksKey) + " field cannot be used",
+					           kv.first.range);
+				}
+				if (not irVal->get_ir_type()->is_bool()) {
+					ctx->Error("The " + ctx->color(ir::MetaInfo::boundsChecksKey) +
+					               " field is expected to be of type " + ctx->color("bool") +
+					               ". Got an expression of type " +
+					               ctx->color(irVal->get_ir_type()->to_string()) + " instead",
+					           kv.second->fileRange);
+				}
 			}
 			resultVec.push_back({kv.first, irVal});
 			valuesRange.push_back(kv.second->fileRange);
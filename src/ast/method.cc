@@ -27,7 +27,7 @@ MethodPrototype* MethodPrototype::Normal(bool _isVariationFn, const Identifier&
                                          const Vec<Argument*>& _arguments, bool _isVariadic, Maybe<Type*> _returnType,
                                          Maybe<MetaInfo> _metaInfo, Maybe<VisibilitySpec> visibSpec,
                                          const FileRange& _fileRange) {
-	return std::construct_at(OwnNormal(MethodPrototype), _isVariationFn ? MethodType::variation : MethodType::normal,
+	return std::construct_at(OwnAST(MethodPrototype), _isVariationFn ? MethodType::variation : MethodType::normal,
 	                         _name, _condition, _arguments, _isVariadic, _returnType, _metaInfo, visibSpec, _fileRange);
 }
 
@@ -35,7 +35,7 @@ MethodPrototype* MethodPrototype::Static(const Identifier& _name, PrerunExpressi
                                          const Vec<Argument*>& _arguments, bool _isVariadic, Maybe<Type*> _returnType,
                                          Maybe<MetaInfo> _metaInfo, Maybe<VisibilitySpec> visibSpec,
                                          const FileRange& _fileRange) {
-	return std::construct_at(OwnNormal(MethodPrototype), MethodType::Static, _name, _condition, _arguments, _isVariadic,
+	return std::construct_at(OwnAST(MethodPrototype), MethodType::Static, _name, _condition, _arguments, _isVariadic,
 	                         _returnType, _metaInfo, visibSpec, _fileRange);
 }
 
@@ -43,7 +43,7 @@ MethodPrototype* MethodPrototype::Value(const Identifier& _name, PrerunExpressio
                                         const Vec<Argument*>& _arguments, bool _isVariadic, Maybe<Type*> _returnType,
                                         Maybe<MetaInfo> _metaInfo, Maybe<VisibilitySpec> visibSpec,
                                         const FileRange& _fileRange) {
-	return std::construct_at(OwnNormal(MethodPrototype), MethodType::valued, _name, _condition, _arguments, _isVariadic,
+	return std::construct_at(OwnAST(MethodPrototype), MethodType::valued, _name, _condition, _arguments, _isVariadic,
 	                         _returnType, _metaInfo, visibSpec, _fileRange);
 }
 
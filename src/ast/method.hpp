@@ -140,7 +140,7 @@ class MethodDefinition {
 
 	useit static MethodDefinition* create(MethodPrototype* _prototype, Vec<Sentence*> _sentences,
 	                                      FileRange _fileRange) {
-		return std::construct_at(OwnNormal(MethodDefinition), _prototype, _sentences, _fileRange);
+		return std::construct_at(OwnAST(MethodDefinition), _prototype, _sentences, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) {
@@ -15,6 +15,7 @@ void ModInfo::create_module(ir::Mod* mod, ir::Ctx* irCtx) const {
 	}
 	SHOW("Setting module info for " << mod->name.value << " at " << mod->filePath)
 	mod->metaInfo = irMeta;
+	mod->reset_link_names();
 }
 
 Json ModInfo::to_json() const { return Json()._("fileRange", fileRange); }
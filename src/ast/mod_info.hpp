@@ -20,7 +20,7 @@ class ModInfo : public Node {
 	ModInfo(MetaInfo _metaInfo, FileRange _fileRange) : Node(_fileRange), metaInfo(_metaInfo) {}
 
 	useit static ModInfo* create(MetaInfo _metaInfo, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(ModInfo), _metaInfo, _fileRange);
+		return std::construct_at(OwnAST(ModInfo), _metaInfo, _fileRange);
 	}
 
 	void create_module(ir::Mod* mod, ir::Ctx* irCtx) const final;
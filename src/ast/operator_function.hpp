@@ -41,7 +41,7 @@ class OperatorPrototype {
 	                                       Maybe<VisibilitySpec> _visibSpec, const FileRange& _fileRange,
 	                                       Maybe<Identifier> _argName, PrerunExpression* _defineChecker,
 	                                       Maybe<MetaInfo> _metaInfo) {
-		return std::construct_at(OwnNormal(OperatorPrototype), _isVariationFn, _op, _nameRange, _arguments, _returnType,
+		return std::construct_at(OwnAST(OperatorPrototype), _isVariationFn, _op, _nameRange, _arguments, _returnType,
 		                         _visibSpec, _fileRange, _argName, _defineChecker, std::move(_metaInfo));
 	}
 
@@ -81,7 +81,7 @@ class OperatorDefinition {
 
 	useit static OperatorDefinition* create(OperatorPrototype* _prototype, Vec<Sentence*> _sentences,
 	                                        FileRange _fileRange) {
-		return std::construct_at(OwnNormal(OperatorDefinition), _prototype, _sentences, _fileRange);
+		return std::construct_at(OwnAST(OperatorDefinition), _prototype, _sentences, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) {
@@ -13,7 +13,7 @@ class PrerunArrayLiteral final : public PrerunExpression, public TypeInferrable
 	    : PrerunExpression(_fileRange), valuesExp(_elements) {}
 
 	useit static PrerunArrayLiteral* create(Vec<PrerunExpression*> elements, FileRange fileRange) {
-		return std::construct_at(OwnNormal(PrerunArrayLiteral), elements, fileRange);
+		return std::construct_at(OwnAST(PrerunArrayLiteral), elements, fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -584,6 +584,216 @@ ir::PrerunValue* PrerunBinaryOperator::emit(EmitCtx* ctx) {
 	}
 }
 
+Maybe<u32> PrerunBinaryOperator::lower_to_bytecode(ir::PreCompiler* compiler) {
+	if (lhs->nodeType() == NodeType::DEFAULT || lhs->nodeType() == NodeType::NULL_POINTER ||
+	    rhs->nodeType() == NodeType::DEFAULT || rhs->nodeType() == NodeType::NULL_POINTER) {
+		return None;
+	}
+	Maybe<u32> lhsReg;
+	Maybe<u32> rhsReg;
+	// The order of lowering and type inference has to be the same as in emit
+	if ((lhs->nodeType() == NodeType::INTEGER_LITERAL || lhs->nodeType() == NodeType::UNSIGNED_LITERAL ||
+	     lhs->nodeType() == NodeType::FLOAT_LITERAL || lhs->nodeType() == NodeType::CUSTOM_FLOAT_LITERAL ||
+	     lhs->nodeType() == NodeType::CUSTOM_INTEGER_LITERAL) &&
+	    expect_same_operand_types(opr)) {
+		rhsReg = compiler->lower_expression(rhs);
+		if (not rhsReg.has_value()) {
+			return None;
+		}
+		lhs->as_type_inferrable()->set_inference_type(compiler->get_type_of(rhsReg.value()));
+		lhsReg = compiler->lower_expression(lhs);
+	} else if (rhs->has_type_inferrance() && expect_same_operand_types(opr)) {
+		lhsReg = compiler->lower_expression(lhs);
+		if (not lhsReg.has_value()) {
+			return None;
+		}
+		auto lhsTy = compiler->get_type_of(lhsReg.value());
+		if (lhsTy->is_integer() || lhsTy->is_unsigned() || lhsTy->is_float()) {
+			rhs->as_type_inferrable()->set_inference_type(lhsTy);
+		}
+		rhsReg = compiler->lower_expression(rhs);
+	} else {
+		lhsReg = compiler->lower_expression(lhs);
+		if (not lhsReg.has_value()) {
+			return None;
+		}
+		rhsReg = compiler->lower_expression(rhs);
+	}
+	if (not lhsReg.has_value() || not rhsReg.has_value()) {
+		return None;
+	}
+	auto lhsType = compiler->get_type_of(lhsReg.value());
+	if (not lhsType->is_same(compiler->get_type_of(rhsReg.value()))) {
+		return None;
+	}
+	Maybe<ir::PreOp> op;
+	bool             isComparison = false;
+	if (lhsType->is_integer() || lhsType->is_unsigned()) {
+		const bool isSigned = lhsType->is_integer();
+		switch (opr) {
+			case OperatorKind::ADDITION: {
+				op = ir::PreOp::add;
+				break;
+			}
+			case OperatorKind::SUBTRACT: {
+				op = ir::PreOp::subtract;
+				break;
+			}
+			case OperatorKind::MULTIPLY: {
+				op = ir::PreOp::multiply;
+				break;
+			}
+			case OperatorKind::DIVIDE: {
+				op = isSigned ? ir::PreOp::signedDivide : ir::PreOp::unsignedDivide;
+				break;
+			}
+			case OperatorKind::REMAINDER: {
+				op = isSigned ? ir::PreOp::signedRemainder : ir::PreOp::unsignedRemainder;
+				break;
+			}
+			case OperatorKind::EQUAL_TO: {
+				op           = ir::PreOp::equal;
+				isComparison = true;
+				break;
+			}
+			case OperatorKind::NOT_EQUAL_TO: {
+				op           = ir::PreOp::notEqual;
+				isComparison = true;
+				break;
+			}
+			case OperatorKind::LESS_THAN: {
+				op           = isSigned ? ir::PreOp::signedLess : ir::PreOp::unsignedLess;
+				isComparison = true;
+				break;
+			}
+			case OperatorKind::GREATER_THAN: {
+				op           = isSigned ? ir::PreOp::signedGreater : ir::PreOp::unsignedGreater;
+				isComparison = true;
+				break;
+			}
+			case OperatorKind::LESS_THAN_OR_EQUAL_TO: {
+				op           = isSigned ? ir::PreOp::signedLessOrEqual : ir::PreOp::unsignedLessOrEqual;
+				isComparison = true;
+				break;
+			}
+			case OperatorKind::GREATER_THAN_OR_EQUAL_TO: {
+				op           = isSigned ? ir::PreOp::signedGreaterOrEqual : ir::PreOp::unsignedGreaterOrEqual;
+				isComparison = true;
+				break;
+			}
+			case OperatorKind::BITWISE_AND: {
+				op = ir::PreOp::bitwiseAnd;
+				break;
+			}
+			case OperatorKind::BITWISE_OR: {
+				op = ir::PreOp::bitwiseOr;
+				break;
+			}
+			case OperatorKind::BITWISE_XOR: {
+				op = ir::PreOp::bitwiseXor;
+				break;
+			}
+			case OperatorKind::LOGICAL_LEFT_SHIFT: {
+				op = ir::PreOp::shiftLeft;
+				break;
+			}
+			case OperatorKind::LOGICAL_RIGHT_SHIFT: {
+				op = ir::PreOp::logicalShiftRight;
+				break;
+			}
+			case OperatorKind::ARITHMETIC_RIGHT_SHIFT: {
+				op = ir::PreOp::arithmeticShiftRight;
+				break;
+			}
+			default:
+				break;
+		}
+	} else if (lhsType->is_bool()) {
+		switch (opr) {
+			case OperatorKind::OR: {
+				op = ir::PreOp::bitwiseOr;
+				break;
+			}
+			case OperatorKind::AND: {
+				op = ir::PreOp::bitwiseAnd;
+				break;
+			}
+			case OperatorKind::EQUAL_TO: {
+				op = ir::PreOp::equal;
+				break;
+			}
+			case OperatorKind::NOT_EQUAL_TO: {
+				op = ir::PreOp::notEqual;
+				break;
+			}
+			default:
+				break;
+		}
+	} else if (lhsType->is_float()) {
+		switch (opr) {
+			case OperatorKind::ADDITION: {
+				op = ir::PreOp::floatAdd;
+				break;
+			}
+			case OperatorKind::SUBTRACT: {
+				op = ir::PreOp::floatSubtract;
+				break;
+			}
+			case OperatorKind::MULTIPLY: {
+				op = ir::PreOp::floatMultiply;
+				break;
+			}
+			case OperatorKind::DIVIDE: {
+				op = ir::PreOp::floatDivide;
+				break;
+			}
+			case OperatorKind::REMAINDER: {
+				op = ir::PreOp::floatRemainder;
+				break;
+			}
+			case OperatorKind::EQUAL_TO: {
+				op           = ir::PreOp::floatEqual;
+				isComparison = true;
+				break;
+			}
+			case OperatorKind::NOT_EQUAL_TO: {
+				op           = ir::PreOp::floatNotEqual;
+				isComparison = true;
+				break;
+			}
+			case OperatorKind::LESS_THAN: {
+				op           = ir::PreOp::floatLess;
+				isComparison = true;
+				break;
+			}
+			case OperatorKind::GREATER_THAN: {
+				op           = ir::PreOp::floatGreater;
+				isComparison = true;
+				break;
+			}
+			case OperatorKind::LESS_THAN_OR_EQUAL_TO: {
+				op           = ir::PreOp::floatLessOrEqual;
+				isComparison = true;
+				break;
+			}
+			case OperatorKind::GREATER_THAN_OR_EQUAL_TO: {
+				op           = ir::PreOp::floatGreaterOrEqual;
+				isComparison = true;
+				break;
+			}
+			default:
+				break;
+		}
+	}
+	if (not op.has_value()) {
+		return None;
+	}
+	auto result =
+	    compiler->new_register(isComparison ? ir::UnsignedType::create_bool(compiler->get_ctx()->irCtx) : lhsType);
+	compiler->add_instruction(op.value(), ir::PreBytecode::get_width(lhsType), result, lhsReg.value(), rhsReg.value());
+	return result;
+}
+
 String PrerunBinaryOperator::to_string() const {
 	return lhs->to_string() + " " + operator_to_string(opr) + " " + rhs->to_string();
 }
@@ -17,7 +17,7 @@ class PrerunBinaryOperator final : public PrerunExpression {
 
 	useit static PrerunBinaryOperator* create(PrerunExpression* _lhs, OperatorKind _opr, PrerunExpression* _rhs,
 	                                          FileRange _fileRange) {
-		return std::construct_at(OwnNormal(PrerunBinaryOperator), _lhs, _opr, _rhs, _fileRange);
+		return std::construct_at(OwnAST(PrerunBinaryOperator), _lhs, _opr, _rhs, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -26,6 +26,7 @@ class PrerunBinaryOperator final : public PrerunExpression {
 	}
 
 	useit ir::PrerunValue* emit(EmitCtx* ctx);
+	useit Maybe<u32>       lower_to_bytecode(ir::PreCompiler* compiler) final;
 	useit String           to_string() const final;
 	useit Json             to_json() const final;
 
@@ -14,6 +14,20 @@ ir::PrerunValue* PrerunBitwiseNot::emit(EmitCtx* ctx) {
 	return nullptr;
 }
 
+Maybe<u32> PrerunBitwiseNot::lower_to_bytecode(ir::PreCompiler* compiler) {
+	auto valReg = compiler->lower_expression(value);
+	if (not valReg.has_value()) {
+		return None;
+	}
+	auto valTy = compiler->get_type_of(valReg.value());
+	if (valTy->is_integer() || valTy->is_unsigned()) {
+		auto result = compiler->new_register(valTy);
+		compiler->add_instruction(ir::PreOp::bitwiseNot, ir::PreBytecode::get_width(valTy), result, valReg.value());
+		return result;
+	}
+	return None;
+}
+
 String PrerunBitwiseNot::to_string() const { return "~" + value->to_string(); }
 
 Json PrerunBitwiseNot::to_json() const {
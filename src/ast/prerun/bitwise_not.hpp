@@ -13,7 +13,7 @@ class PrerunBitwiseNot final : public PrerunExpression {
 	PrerunBitwiseNot(PrerunExpression* _value, FileRange _fileRange) : PrerunExpression(_fileRange), value(_value) {}
 
 	useit static PrerunBitwiseNot* create(PrerunExpression* _value, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(PrerunBitwiseNot), _value, _fileRange);
+		return std::construct_at(OwnAST(PrerunBitwiseNot), _value, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -21,6 +21,7 @@ class PrerunBitwiseNot final : public PrerunExpression {
 	}
 
 	useit ir::PrerunValue* emit(EmitCtx* ctx);
+	useit Maybe<u32>       lower_to_bytecode(ir::PreCompiler* compiler) final;
 	useit String           to_string() const final;
 	useit Json             to_json() const final;
 	useit NodeType         nodeType() const final { return NodeType::PRERUN_BITWISE_NOT; }
@@ -12,7 +12,7 @@ class BooleanLiteral final : public PrerunExpression {
 	BooleanLiteral(bool _value, FileRange _fileRange) : PrerunExpression(std::move(_fileRange)), value(_value) {}
 
 	useit static BooleanLiteral* create(bool _value, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(BooleanLiteral), _value, _fileRange);
+		return std::construct_at(OwnAST(BooleanLiteral), _value, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -15,7 +15,7 @@ class CustomFloatLiteral final : public PrerunExpression, public TypeInferrable
 	    : PrerunExpression(_fileRange), value(_value), kind(_kind) {}
 
 	useit static CustomFloatLiteral* create(String _value, String _kind, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(CustomFloatLiteral), _value, _kind, _fileRange);
+		return std::construct_at(OwnAST(CustomFloatLiteral), _value, _kind, _fileRange);
 	}
 
 	TYPE_INFERRABLE_FUNCTIONS
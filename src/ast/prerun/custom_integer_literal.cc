@@ -36,7 +36,7 @@ ir::PrerunValue* CustomIntegerLiteral::emit(EmitCtx* ctx) {
 				ctx->Error("Invalid character found in radix integer literal. For radix " +
 				               ctx->color(std::to_string(radix.value())) + ", the characters allowed are " +
 				               ctx->color(radixDigits.substr(0, radix.value())),
-				           FileRange{fileRange.file,
+				           FileRange{fileRange.fileID,
 				                     FilePos{fileRange.start.line,
 				                             fileRange.start.byteOffset + radixToString(radix.value()).length() + i},
 				                     FilePos{fileRange.start.line, fileRange.start.byteOffset +
@@ -51,7 +51,7 @@ ir::PrerunValue* CustomIntegerLiteral::emit(EmitCtx* ctx) {
 				if (i + 1 < value.length()) {
 					if (value.at(i + 1) == '_') {
 						ctx->Error("Two adjacent underscores found in custom integer literal",
-						           FileRange{fileRange.file,
+						           FileRange{fileRange.fileID,
 						                     FilePos{fileRange.start.line, fileRange.start.byteOffset + i},
 						                     FilePos{fileRange.start.line, fileRange.start.byteOffset + i + 1}});
 					}
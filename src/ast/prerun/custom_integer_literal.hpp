@@ -26,7 +26,7 @@ class CustomIntegerLiteral final : public PrerunExpression, public TypeInferrabl
 
 	useit static CustomIntegerLiteral* create(String _value, Maybe<bool> _isUnsigned, Maybe<u32> _bitWidth,
 	                                          Maybe<u8> _radix, Maybe<Identifier> _suffix, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(CustomIntegerLiteral), _value, _isUnsigned, _bitWidth, _radix, _suffix,
+		return std::construct_at(OwnAST(CustomIntegerLiteral), _value, _isUnsigned, _bitWidth, _radix, _suffix,
 		                         _fileRange);
 	}
 
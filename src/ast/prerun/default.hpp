@@ -14,7 +14,7 @@ class PrerunDefault final : public PrerunExpression, public TypeInferrable {
 	PrerunDefault(Maybe<ast::Type*> _type, FileRange range) : PrerunExpression(range), theType(_type) {}
 
 	useit static PrerunDefault* create(Maybe<ast::Type*> _type, FileRange _range) {
-		return std::construct_at(OwnNormal(PrerunDefault), _type, _range);
+		return std::construct_at(OwnAST(PrerunDefault), _type, _range);
 	}
 
 	void setGenericAbstract(ast::GenericAbstractType* genAbs) const;
@@ -1,4 +1,5 @@
 #include "./entity.hpp"
+#include "../../IR/prerun_cache.hpp"
 #include "../../IR/stdlib.hpp"
 #include "../../IR/types/flag.hpp"
 #include "../../IR/types/region.hpp"
@@ -45,6 +46,21 @@ void PrerunEntity::update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType
 }
 
 ir::PrerunValue* PrerunEntity::emit(EmitCtx* ctx) {
+	auto* result = find_value(ctx);
+	// Arguments, locals and prerun functions are tracked by the prerun cache itself. Anything else belongs to the rest
+	// of the program, and calls that depend on it are not kept across builds
+	if (ir::PrerunCache::is_recording() && (result != nullptr) && not result->is_prerun_function()) {
+		bool isLocal = (identifiers.size() == 1) && (relative == 0) && ctx->has_pre_call_state() &&
+		               (ctx->get_pre_call_state()->has_arg_with_name(identifiers[0].value) ||
+		                ctx->get_pre_call_state()->get_block()->has_local(identifiers[0].value));
+		if (not isLocal) {
+			ir::PrerunCache::record_outside_read();
+		}
+	}
+	return result;
+}
+
+ir::PrerunValue* PrerunEntity::find_value(EmitCtx* ctx) {
 	SHOW("PrerunEntity")
 	auto* mod  = ctx->mod;
 	auto  name = identifiers.back();
@@ -269,6 +285,13 @@ ir::PrerunValue* PrerunEntity::emit(EmitCtx* ctx) {
 	return nullptr;
 }
 
+Maybe<u32> PrerunEntity::lower_to_bytecode(ir::PreCompiler* compiler) {
+	if (identifiers.size() == 1 && relative == 0) {
+		return compiler->find_local(identifiers[0].value);
+	}
+	return None;
+}
+
 Json PrerunEntity::to_json() const {
 	Vec<JsonValue> idsJs;
 	for (auto const& idnt : identifiers) {
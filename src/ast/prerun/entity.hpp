@@ -13,17 +13,20 @@ class PrerunEntity final : public PrerunExpression {
 	u32             relative;
 	Vec<Identifier> identifiers;
 
+	useit ir::PrerunValue* find_value(EmitCtx* ctx);
+
   public:
 	PrerunEntity(u32 _relative, Vec<Identifier> _ids, FileRange _fileRange)
 	    : PrerunExpression(_fileRange), relative(_relative), identifiers(_ids) {}
 
 	useit static PrerunEntity* create(u32 _relative, Vec<Identifier> _ids, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(PrerunEntity), _relative, _ids, _fileRange);
+		return std::construct_at(OwnAST(PrerunEntity), _relative, _ids, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final;
 
 	useit ir::PrerunValue* emit(EmitCtx* ctx) override;
+	useit Maybe<u32>       lower_to_bytecode(ir::PreCompiler* compiler) final;
 	useit Json             to_json() const override;
 	useit String           to_string() const final;
 	useit NodeType         nodeType() const override { return NodeType::PRERUN_ENTITY; }
@@ -20,7 +20,7 @@ class FlagInitialiser final : public PrerunExpression, public TypeInferrable {
 
 	useit static FlagInitialiser* create(TypeLike type, Maybe<FileRange> specialRange, bool isSpecialDefault,
 	                                     Vec<Identifier> variants, FileRange range) {
-		return std::construct_at(OwnNormal(FlagInitialiser), type, std::move(specialRange), isSpecialDefault,
+		return std::construct_at(OwnAST(FlagInitialiser), type, std::move(specialRange), isSpecialDefault,
 		                         std::move(variants), std::move(range));
 	}
 
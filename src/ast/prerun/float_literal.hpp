@@ -13,7 +13,7 @@ class FloatLiteral final : public PrerunExpression, public TypeInferrable {
 	FloatLiteral(String _value, FileRange _fileRange) : PrerunExpression(_fileRange), value(_value) {}
 
 	useit static FloatLiteral* create(String _value, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(FloatLiteral), _value, _fileRange);
+		return std::construct_at(OwnAST(FloatLiteral), _value, _fileRange);
 	}
 
 	TYPE_INFERRABLE_FUNCTIONS
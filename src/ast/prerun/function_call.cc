@@ -1,4 +1,5 @@
 #include "./function_call.hpp"
+#include "../../IR/prerun_function.hpp"
 
 namespace qat::ast {
 
@@ -41,4 +42,38 @@ ir::PrerunValue* PrerunFunctionCall::emit(EmitCtx* ctx) {
 	return preFn->call_prerun(argVals, ctx->irCtx, fileRange);
 }
 
+Maybe<u32> PrerunFunctionCall::lower_to_bytecode(ir::PreCompiler* compiler) {
+	// Only direct calls to prerun functions are lowered. A local with the same name would shadow the function
+	if ((funcExp->nodeType() != NodeType::PRERUN_ENTITY) || funcExp->lower_to_bytecode(compiler).has_value()) {
+		return None;
+	}
+	auto candidate = funcExp->emit(compiler->get_ctx());
+	if (not candidate->is_prerun_function()) {
+		return None;
+	}
+	auto preFn = candidate->as_prerun_function();
+	auto fnTy  = preFn->get_ir_type()->as_function();
+	if (fnTy->is_variadic() || (fnTy->get_argument_count() != arguments.size())) {
+		return None;
+	}
+	Vec<u32> argRegs;
+	for (usize i = 0; i < arguments.size(); i++) {
+		auto* arg   = arguments[i];
+		auto  argTy = fnTy->get_argument_type_at(i)->get_type();
+		if (arg->has_type_inferrance()) {
+			arg->as_type_inferrable()->set_inference_type(argTy);
+		}
+		auto argReg = compiler->lower_expression(arg);
+		if (not argReg.has_value() || not compiler->get_type_of(argReg.value())->is_same(argTy)) {
+			return None;
+		}
+		argRegs.push_back(argReg.value());
+	}
+	auto givenTy = preFn->get_return_type();
+	if (not givenTy->is_void() && not ir::PreBytecode::is_supported_type(givenTy)) {
+		return None;
+	}
+	return compiler->add_call(preFn, std::move(argRegs), givenTy, fileRange);
+}
+
 } // namespace qat::ast
@@ -15,7 +15,7 @@ class PrerunFunctionCall : public PrerunExpression {
 
 	useit static PrerunFunctionCall* create(PrerunExpression* function, Vec<PrerunExpression*> arguments,
 	                                        FileRange fileRange) {
-		return std::construct_at(OwnNormal(PrerunFunctionCall), function, std::move(arguments), std::move(fileRange));
+		return std::construct_at(OwnAST(PrerunFunctionCall), function, std::move(arguments), std::move(fileRange));
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -26,6 +26,7 @@ class PrerunFunctionCall : public PrerunExpression {
 	}
 
 	useit ir::PrerunValue* emit(EmitCtx* ctx) final;
+	useit Maybe<u32>       lower_to_bytecode(ir::PreCompiler* compiler) final;
 
 	useit NodeType nodeType() const final { return NodeType::PRERUN_FUNCTION_CALL; }
 
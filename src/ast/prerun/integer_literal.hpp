@@ -15,7 +15,7 @@ class IntegerLiteral final : public PrerunExpression, public TypeInferrable {
 	    : PrerunExpression(std::move(_fileRange)), value(std::move(_value)), bits(_bits) {}
 
 	useit static IntegerLiteral* create(String _value, Maybe<Pair<u64, FileRange>> _bits, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(IntegerLiteral), _value, _bits, _fileRange);
+		return std::construct_at(OwnAST(IntegerLiteral), _value, _bits, _fileRange);
 	}
 
 	TYPE_INFERRABLE_FUNCTIONS
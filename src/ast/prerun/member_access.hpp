@@ -14,7 +14,7 @@ class PrerunMemberAccess final : public PrerunExpression {
 	    : PrerunExpression(std::move(_fileRange)), expr(_expr), memberName(_member) {}
 
 	useit static PrerunMemberAccess* create(PrerunExpression* _expr, Identifier _member, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(PrerunMemberAccess), _expr, _member, _fileRange);
+		return std::construct_at(OwnAST(PrerunMemberAccess), _expr, _member, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -26,8 +26,40 @@ ir::PrerunValue* handle_type_wrap_functions(ir::PrerunValue* typed, Vec<PrerunEx
 	return handle_type_wrap_functions(typed, args, memberName, ctx, fileRange);
 }
 
+static ir::PrerunValue* compute_type_trait(ir::PrerunValue* typed, Vec<Expression*> const& arguments,
+                                           Identifier memberName, EmitCtx* ctx, FileRange fileRange);
+
+/// Whether the result of the trait is fixed as soon as the type exists. Traits that depend on the members, copy and
+/// move semantics or default values of a type can change after the first query, and are always recomputed
+static bool is_cacheable_trait(String const& name) {
+	return (name == "byte_size") || (name == "bit_size") || (name == "is_packed") ||
+	       (name == "get_element_count") || name.starts_with("is_any_") ||
+	       (name.starts_with("is_") && name.ends_with("_type")) || (name == "is_struct");
+}
+
 ir::PrerunValue* handle_type_wrap_functions(ir::PrerunValue* typed, Vec<Expression*> const& arguments,
                                             Identifier memberName, EmitCtx* ctx, FileRange fileRange) {
+	// Layout and kind traits only depend on the type, so their result is reused by every later query of the same
+	// trait on the same type. The name is not cached, as its text constant belongs to the module of the query
+	if (not arguments.empty() || not is_cacheable_trait(memberName.value)) {
+		return compute_type_trait(typed, arguments, memberName, ctx, fileRange);
+	}
+	auto* typeInfo = ir::TypeInfo::get_for(typed->get_llvm_constant());
+	auto  cached   = typeInfo->traitResults.find(memberName.value);
+	if (cached != typeInfo->traitResults.end()) {
+		return ir::PrerunValue::get(cached->second.first, cached->second.second);
+	}
+	auto* result = compute_type_trait(typed, arguments, memberName, ctx, fileRange);
+	// The size of a type that is not sized yet is a placeholder, and is computed again once the type is complete
+	bool isPlaceholder = memberName.value.ends_with("_size") && not typeInfo->type->is_type_sized();
+	if ((result != nullptr) && not isPlaceholder) {
+		typeInfo->traitResults[memberName.value] = {result->get_llvm_constant(), result->get_ir_type()};
+	}
+	return result;
+}
+
+static ir::PrerunValue* compute_type_trait(ir::PrerunValue* typed, Vec<Expression*> const& arguments,
+                                           Identifier memberName, EmitCtx* ctx, FileRange fileRange) {
 	auto zeroArgCheck = [&]() {
 		if (arguments.size() != 0) {
 			ctx->Error("The type trait " + ctx->color(memberName.value) +
@@ -61,8 +93,7 @@ ir::PrerunValue* handle_type_wrap_functions(ir::PrerunValue* typed, Vec<Expressi
 		return ir::PrerunValue::get(
 		    llvm::ConstantStruct::get(
 		        llvm::cast<llvm::StructType>(ir::TextType::get(ctx->irCtx)->get_llvm_type()),
-		        {ctx->irCtx->builder.CreateGlobalStringPtr(result, ctx->irCtx->get_global_string_name(), 0U,
-		                                                   ctx->mod->get_llvm_module()),
+		        {ctx->irCtx->get_text_constant(result, ctx->mod->get_llvm_module()),
 		         llvm::ConstantInt::get(llvm::Type::getInt64Ty(ctx->irCtx->llctx), result.length())}),
 		    ir::TextType::get(ctx->irCtx));
 	} else if (memberName.value == "is_packed") {
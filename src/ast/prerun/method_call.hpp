@@ -17,7 +17,7 @@ class PrerunMemberFnCall final : public PrerunExpression {
 
 	useit static PrerunMemberFnCall* create(PrerunExpression* instance, Identifier memberName,
 	                                        Vec<PrerunExpression*> arguments, FileRange fileRange) {
-		return std::construct_at(OwnNormal(PrerunMemberFnCall), instance, memberName, arguments, fileRange);
+		return std::construct_at(OwnAST(PrerunMemberFnCall), instance, memberName, arguments, fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -21,7 +21,7 @@ class PrerunMixOrChoiceInit final : public PrerunExpression, public TypeInferrab
 
 	useit static PrerunMixOrChoiceInit* create(TypeLike type, Identifier subName, Maybe<PrerunExpression*> expression,
 	                                           FileRange fileRange) {
-		return std::construct_at(OwnNormal(PrerunMixOrChoiceInit), type, subName, expression, fileRange);
+		return std::construct_at(OwnAST(PrerunMixOrChoiceInit), type, subName, expression, fileRange);
 	}
 
 	LOCAL_DECL_COMPATIBLE_FUNCTIONS
@@ -44,6 +44,27 @@ ir::PrerunValue* PrerunNegative::emit(EmitCtx* ctx) {
 	return nullptr;
 }
 
+Maybe<u32> PrerunNegative::lower_to_bytecode(ir::PreCompiler* compiler) {
+	if (is_type_inferred() && value->has_type_inferrance()) {
+		value->as_type_inferrable()->set_inference_type(inferredType);
+	}
+	auto valReg = compiler->lower_expression(value);
+	if (not valReg.has_value()) {
+		return None;
+	}
+	auto valTy = compiler->get_type_of(valReg.value());
+	if (is_type_inferred() && not valTy->is_same(inferredType)) {
+		return None;
+	}
+	if (valTy->is_integer() || valTy->is_float()) {
+		auto result = compiler->new_register(valTy);
+		compiler->add_instruction(valTy->is_integer() ? ir::PreOp::negate : ir::PreOp::floatNegate,
+		                          ir::PreBytecode::get_width(valTy), result, valReg.value());
+		return result;
+	}
+	return None;
+}
+
 String PrerunNegative::to_string() const { return "-" + value->to_string(); }
 
 Json PrerunNegative::to_json() const {
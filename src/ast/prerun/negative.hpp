@@ -12,7 +12,7 @@ class PrerunNegative final : public PrerunExpression, public TypeInferrable {
 	PrerunNegative(PrerunExpression* _value, FileRange _fileRange) : PrerunExpression(_fileRange), value(_value) {}
 
 	useit static PrerunNegative* create(PrerunExpression* value, FileRange fileRange) {
-		return std::construct_at(OwnNormal(PrerunNegative), value, fileRange);
+		return std::construct_at(OwnAST(PrerunNegative), value, fileRange);
 	}
 
 	TYPE_INFERRABLE_FUNCTIONS
@@ -22,6 +22,7 @@ class PrerunNegative final : public PrerunExpression, public TypeInferrable {
 	}
 
 	ir::PrerunValue* emit(EmitCtx* ctx);
+	useit Maybe<u32> lower_to_bytecode(ir::PreCompiler* compiler) final;
 	useit Json       to_json() const;
 	useit String     to_string() const;
 	useit NodeType   nodeType() const { return NodeType::PRERUN_NEGATIVE; }
@@ -17,7 +17,7 @@ class NoneExpression final : public PrerunExpression, public TypeInferrable {
 	    : PrerunExpression(std::move(_fileRange)), type(_type), isPacked(_isPacked) {}
 
 	useit static NoneExpression* create(Maybe<FileRange> isPacked, Type* _type, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(NoneExpression), isPacked, _type, _fileRange);
+		return std::construct_at(OwnAST(NoneExpression), isPacked, _type, _fileRange);
 	}
 
 	useit bool hasTypeSet() const { return type != nullptr; }
@@ -14,7 +14,7 @@ class NullPointer final : public PrerunExpression, public TypeInferrable {
 	    : PrerunExpression(_fileRange), providedType(_providedType) {}
 
 	useit static NullPointer* create(Maybe<ast::Type*> _providedType, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(NullPointer), _providedType, _fileRange);
+		return std::construct_at(OwnAST(NullPointer), _providedType, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
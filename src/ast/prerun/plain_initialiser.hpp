@@ -19,7 +19,7 @@ class PrerunPlainInit final : public PrerunExpression, public TypeInferrable {
 
 	useit static PrerunPlainInit* create(TypeLike _type, Maybe<Vec<Identifier>> _fields,
 	                                     Vec<PrerunExpression*> _fieldValues, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(PrerunPlainInit), _type, _fields, _fieldValues, _fileRange);
+		return std::construct_at(OwnAST(PrerunPlainInit), _type, _fields, _fieldValues, _fileRange);
 	}
 
 	TYPE_INFERRABLE_FUNCTIONS
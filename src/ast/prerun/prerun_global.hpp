@@ -19,7 +19,7 @@ class PrerunGlobal final : public IsEntity {
 
 	useit static PrerunGlobal* create(Identifier _name, Maybe<Type*> _type, PrerunExpression* _value,
 	                                  Maybe<VisibilitySpec> _visibSpec, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(PrerunGlobal), _name, _type, _value, _visibSpec, _fileRange);
+		return std::construct_at(OwnAST(PrerunGlobal), _name, _type, _value, _visibSpec, _fileRange);
 	}
 
 	void create_entity(ir::Mod* parent, ir::Ctx* irCtx) final;
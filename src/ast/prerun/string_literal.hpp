@@ -15,7 +15,7 @@ class StringLiteral final : public PrerunExpression {
 	    : PrerunExpression(std::move(_fileRange)), value(std::move(_value)) {}
 
 	useit static StringLiteral* create(String _value, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(StringLiteral), _value, _fileRange);
+		return std::construct_at(OwnAST(StringLiteral), _value, _fileRange);
 	}
 
 	void addValue(const String& val, const FileRange& fRange);
@@ -1,4 +1,5 @@
 #include "./sub_entity.hpp"
+#include "../../IR/prerun_cache.hpp"
 #include "../sub_entity_solver.hpp"
 
 namespace qat::ast {
@@ -11,6 +12,7 @@ void PrerunSubEntity::update_dependencies(ir::EmitPhase phase, Maybe<ir::DependT
 }
 
 ir::PrerunValue* PrerunSubEntity::emit(EmitCtx* ctx) {
+	ir::PrerunCache::record_outside_read();
 	SubEntityResult subRes;
 	if (skill.has_value()) {
 		if (not ctx->has_skill() && (not ctx->has_member_parent() || not ctx->get_member_parent()->is_done_skill())) {
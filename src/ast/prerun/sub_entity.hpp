@@ -20,7 +20,7 @@ class PrerunSubEntity final : public PrerunExpression {
 
 	useit static PrerunSubEntity* create(Maybe<FileRange> skill, Maybe<FileRange> doneSkill, Vec<Identifier> names,
 	                                     TypeLike parentType, FileRange fileRange) {
-		return std::construct_at(OwnNormal(PrerunSubEntity), std::move(skill), std::move(doneSkill), std::move(names),
+		return std::construct_at(OwnAST(PrerunSubEntity), std::move(skill), std::move(doneSkill), std::move(names),
 		                         parentType, std::move(fileRange));
 	}
 
@@ -15,7 +15,7 @@ class PrerunTo final : public PrerunExpression {
 	    : PrerunExpression(_fileRange), value(_value), targetType(_targetType) {}
 
 	useit static PrerunTo* create(PrerunExpression* _value, Type* _targetType, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(PrerunTo), _value, _targetType, _fileRange);
+		return std::construct_at(OwnAST(PrerunTo), _value, _targetType, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final;
@@ -13,7 +13,7 @@ class PrerunTupleValue final : public PrerunExpression, public TypeInferrable {
 	    : PrerunExpression(_fileRange), members(_members) {}
 
 	useit static PrerunTupleValue* create(Vec<PrerunExpression*> _members, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(PrerunTupleValue), _members, _fileRange);
+		return std::construct_at(OwnAST(PrerunTupleValue), _members, _fileRange);
 	}
 
 	TYPE_INFERRABLE_FUNCTIONS
@@ -21,7 +21,7 @@ class TypeWrap final : public PrerunExpression {
 	    : PrerunExpression(_fileRange), theType(_theType), isExplicit(_isExplicit) {}
 
 	useit static TypeWrap* create(ast::Type* _theType, bool _isExplicit, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(TypeWrap), _theType, _isExplicit, _fileRange);
+		return std::construct_at(OwnAST(TypeWrap), _theType, _isExplicit, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final;
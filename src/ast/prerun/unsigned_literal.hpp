@@ -16,7 +16,7 @@ class UnsignedLiteral final : public PrerunExpression, public TypeInferrable {
 	    : PrerunExpression(_fileRange), value(_value), bits(_bits) {}
 
 	useit static UnsignedLiteral* create(String _value, Maybe<Pair<u64, FileRange>> bits, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(UnsignedLiteral), _value, bits, _fileRange);
+		return std::construct_at(OwnAST(UnsignedLiteral), _value, bits, _fileRange);
 	}
 
 	TYPE_INFERRABLE_FUNCTIONS
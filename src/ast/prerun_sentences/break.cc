@@ -1,23 +1,24 @@
 #include "./break.hpp"
-#include "./internal_exceptions.hpp"
 
 namespace qat::ast {
 
-void PrerunBreak::emit(EmitCtx* ctx) {
+PrerunCompletion PrerunBreak::emit(EmitCtx* ctx) {
 	if (ctx->get_pre_call_state()->loopsInfo.empty()) {
 		ctx->Error("This " + ctx->color("break") + " is not inside a loop. Please check your logic", fileRange);
 	}
 	if (tag.has_value()) {
 		for (auto& inf : ctx->get_pre_call_state()->loopsInfo) {
 			if (inf.tag.has_value() && inf.tag->value == tag->value) {
-				throw InternalPrerunBreak{tag->value};
+				return PrerunCompletion::loop_break(tag->value);
 			}
 		}
+		ctx->Error("No loop found with the tag " + ctx->color(tag->value), tag->range);
 	} else if (ctx->get_pre_call_state()->loopsInfo.size() == 1) {
-		throw InternalPrerunBreak();
+		return PrerunCompletion::loop_break(None);
 	} else {
 		ctx->Error("Found multiple nested loops. Please provide the tag of the loop to break from", fileRange);
 	}
+	return PrerunCompletion::normal();
 }
 
 } // namespace qat::ast
@@ -13,10 +13,14 @@ class PrerunBreak final : public PrerunSentence {
 	    : PrerunSentence(std::move(_fileRange)), tag(std::move(_tag)) {}
 
 	useit static PrerunBreak* create(Maybe<Identifier> tag, FileRange fileRange) {
-		return std::construct_at(OwnNormal(PrerunBreak), std::move(tag), std::move(fileRange));
+		return std::construct_at(OwnAST(PrerunBreak), std::move(tag), std::move(fileRange));
 	}
 
-	void emit(EmitCtx* ctx) final;
+	useit PrerunCompletion emit(EmitCtx* ctx) final;
+
+	useit bool lower_to_bytecode(ir::PreCompiler* compiler) final {
+		return compiler->add_loop_exit(tag.has_value() ? Maybe<String>(tag->value) : None, true);
+	}
 };
 
 } // namespace qat::ast
@@ -8,7 +8,7 @@ void PrerunExpressionSentence::update_dependencies(ir::EmitPhase phase, Maybe<ir
 	expression->update_dependencies(phase, expect, ent, ctx);
 }
 
-void PrerunExpressionSentence::emit(EmitCtx* ctx) {
+PrerunCompletion PrerunExpressionSentence::emit(EmitCtx* ctx) {
 	auto expRes = expression->emit(ctx);
 	if (not expRes->get_ir_type()->is_void()) {
 		ctx->Error("Unused value of type " + ctx->color(expRes->get_ir_type()->to_string()) +
@@ -16,6 +16,12 @@ void PrerunExpressionSentence::emit(EmitCtx* ctx) {
 		               ctx->color("let ... = " + expression->to_string() + ".") + " to ignore the value",
 		           fileRange);
 	}
+	return PrerunCompletion::normal();
+}
+
+bool PrerunExpressionSentence::lower_to_bytecode(ir::PreCompiler* compiler) {
+	auto expReg = compiler->lower_expression(expression);
+	return expReg.has_value() && compiler->get_type_of(expReg.value())->is_void();
 }
 
 } // namespace qat::ast
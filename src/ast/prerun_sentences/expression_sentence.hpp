@@ -13,12 +13,14 @@ class PrerunExpressionSentence : public PrerunSentence {
 	    : PrerunSentence(std::move(_fileRange)), expression(_exp) {}
 
 	useit static PrerunExpressionSentence* create(PrerunExpression* expression, FileRange fileRange) {
-		return std::construct_at(OwnNormal(PrerunExpressionSentence), expression, std::move(fileRange));
+		return std::construct_at(OwnAST(PrerunExpressionSentence), expression, std::move(fileRange));
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent, EmitCtx* ctx);
 
-	void emit(EmitCtx* ctx);
+	useit PrerunCompletion emit(EmitCtx* ctx) final;
+
+	useit bool lower_to_bytecode(ir::PreCompiler* compiler) final;
 };
 
 } // namespace qat::ast
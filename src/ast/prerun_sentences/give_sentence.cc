@@ -1,10 +1,9 @@
 #include "./give_sentence.hpp"
 #include "../../IR/types/void.hpp"
-#include "./internal_exceptions.hpp"
 
 namespace qat::ast {
 
-void PrerunGive::emit(EmitCtx* ctx) {
+PrerunCompletion PrerunGive::emit(EmitCtx* ctx) {
 	if (ctx->has_pre_call_state()) {
 		if (value.has_value()) {
 			if (value.value()->has_type_inferrance()) {
@@ -13,7 +12,7 @@ void PrerunGive::emit(EmitCtx* ctx) {
 			}
 			auto retVal = value.value()->emit(ctx);
 			if (ctx->get_pre_call_state()->get_function()->get_return_type()->is_same(retVal->get_ir_type())) {
-				throw InternalPrerunGive{retVal};
+				return PrerunCompletion::give(retVal);
 			} else {
 				ctx->Error("This function expects a given value of type " +
 				               ctx->color(ctx->get_pre_call_state()->get_function()->get_return_type()->to_string()) +
@@ -28,11 +27,34 @@ void PrerunGive::emit(EmitCtx* ctx) {
 				               ", so a value should be provided",
 				           fileRange);
 			}
-			throw InternalPrerunGive{ir::PrerunValue::get(nullptr, ir::VoidType::get(ctx->irCtx->llctx))};
+			return PrerunCompletion::give(ir::PrerunValue::get(nullptr, ir::VoidType::get(ctx->irCtx->llctx)));
 		}
 	} else {
 		ctx->Error("No function call state for this give sentence", fileRange);
 	}
+	return PrerunCompletion::normal();
+}
+
+bool PrerunGive::lower_to_bytecode(ir::PreCompiler* compiler) {
+	auto retTy = compiler->get_function()->get_return_type();
+	if (value.has_value()) {
+		if (retTy->is_void()) {
+			return false;
+		}
+		if (value.value()->has_type_inferrance()) {
+			value.value()->as_type_inferrable()->set_inference_type(retTy);
+		}
+		auto valReg = compiler->lower_expression(value.value());
+		if (not valReg.has_value() || not compiler->get_type_of(valReg.value())->is_same(retTy)) {
+			return false;
+		}
+		compiler->add_instruction(ir::PreOp::give, 0u, 0u, valReg.value());
+		return true;
+	} else if (retTy->is_void()) {
+		compiler->add_instruction(ir::PreOp::giveVoid, 0u, 0u);
+		return true;
+	}
+	return false;
 }
 
 } // namespace qat::ast
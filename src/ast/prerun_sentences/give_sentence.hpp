@@ -13,10 +13,12 @@ class PrerunGive final : public PrerunSentence {
 	PrerunGive(Maybe<PrerunExpression*> _value, FileRange _fileRange) : PrerunSentence(_fileRange), value(_value) {}
 
 	useit static PrerunGive* create(Maybe<PrerunExpression*> value, FileRange fileRange) {
-		return std::construct_at(OwnNormal(PrerunGive), value, fileRange);
+		return std::construct_at(OwnAST(PrerunGive), value, fileRange);
 	}
 
-	void emit(EmitCtx* ctx) final;
+	useit PrerunCompletion emit(EmitCtx* ctx) final;
+
+	useit bool lower_to_bytecode(ir::PreCompiler* compiler) final;
 };
 
 } // namespace qat::ast
@@ -22,7 +22,7 @@ void PrerunIfElse::update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType
 	}
 }
 
-void PrerunIfElse::emit(EmitCtx* ctx) {
+PrerunCompletion PrerunIfElse::emit(EmitCtx* ctx) {
 	auto ifCond = ifBlock.first->emit(ctx);
 	if (not ifCond->get_ir_type()->is_bool()) {
 		ctx->Error("This condition is expected to be of type " + ctx->color("bool") +
@@ -32,13 +32,11 @@ void PrerunIfElse::emit(EmitCtx* ctx) {
 	if (llvm::cast<llvm::ConstantInt>(ifCond->get_llvm_constant())->getValue().getBoolValue()) {
 		auto block = ir::PreBlock::create_next_to(ctx->get_pre_call_state()->get_block());
 		block->make_active();
-		for (auto* snt : ifBlock.second) {
-			snt->emit(ctx);
-		}
+		auto completion = PrerunSentence::emit_all(ifBlock.second, ctx);
 		ir::PreBlock::create_next_to(block)->make_active();
+		return completion;
 	} else {
 		// IF CONDITION IS FALSE
-		bool executedBlock = false;
 		for (auto& ch : elseIfChain) {
 			auto cond = ch.first->emit(ctx);
 			if (not cond->get_ir_type()->is_bool()) {
@@ -47,25 +45,55 @@ void PrerunIfElse::emit(EmitCtx* ctx) {
 				           ch.first->fileRange);
 			}
 			if (llvm::cast<llvm::ConstantInt>(cond->get_llvm_constant())->getValue().getBoolValue()) {
-				executedBlock = true;
-				auto block    = ir::PreBlock::create_next_to(ctx->get_pre_call_state()->get_block());
+				auto block = ir::PreBlock::create_next_to(ctx->get_pre_call_state()->get_block());
 				block->make_active();
-				for (auto* snt : ch.second) {
-					snt->emit(ctx);
-				}
+				auto completion = PrerunSentence::emit_all(ch.second, ctx);
 				ir::PreBlock::create_next_to(block)->make_active();
-				break;
+				return completion;
 			}
 		}
-		if (not executedBlock && elseBlock.has_value()) {
+		if (elseBlock.has_value()) {
 			auto block = ir::PreBlock::create_next_to(ctx->get_pre_call_state()->get_block());
 			block->make_active();
-			for (auto* snt : elseBlock.value()) {
-				snt->emit(ctx);
-			}
+			auto completion = PrerunSentence::emit_all(elseBlock.value(), ctx);
 			ir::PreBlock::create_next_to(block)->make_active();
+			return completion;
+		}
+	}
+	return PrerunCompletion::normal();
+}
+
+bool PrerunIfElse::lower_to_bytecode(ir::PreCompiler* compiler) {
+	Vec<u32> exitJumps;
+
+	auto lowerBranch = [&](PrerunExpression* condition, Vec<PrerunSentence*> const& sentences) {
+		auto condReg = compiler->lower_expression(condition);
+		if (not condReg.has_value() || not compiler->get_type_of(condReg.value())->is_bool()) {
+			return false;
+		}
+		auto skipJump = compiler->add_instruction(ir::PreOp::jumpIfFalse, 0u, 0u, condReg.value());
+		if (not compiler->lower_sentences(sentences)) {
+			return false;
+		}
+		exitJumps.push_back(compiler->add_instruction(ir::PreOp::jump, 0u, 0u));
+		compiler->set_jump_target(skipJump, compiler->get_next_position());
+		return true;
+	};
+	if (not lowerBranch(ifBlock.first, ifBlock.second)) {
+		return false;
+	}
+	for (auto& chain : elseIfChain) {
+		if (not lowerBranch(chain.first, chain.second)) {
+			return false;
 		}
 	}
+	if (elseBlock.has_value() && not compiler->lower_sentences(elseBlock.value())) {
+		return false;
+	}
+	for (auto exit : exitJumps) {
+		compiler->set_jump_target(exit, compiler->get_next_position());
+	}
+	return true;
 }
 
 } // namespace qat::ast
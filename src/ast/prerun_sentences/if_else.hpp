@@ -20,14 +20,16 @@ class PrerunIfElse final : public PrerunSentence {
 	useit static PrerunIfElse* create(Pair<PrerunExpression*, Vec<PrerunSentence*>>      ifBlock,
 	                                  Vec<Pair<PrerunExpression*, Vec<PrerunSentence*>>> elseIfChain,
 	                                  Maybe<Vec<PrerunSentence*>> elseBlock, FileRange fileRange) {
-		return std::construct_at(OwnNormal(PrerunIfElse), std::move(ifBlock), std::move(elseIfChain),
+		return std::construct_at(OwnAST(PrerunIfElse), std::move(ifBlock), std::move(elseIfChain),
 		                         std::move(elseBlock), std::move(fileRange));
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
 	                         EmitCtx* ctx) final;
 
-	void emit(EmitCtx* ctx) final;
+	useit PrerunCompletion emit(EmitCtx* ctx) final;
+
+	useit bool lower_to_bytecode(ir::PreCompiler* compiler) final;
 };
 
 } // namespace qat::ast
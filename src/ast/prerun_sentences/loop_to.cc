@@ -1,35 +1,32 @@
 #include "./loop_to.hpp"
+#include "../../IR/prerun_profile.hpp"
 #include "../../IR/types/unsigned.hpp"
-#include "./internal_exceptions.hpp"
 
 #include <llvm/Analysis/ConstantFolding.h>
 #include <llvm/IR/Constants.h>
 
-// I LOVE EXCEPTIONS from now on...
+// Runs one iteration of the loop. A break or continue that targets another loop, and a give, end the loop and are
+// provided to the parent sentence
 #define PRERUN_LOOP_BASIC_CONTENTS                                                                                     \
-	try {                                                                                                              \
-		for (auto* snt : sentences) {                                                                                  \
-			snt->emit(ctx);                                                                                            \
-		}                                                                                                              \
-	} catch (InternalPrerunBreak & brk) {                                                                              \
-		if (tag.has_value() && ((not brk.tag.has_value()) || (brk.tag.value() == tag->value))) {                       \
+	if (not ir::PrerunProfile::add_step()) {                                                                           \
+		ctx->Error(ir::PrerunProfile::step_limit_message(), fileRange);                                                \
+	}                                                                                                                  \
+	if (profileEntry != nullptr) {                                                                                     \
+		profileEntry->iterations++;                                                                                    \
+	}                                                                                                                  \
+	auto completion = PrerunSentence::emit_all(sentences, ctx);                                                        \
+	if (completion.is_exit_of_loop(tag)) {                                                                             \
+		if (completion.is_break()) {                                                                                   \
 			break;                                                                                                     \
-		} else {                                                                                                       \
-			throw brk;                                                                                                 \
-		}                                                                                                              \
-	} catch (InternalPrerunContinue & cont) {                                                                          \
-		if (tag.has_value() && ((not cont.tag.has_value()) || (cont.tag.value() == tag->value))) {                     \
-			continue;                                                                                                  \
-		} else {                                                                                                       \
-			throw cont;                                                                                                \
 		}                                                                                                              \
-	} catch (...) {                                                                                                    \
-		throw;                                                                                                         \
+	} else if (not completion.is_normal()) {                                                                           \
+		result = std::move(completion);                                                                                \
+		break;                                                                                                         \
 	}
 
 namespace qat::ast {
 
-void PrerunLoopTo::emit(EmitCtx* ctx) {
+PrerunCompletion PrerunLoopTo::emit(EmitCtx* ctx) {
 	auto countExp = count->emit(ctx);
 	auto countTy  = countExp->get_ir_type();
 
@@ -45,14 +42,22 @@ void PrerunLoopTo::emit(EmitCtx* ctx) {
 		ctx->get_pre_call_state()->loopsInfo.push_back(ir::PreLoopInfo{.kind = ir::PreLoopKind::TO, .tag = tag});
 		auto block = ir::PreBlock::create_next_to(ctx->get_pre_call_state()->get_block());
 		block->make_active();
+		auto result = PrerunCompletion::normal();
+
+		auto nameFn = [&]() {
+			return "loop to in " + ctx->get_pre_call_state()->get_function()->get_full_name();
+		};
+
+		auto profileEntry = ir::PrerunProfile::get_entry(this, ir::PrerunProfileKind::loop, nameFn, fileRange);
+
+		ir::PrerunProfileScope profileScope(profileEntry);
 		if (countTy->is_integer() && (countTy->as_integer()->get_bitwidth() <= 64u) && not tag.has_value()) {
-			auto countVal = *reinterpret_cast<i64 const*>(
-			    llvm::cast<llvm::ConstantInt>(countExp->get_llvm_constant())->getValue().getRawData());
+			auto countVal = llvm::cast<llvm::ConstantInt>(countExp->get_llvm_constant())->getSExtValue();
 			for (i64 i = 0; i < countVal; i++) {
 				PRERUN_LOOP_BASIC_CONTENTS
 			}
 		} else if (countTy->is_unsigned() && (countTy->as_unsigned()->get_bitwidth() <= 64u) && not tag.has_value()) {
-			auto countVal = *llvm::cast<llvm::ConstantInt>(countExp->get_llvm_constant())->getValue().getRawData();
+			auto countVal = llvm::cast<llvm::ConstantInt>(countExp->get_llvm_constant())->getZExtValue();
 			for (u64 i = 0; i < countVal; i++) {
 				PRERUN_LOOP_BASIC_CONTENTS
 			}
@@ -62,6 +67,7 @@ void PrerunLoopTo::emit(EmitCtx* ctx) {
 			auto             index      = llvm::ConstantInt::get(countTy->get_llvm_type(), 0u, not isUnsigned);
 			if (tag.has_value()) {
 				indexLocal = ir::PrerunLocal::get(tag.value(), countTy, false, index);
+				block->add_local(indexLocal);
 			}
 			for (; llvm::cast<llvm::ConstantInt>(llvm::ConstantFoldCompareInstruction(
 			                                         isUnsigned ? llvm::CmpInst::ICMP_ULT : llvm::CmpInst::ICMP_SLT,
@@ -76,17 +82,57 @@ void PrerunLoopTo::emit(EmitCtx* ctx) {
 				     if (indexLocal != nullptr) {
 					     indexLocal->change_value(index);
 				     }
-			     }) {
+			     }()) {
 				PRERUN_LOOP_BASIC_CONTENTS
 			}
 		}
 		ir::PreBlock::create_next_to(block)->make_active();
 		ctx->get_pre_call_state()->loopsInfo.pop_back();
+		return result;
 	} else {
 		ctx->Error("Count of the " + ctx->color("loop to") + " is required to be of signed or unsigned integer type. " +
 		               "The provided expression is of type " + ctx->color(countTy->to_string()),
 		           count->fileRange);
 	}
+	return PrerunCompletion::normal();
+}
+
+bool PrerunLoopTo::lower_to_bytecode(ir::PreCompiler* compiler) {
+	auto countReg = compiler->lower_expression(count);
+	if (not countReg.has_value()) {
+		return false;
+	}
+	auto countTy = compiler->get_type_of(countReg.value());
+	if ((not countTy->is_integer() && not countTy->is_unsigned()) ||
+	    (tag.has_value() && compiler->has_loop_with_tag(tag->value))) {
+		return false;
+	}
+	const auto width    = ir::PreBytecode::get_width(countTy);
+	auto       indexReg = compiler->add_constant(ir::PreRegister{.bits = 0u}, countTy);
+	auto       oneReg   = compiler->add_constant(ir::PreRegister{.bits = 1u}, countTy);
+	auto       condReg  = compiler->new_register(ir::UnsignedType::create_bool(compiler->get_ctx()->irCtx));
+	auto       loopSite = compiler->add_loop_site(this, fileRange);
+	compiler->add_instruction(ir::PreOp::loopEnter, 0u, 0u, loopSite);
+	auto condPos = compiler->get_next_position();
+	compiler->add_instruction(countTy->is_integer() ? ir::PreOp::signedLess : ir::PreOp::unsignedLess, width, condReg,
+	                          indexReg, countReg.value());
+	auto exitJump = compiler->add_instruction(ir::PreOp::jumpIfFalse, 0u, 0u, condReg);
+	compiler->push_loop(tag.has_value() ? Maybe<String>(tag->value) : None);
+	if (tag.has_value()) {
+		compiler->push_local(tag->value, indexReg);
+	}
+	if (not compiler->lower_sentences(sentences)) {
+		return false;
+	}
+	if (tag.has_value()) {
+		compiler->pop_local();
+	}
+	auto continuePos = compiler->get_next_position();
+	compiler->add_instruction(ir::PreOp::add, width, indexReg, indexReg, oneReg);
+	compiler->add_instruction(ir::PreOp::loopBack, 0u, condPos, loopSite);
+	compiler->set_jump_target(exitJump, compiler->get_next_position());
+	compiler->pop_loop(continuePos, compiler->get_next_position());
+	return true;
 }
 
 } // namespace qat::ast
@@ -14,7 +14,7 @@ class PrerunLoopTo final : public PrerunSentence {
   public:
 	PrerunLoopTo(PrerunExpression* _count, Maybe<Identifier> _tag, Vec<PrerunSentence*> _sentences,
 	             FileRange _fileRange)
-	    : PrerunSentence(_fileRange), count(_count), sentences(std::move(_sentences)) {}
+	    : PrerunSentence(_fileRange), count(_count), tag(std::move(_tag)), sentences(std::move(_sentences)) {}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent, EmitCtx* ctx) {
 		UPDATE_DEPS(count);
@@ -25,10 +25,12 @@ class PrerunLoopTo final : public PrerunSentence {
 
 	useit static PrerunLoopTo* create(PrerunExpression* count, Maybe<Identifier> tag, Vec<PrerunSentence*> sentences,
 	                                  FileRange fileRange) {
-		return std::construct_at(OwnNormal(PrerunLoopTo), count, std::move(tag), std::move(sentences), fileRange);
+		return std::construct_at(OwnAST(PrerunLoopTo), count, std::move(tag), std::move(sentences), fileRange);
 	}
 
-	void emit(EmitCtx* ctx) final;
+	useit PrerunCompletion emit(EmitCtx* ctx) final;
+
+	useit bool lower_to_bytecode(ir::PreCompiler* compiler) final;
 };
 
 } // namespace qat::ast
@@ -1,10 +1,51 @@
 #ifndef QAT_AST_PRERUN_SENTENCE_HPP
 #define QAT_AST_PRERUN_SENTENCE_HPP
 
+#include "../../IR/prerun_bytecode.hpp"
 #include "../emit_ctx.hpp"
 
 namespace qat::ast {
 
+enum class PrerunCompletionKind : u8 {
+	normal,
+	loopBreak,
+	loopContinue,
+	give,
+};
+
+/// How a prerun sentence completed. Anything other than a normal completion skips the remaining sentences, until it
+/// is consumed by the loop or the function call it belongs to
+struct PrerunCompletion {
+	PrerunCompletionKind kind  = PrerunCompletionKind::normal;
+	Maybe<String>        tag   = None;
+	ir::PrerunValue*     value = nullptr;
+
+	useit static PrerunCompletion normal() { return PrerunCompletion{}; }
+
+	useit static PrerunCompletion loop_break(Maybe<String> tag) {
+		return PrerunCompletion{.kind = PrerunCompletionKind::loopBreak, .tag = std::move(tag)};
+	}
+
+	useit static PrerunCompletion loop_continue(Maybe<String> tag) {
+		return PrerunCompletion{.kind = PrerunCompletionKind::loopContinue, .tag = std::move(tag)};
+	}
+
+	useit static PrerunCompletion give(ir::PrerunValue* value) {
+		return PrerunCompletion{.kind = PrerunCompletionKind::give, .value = value};
+	}
+
+	useit bool is_normal() const { return kind == PrerunCompletionKind::normal; }
+	useit bool is_break() const { return kind == PrerunCompletionKind::loopBreak; }
+	useit bool is_give() const { return kind == PrerunCompletionKind::give; }
+
+	/// Whether this is a break or continue that targets the loop with the provided tag. A break or continue without a
+	/// tag targets the innermost loop
+	useit bool is_exit_of_loop(Maybe<Identifier> const& loopTag) const {
+		return ((kind == PrerunCompletionKind::loopBreak) || (kind == PrerunCompletionKind::loopContinue)) &&
+		       ((not tag.has_value()) || (loopTag.has_value() && (loopTag->value == tag.value())));
+	}
+};
+
 class PrerunSentence {
   protected:
 	FileRange fileRange;
@@ -15,7 +56,20 @@ class PrerunSentence {
 	virtual void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
 	                                 EmitCtx* ctx) {}
 
-	virtual void emit(EmitCtx* ctx) = 0;
+	useit virtual PrerunCompletion emit(EmitCtx* ctx) = 0;
+
+	useit static PrerunCompletion emit_all(Vec<PrerunSentence*> const& sentences, EmitCtx* ctx) {
+		for (auto* snt : sentences) {
+			auto completion = snt->emit(ctx);
+			if (not completion.is_normal()) {
+				return completion;
+			}
+		}
+		return PrerunCompletion::normal();
+	}
+
+	/// Returns false if this sentence is not supported by the prerun bytecode
+	useit virtual bool lower_to_bytecode(ir::PreCompiler* compiler) { return false; }
 };
 
 } // namespace qat::ast
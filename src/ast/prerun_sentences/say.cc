@@ -1,4 +1,5 @@
 #include "./say.hpp"
+#include "../../IR/prerun_function.hpp"
 #include "../../IR/types/integer.hpp"
 #include "../expression.hpp"
 
@@ -11,7 +12,8 @@ void PrerunSay::update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> e
 	}
 }
 
-void PrerunSay::emit(EmitCtx* ctx) {
+PrerunCompletion PrerunSay::emit(EmitCtx* ctx) {
+	ir::PrerunFunction::record_side_effect();
 	for (auto val : values) {
 		auto irVal = val->emit(ctx);
 		auto irTy  = irVal->get_ir_type();
@@ -28,6 +30,7 @@ void PrerunSay::emit(EmitCtx* ctx) {
 		}
 	}
 	std::cout << '\n';
+	return PrerunCompletion::normal();
 }
 
 } // namespace qat::ast
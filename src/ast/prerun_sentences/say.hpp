@@ -13,13 +13,13 @@ class PrerunSay : public PrerunSentence {
 	    : PrerunSentence(std::move(_fileRange)), values(std::move(_values)) {}
 
 	useit static PrerunSay* create(Vec<PrerunExpression*> values, FileRange fileRange) {
-		return std::construct_at(OwnNormal(PrerunSay), std::move(values), fileRange);
+		return std::construct_at(OwnAST(PrerunSay), std::move(values), fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
 	                         EmitCtx* ctx) final;
 
-	void emit(EmitCtx* ctx) final;
+	useit PrerunCompletion emit(EmitCtx* ctx) final;
 };
 
 } // namespace qat::ast
@@ -18,7 +18,7 @@ class Assignment final : public Sentence {
 	    : Sentence(_fileRange), lhs(_lhs), value(_value) {}
 
 	useit static Assignment* create(Expression* _lhs, Expression* _value, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(Assignment), _lhs, _value, _fileRange);
+		return std::construct_at(OwnAST(Assignment), _lhs, _value, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -12,7 +12,7 @@ class Break final : public Sentence {
 	Break(Maybe<Identifier> _tag, FileRange _fileRange) : Sentence(_fileRange), tag(_tag) {}
 
 	useit static Break* create(Maybe<Identifier> _tag, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(Break), _tag, _fileRange);
+		return std::construct_at(OwnAST(Break), _tag, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
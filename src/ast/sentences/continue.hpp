@@ -12,7 +12,7 @@ class Continue final : public Sentence {
 	Continue(Maybe<Identifier> _tag, FileRange _fileRange) : Sentence(_fileRange), tag(_tag) {}
 
 	useit static Continue* create(Maybe<Identifier> _tag, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(Continue), _tag, _fileRange);
+		return std::construct_at(OwnAST(Continue), _tag, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
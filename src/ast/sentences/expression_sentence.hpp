@@ -13,7 +13,7 @@ class ExpressionSentence final : public Sentence {
 	ExpressionSentence(Expression* _expr, FileRange _fileRange) : Sentence(_fileRange), expr(_expr) {}
 
 	useit static ExpressionSentence* create(Expression* _expr, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(ExpressionSentence), _expr, _fileRange);
+		return std::construct_at(OwnAST(ExpressionSentence), _expr, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
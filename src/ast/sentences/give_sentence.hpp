@@ -16,7 +16,7 @@ class GiveSentence final : public Sentence {
 	    : Sentence(std::move(_fileRange)), give_expr(_given_expr) {}
 
 	useit static GiveSentence* create(Maybe<Expression*> _given_expr, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(GiveSentence), _given_expr, _fileRange);
+		return std::construct_at(OwnAST(GiveSentence), _given_expr, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -117,7 +117,7 @@ ir::Value* IfElse::emit(EmitCtx* ctx) {
 	}
 	restBlock->set_active(ctx->irCtx->builder);
 	if (ctx->get_fn()->has_definition_range()) {
-		restBlock->set_file_range(FileRange(fileRange.file, fileRange.end, ctx->get_fn()->get_definition_range().end));
+		restBlock->set_file_range(FileRange(fileRange.fileID, fileRange.end, ctx->get_fn()->get_definition_range().end));
 	}
 	return nullptr;
 }
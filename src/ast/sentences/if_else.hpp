@@ -22,7 +22,7 @@ class IfElse final : public Sentence {
 
 	useit static IfElse* create(Vec<std::tuple<Expression*, Vec<Sentence*>, FileRange>> _chain,
 	                            Maybe<Pair<Vec<Sentence*>, FileRange>> _else, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(IfElse), _chain, _else, _fileRange);
+		return std::construct_at(OwnAST(IfElse), _chain, _else, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
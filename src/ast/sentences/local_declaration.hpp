@@ -23,7 +23,7 @@ class LocalDeclaration final : public Sentence {
 
 	useit static LocalDeclaration* create(Type* _type, bool _isRef, Identifier _name, Maybe<Expression*> _value,
 	                                      bool _variability, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(LocalDeclaration), _type, _isRef, _name, _value, _variability, _fileRange);
+		return std::construct_at(OwnAST(LocalDeclaration), _type, _isRef, _name, _value, _variability, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
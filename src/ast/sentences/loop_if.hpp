@@ -20,7 +20,7 @@ class LoopIf final : public Sentence {
 
 	useit static LoopIf* create(bool _isDoAndLoop, Expression* _condition, Vec<Sentence*> _sentences,
 	                            Maybe<Identifier> _tag, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(LoopIf), _isDoAndLoop, _condition, _sentences, _tag, _fileRange);
+		return std::construct_at(OwnAST(LoopIf), _isDoAndLoop, _condition, _sentences, _tag, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
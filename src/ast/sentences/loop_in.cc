@@ -154,6 +154,12 @@ ir::Value* LoopIn::emit(EmitCtx* ctx) {
 			elemUseTy = ir::RefType::get(candHasVar, elemTy, ctx->irCtx);
 		}
 		auto itemVar = mainBlock->new_local(itemName.value, elemUseTy, false, itemName.range);
+		// The length is read once before the loop, so the index is only known to be valid for a local that cannot
+		// change
+		if (not isTyCString && candExp->is_local_value() && not candExp->is_variable() &&
+		    not candExp->get_ir_type()->is_ref()) {
+			ctx->loopsInfo.back().set_index_bound(indexVar, candExp->get_local_id().value());
+		}
 		ctx->irCtx->builder.CreateStore(llvm::ConstantInt::get(countTy->get_llvm_type(), 0u, false),
 		                                indexVar->get_llvm());
 		ctx->irCtx->builder.CreateCondBr(
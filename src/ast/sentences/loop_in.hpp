@@ -21,7 +21,7 @@ class LoopIn : public Sentence {
 
 	useit static LoopIn* create(Expression* candidate, Vec<Sentence*> sentences, Identifier itemName,
 	                            Maybe<Identifier> indexName, FileRange fileRange) {
-		return std::construct_at(OwnNormal(LoopIn), candidate, std::move(sentences), std::move(itemName),
+		return std::construct_at(OwnAST(LoopIn), candidate, std::move(sentences), std::move(itemName),
 		                         std::move(indexName), std::move(fileRange));
 	}
 
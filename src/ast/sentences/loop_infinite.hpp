@@ -15,7 +15,7 @@ class LoopInfinite final : public Sentence {
 	    : Sentence(_fileRange), sentences(_sentences), tag(_tag) {}
 
 	useit static LoopInfinite* create(Vec<Sentence*> _sentences, Maybe<Identifier> _tag, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(LoopInfinite), _sentences, _tag, _fileRange);
+		return std::construct_at(OwnAST(LoopInfinite), _sentences, _tag, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
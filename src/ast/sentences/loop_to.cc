@@ -1,6 +1,8 @@
 #include "./loop_to.hpp"
 #include "../../IR/control_flow.hpp"
 #include "../../utils/unique_id.hpp"
+#include "../expressions/entity.hpp"
+#include "../expressions/member_access.hpp"
 
 namespace qat::ast {
 
@@ -79,6 +81,18 @@ ir::Value* LoopTo::emit(EmitCtx* ctx) {
 		                   llCount))),
 		    trueBlock->get_bb(), restBlock->get_bb());
 		ctx->loopsInfo.push_back(LoopInfo(tag, trueBlock, condBlock, restBlock, loopIndex, LoopType::TO_COUNT));
+		// If the count is the length of a local that cannot change, the index is always a valid index of that local
+		if ((count->nodeType() == NodeType::MEMBER_ACCESS) &&
+		    (((MemberAccess*)count)->get_member_name().value == "length") &&
+		    (((MemberAccess*)count)->get_instance()->nodeType() == NodeType::ENTITY)) {
+			auto lengthOf = ((Entity*)(((MemberAccess*)count)->get_instance()))->get_single_name();
+			if (lengthOf.has_value() && trueBlock->has_value(lengthOf->value)) {
+				auto* local = trueBlock->get_value(lengthOf->value);
+				if (not local->is_variable() && not local->get_ir_type()->is_ref()) {
+					ctx->loopsInfo.back().set_index_bound(loopIndex, local->get_id());
+				}
+			}
+		}
 		ctx->breakables.push_back(Breakable(BreakableType::loop, tag, restBlock, trueBlock));
 		trueBlock->set_active(ctx->irCtx->builder);
 		emit_sentences(sentences, ctx);
@@ -17,7 +17,7 @@ class LoopTo final : public Sentence {
 
 	useit static LoopTo* create(Expression* _count, Vec<Sentence*> _snts, Maybe<Identifier> _tag,
 	                            FileRange _fileRange) {
-		return std::construct_at(OwnNormal(LoopTo), _count, _snts, _tag, _fileRange);
+		return std::construct_at(OwnAST(LoopTo), _count, _snts, _tag, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -2,6 +2,7 @@
 #include "../../IR/control_flow.hpp"
 #include "../../IR/logic.hpp"
 
+#include <algorithm>
 #include <llvm/IR/Constants.h>
 
 namespace qat::ast {
@@ -56,10 +57,21 @@ ir::Value* Match::emit(EmitCtx* ctx) {
 	if (expTy->is_mix()) {
 		auto*           mTy = expTy->as_mix();
 		Vec<Identifier> mentionedFields;
-		ir::Block*      falseBlock = nullptr;
+		auto*           tagType = llvm::Type::getIntNTy(ctx->irCtx->llctx, mTy->get_tag_bitwidth());
+		llvm::Value*    tagVal;
+		if (expEmit->is_value()) {
+			tagVal = ctx->irCtx->builder.CreateExtractValue(expEmit->get_llvm(), 0u);
+		} else {
+			tagVal = ctx->irCtx->builder.CreateLoad(
+			    tagType, ctx->irCtx->builder.CreateStructGEP(mTy->get_llvm_type(), expEmit->get_llvm(), 0));
+		}
+		// Every case is a variant of the mix type, so the tag selects the case directly. The variants cannot repeat, so
+		// the order of the cases does not affect the result
+		auto* falseBlock = ir::Block::create(ctx->get_fn(), curr);
+		auto* tagSwitch  = ctx->irCtx->builder.CreateSwitch(tagVal, falseBlock->get_bb());
 		for (usize i = 0; i < chain.size(); i++) {
-			const auto&       section = chain.at(i);
-			Vec<llvm::Value*> conditions;
+			const auto& section   = chain.at(i);
+			auto*       trueBlock = ir::Block::create(ctx->get_fn(), curr);
 			for (usize k = 0; k < section.first.size(); k++) {
 				if (section.first.at(k)->getType() != MatchType::mixOrChoice) {
 					ctx->Error("Expected the name of a variant of the mix type " +
@@ -112,32 +124,8 @@ ir::Value* Match::emit(EmitCtx* ctx) {
 					}
 				}
 				mentionedFields.push_back(uMatch->get_name());
-				conditions.push_back(ctx->irCtx->builder.CreateICmpEQ(
-				    expEmit->is_value()
-				        ? ctx->irCtx->builder.CreateExtractValue(expEmit->get_llvm(), 0u)
-				        : ctx->irCtx->builder.CreateLoad(
-				              llvm::Type::getIntNTy(ctx->irCtx->llctx, mTy->get_tag_bitwidth()),
-				              ctx->irCtx->builder.CreateStructGEP(mTy->get_llvm_type(), expEmit->get_llvm(), 0)),
-				    llvm::ConstantInt::get(llvm::Type::getIntNTy(ctx->irCtx->llctx, mTy->get_tag_bitwidth()),
-				                           mTy->get_index_of(uMatch->get_name().value))));
-			}
-			auto* trueBlock = ir::Block::create(ctx->get_fn(), curr);
-			falseBlock      = nullptr;
-			if (i == (chain.size() - 1) ? elseCase.has_value() : true) {
-				falseBlock = ir::Block::create(ctx->get_fn(), curr);
-				if (conditions.size() == 1) {
-					ctx->irCtx->builder.CreateCondBr(conditions.front(), trueBlock->get_bb(), falseBlock->get_bb());
-				} else {
-					ctx->irCtx->builder.CreateCondBr(ctx->irCtx->builder.CreateOr(conditions), trueBlock->get_bb(),
-					                                 falseBlock->get_bb());
-				}
-			} else {
-				if (conditions.size() == 1) {
-					ctx->irCtx->builder.CreateCondBr(conditions.front(), trueBlock->get_bb(), restBlock->get_bb());
-				} else {
-					ctx->irCtx->builder.CreateCondBr(ctx->irCtx->builder.CreateOr(conditions), trueBlock->get_bb(),
-					                                 restBlock->get_bb());
-				}
+				tagSwitch->addCase(
+				    llvm::ConstantInt::get(tagType, mTy->get_index_of(uMatch->get_name().value)), trueBlock->get_bb());
 			}
 			trueBlock->set_active(ctx->irCtx->builder);
 			SHOW("True block name is: " << trueBlock->get_name())
@@ -173,10 +161,8 @@ ir::Value* Match::emit(EmitCtx* ctx) {
 			emit_sentences(section.second, ctx);
 			trueBlock->destroy_locals(ctx);
 			(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
-			if (i == (chain.size() - 1) ? elseCase.has_value() : true) {
-				falseBlock->set_active(ctx->irCtx->builder);
-			}
 		}
+		falseBlock->set_active(ctx->irCtx->builder);
 		Vec<Identifier> missingFields;
 		mTy->get_missing_names(mentionedFields, missingFields);
 		if (missingFields.empty()) {
@@ -187,10 +173,7 @@ ir::Value* Match::emit(EmitCtx* ctx) {
 				                    elseCase.value().second);
 			}
 			elseNotRequired = true;
-			if (falseBlock) {
-				falseBlock->set_active(ctx->irCtx->builder);
-				(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
-			}
+			(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
 		} else {
 			if (not elseCase.has_value()) {
 				ctx->Error("Not all possible variants of the mix type are provided. "
@@ -209,11 +192,22 @@ ir::Value* Match::emit(EmitCtx* ctx) {
 		}
 		Vec<Identifier> mentionedFields;
 		ir::Block*      falseBlock = nullptr;
-		for (usize i = 0; i < chain.size(); i++) {
-			const auto&       section = chain.at(i);
-			Vec<llvm::Value*> caseComparisons;
+		bool            allVariants = true;
+		for (auto const& section : chain) {
 			for (auto* caseValElem : section.first) {
-				if (caseValElem->getType() == MatchType::mixOrChoice) {
+				if (caseValElem->getType() != MatchType::mixOrChoice) {
+					allVariants = false;
+				}
+			}
+		}
+		if (allVariants) {
+			// Variants that share a value go to the earliest case mentioning them, as with the chain of comparisons
+			falseBlock         = ir::Block::create(ctx->get_fn(), curr);
+			auto* choiceSwitch = ctx->irCtx->builder.CreateSwitch(choiceVal, falseBlock->get_bb());
+			Vec<llvm::ConstantInt*> switchedValues;
+			for (const auto& section : chain) {
+				auto* trueBlock = ir::Block::create(ctx->get_fn(), curr);
+				for (auto* caseValElem : section.first) {
 					auto* cMatch = caseValElem->asMixOrChoice();
 					if (cMatch->hasValueName()) {
 						ctx->Error("Destructuring an expression of choice type by name is not supported",
@@ -232,61 +226,105 @@ ir::Value* Match::emit(EmitCtx* ctx) {
 						}
 					}
 					mentionedFields.push_back(cMatch->get_name());
-					if (chTy->has_field(cMatch->get_name().value)) {
-						caseComparisons.push_back(
-						    ctx->irCtx->builder.CreateICmpEQ(choiceVal, chTy->get_value_for(cMatch->get_name().value)));
-					} else {
+					if (not chTy->has_field(cMatch->get_name().value)) {
 						ctx->Error("No variant named " + ctx->color(cMatch->get_name().value) + " in choice type " +
 						               ctx->color(chTy->get_full_name()),
 						           cMatch->get_name().range);
 					}
-				} else if (caseValElem->getType() == MatchType::Exp) {
-					auto* eMatch  = caseValElem->asExp();
-					auto* caseExp = eMatch->getExpression()->emit(ctx);
-					if (caseExp->get_ir_type()->is_choice() ||
-					    (caseExp->get_ir_type()->is_ref() &&
-					     caseExp->get_ir_type()->as_ref()->get_subtype()->is_choice())) {
-						if (caseExp->get_ir_type()->is_choice() && caseExp->is_ghost_ref()) {
-							caseComparisons.push_back(ctx->irCtx->builder.CreateICmpEQ(
-							    choiceVal, ctx->irCtx->builder.CreateLoad(chTy->get_llvm_type(), caseExp->get_llvm())));
-						} else if (caseExp->get_ir_type()->is_ref()) {
-							caseExp->load_ghost_ref(ctx->irCtx->builder);
+					auto* variantVal = chTy->get_value_for(cMatch->get_name().value);
+					if (std::find(switchedValues.begin(), switchedValues.end(), variantVal) == switchedValues.end()) {
+						switchedValues.push_back(variantVal);
+						choiceSwitch->addCase(variantVal, trueBlock->get_bb());
+					}
+				}
+				trueBlock->set_active(ctx->irCtx->builder);
+				emit_sentences(section.second, ctx);
+				trueBlock->destroy_locals(ctx);
+				(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
+			}
+			falseBlock->set_active(ctx->irCtx->builder);
+		} else {
+			for (usize i = 0; i < chain.size(); i++) {
+				const auto&       section = chain.at(i);
+				Vec<llvm::Value*> caseComparisons;
+				for (auto* caseValElem : section.first) {
+					if (caseValElem->getType() == MatchType::mixOrChoice) {
+						auto* cMatch = caseValElem->asMixOrChoice();
+						if (cMatch->hasValueName()) {
+							ctx->Error("Destructuring an expression of choice type by name is not supported",
+							           cMatch->getValueName().range);
+						}
+						for (const auto& mField : mentionedFields) {
+							if (mField.value == cMatch->get_name().value) {
+								ctx->Error("The variant " + ctx->color(cMatch->get_name().value) + " of choice type " +
+								               ctx->color(chTy->get_full_name()) +
+								               " is repeating here. Please check logic and make necessary changes",
+								           cMatch->getMainRange(),
+								           Pair<String, FileRange>{"The previous occurrence of " +
+								                                       ctx->color(cMatch->get_name().value) +
+								                                       " can be found here",
+								                                   cMatch->getMainRange()});
+							}
+						}
+						mentionedFields.push_back(cMatch->get_name());
+						if (chTy->has_field(cMatch->get_name().value)) {
 							caseComparisons.push_back(ctx->irCtx->builder.CreateICmpEQ(
-							    choiceVal, ctx->irCtx->builder.CreateLoad(chTy->get_llvm_type(), caseExp->get_llvm())));
+							    choiceVal, chTy->get_value_for(cMatch->get_name().value)));
+						} else {
+							ctx->Error("No variant named " + ctx->color(cMatch->get_name().value) + " in choice type " +
+							               ctx->color(chTy->get_full_name()),
+							           cMatch->get_name().range);
+						}
+					} else if (caseValElem->getType() == MatchType::Exp) {
+						auto* eMatch  = caseValElem->asExp();
+						auto* caseExp = eMatch->getExpression()->emit(ctx);
+						if (caseExp->get_ir_type()->is_choice() ||
+						    (caseExp->get_ir_type()->is_ref() &&
+						     caseExp->get_ir_type()->as_ref()->get_subtype()->is_choice())) {
+							if (caseExp->get_ir_type()->is_choice() && caseExp->is_ghost_ref()) {
+								caseComparisons.push_back(ctx->irCtx->builder.CreateICmpEQ(
+								    choiceVal,
+								    ctx->irCtx->builder.CreateLoad(chTy->get_llvm_type(), caseExp->get_llvm())));
+							} else if (caseExp->get_ir_type()->is_ref()) {
+								caseExp->load_ghost_ref(ctx->irCtx->builder);
+								caseComparisons.push_back(ctx->irCtx->builder.CreateICmpEQ(
+								    choiceVal,
+								    ctx->irCtx->builder.CreateLoad(chTy->get_llvm_type(), caseExp->get_llvm())));
+							}
+						} else {
+							ctx->Error("Expected either the name of a variant of, "
+							           "or an expression of type " +
+							               ctx->color(chTy->get_full_name()),
+							           eMatch->getMainRange());
 						}
 					} else {
-						ctx->Error("Expected either the name of a variant of, "
-						           "or an expression of type " +
-						               ctx->color(chTy->get_full_name()),
-						           eMatch->getMainRange());
+						ctx->Error(
+						    "Unexpected kind of match value found here, it should either be a choice match or an expression",
+						    caseValElem->getMainRange());
 					}
+				}
+				auto* trueBlock = ir::Block::create(ctx->get_fn(), curr);
+				// NOTE - Maybe change this?
+				falseBlock = nullptr;
+				llvm::Value* cond;
+				if (caseComparisons.size() > 1) {
+					cond = ctx->irCtx->builder.CreateOr(caseComparisons);
 				} else {
-					ctx->Error(
-					    "Unexpected kind of match value found here, it should either be a choice match or an expression",
-					    caseValElem->getMainRange());
+					cond = caseComparisons.front();
+				}
+				if (i == (chain.size() - 1) ? elseCase.has_value() : true) {
+					falseBlock = ir::Block::create(ctx->get_fn(), curr);
+					ctx->irCtx->builder.CreateCondBr(cond, trueBlock->get_bb(), falseBlock->get_bb());
+				} else {
+					ctx->irCtx->builder.CreateCondBr(cond, trueBlock->get_bb(), restBlock->get_bb());
+				}
+				trueBlock->set_active(ctx->irCtx->builder);
+				emit_sentences(section.second, ctx);
+				trueBlock->destroy_locals(ctx);
+				(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
+				if (i == (chain.size() - 1) ? elseCase.has_value() : true) {
+					falseBlock->set_active(ctx->irCtx->builder);
 				}
-			}
-			auto* trueBlock = ir::Block::create(ctx->get_fn(), curr);
-			// NOTE - Maybe change this?
-			falseBlock = nullptr;
-			llvm::Value* cond;
-			if (caseComparisons.size() > 1) {
-				cond = ctx->irCtx->builder.CreateOr(caseComparisons);
-			} else {
-				cond = caseComparisons.front();
-			}
-			if (i == (chain.size() - 1) ? elseCase.has_value() : true) {
-				falseBlock = ir::Block::create(ctx->get_fn(), curr);
-				ctx->irCtx->builder.CreateCondBr(cond, trueBlock->get_bb(), falseBlock->get_bb());
-			} else {
-				ctx->irCtx->builder.CreateCondBr(cond, trueBlock->get_bb(), restBlock->get_bb());
-			}
-			trueBlock->set_active(ctx->irCtx->builder);
-			emit_sentences(section.second, ctx);
-			trueBlock->destroy_locals(ctx);
-			(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
-			if (i == (chain.size() - 1) ? elseCase.has_value() : true) {
-				falseBlock->set_active(ctx->irCtx->builder);
 			}
 		}
 		Vec<Identifier> missingFields;
@@ -334,157 +372,177 @@ ir::Value* Match::emit(EmitCtx* ctx) {
 			                     llvm::Type::getInt64Ty(ctx->irCtx->llctx),
 			                     ctx->irCtx->builder.CreateStructGEP(strTy->get_llvm_type(), expEmit->get_llvm(), 1u));
 		}
+		bool useLengthBuckets = not isMatchStrConstant;
 		for (auto& section : chain) {
-			SHOW("Number of match values for this case: " << section.first.size())
-			Vec<ir::Value*> irStrVals;
-			bool            hasConstantVals   = false;
-			bool            areAllConstValues = true;
 			for (auto* strExp : section.first) {
-				if (strExp->getType() != MatchType::Exp) {
-					ctx->Error(
-					    "Invalid match type. Expected an expression in this match case since the candidate expression to match is a text",
-					    strExp->getMainRange());
-				}
-				auto* strEmit = strExp->asExp()->getExpression()->emit(ctx);
-				irStrVals.push_back(strEmit);
-				if (strEmit->is_prerun_value()) {
-					hasConstantVals = true;
-				} else {
-					areAllConstValues = false;
+				if ((strExp->getType() != MatchType::Exp) ||
+				    (strExp->asExp()->getExpression()->nodeType() != NodeType::STRING_LITERAL)) {
+					useLengthBuckets = false;
 				}
 			}
-			if (hasConstantVals && isMatchStrConstant) {
-				bool caseRes = false;
-				for (auto* irStr : irStrVals) {
-					if (irStr->is_prerun_value()) {
-						auto* irStrConst = irStr->get_llvm_constant();
-						SHOW("Comparing constant string in match block")
-						if (ir::Logic::compare_prerun_text(llvm::cast<llvm::Constant>(strBuff),
-						                                   llvm::cast<llvm::Constant>(strCount),
-						                                   irStrConst->getAggregateElement(0u),
-						                                   irStrConst->getAggregateElement(1u), ctx->irCtx->llctx)) {
-							caseRes = true;
-							break;
-						}
-					}
-				}
-				matchResult.push_back(CaseResult(caseRes, areAllConstValues));
-				SHOW("Case constant result: " << (caseRes ? "true" : "false"))
-				if (caseRes) {
-					auto* trueBlock = ir::Block::create(ctx->get_fn(), curr);
-					(void)ir::add_branch(ctx->irCtx->builder, trueBlock->get_bb());
-					trueBlock->set_active(ctx->irCtx->builder);
-					emit_sentences(section.second, ctx);
-					trueBlock->destroy_locals(ctx);
-					(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
-					break;
-				} else {
-					if (areAllConstValues) {
-						continue;
+		}
+		if (useLengthBuckets) {
+			// When every case is a text literal, the length of the candidate selects the literals that can match, so
+			// the candidate is only compared with the literals of its length. The literals of a length are compared in
+			// the order of the cases, so that the first case that matches is chosen
+			auto*                                         Ty64Int = llvm::Type::getInt64Ty(ctx->irCtx->llctx);
+			Vec<ir::Block*>                               caseBlocks;
+			Vec<Pair<u64, Vec<Pair<llvm::Value*, usize>>>> buckets;
+			for (usize i = 0; i < chain.size(); i++) {
+				caseBlocks.push_back(ir::Block::create(ctx->get_fn(), curr));
+				for (auto* strExp : chain[i].first) {
+					auto* strConst = strExp->asExp()->getExpression()->emit(ctx)->get_llvm_constant();
+					auto  length   = llvm::cast<llvm::ConstantInt>(strConst->getAggregateElement(1u))->getZExtValue();
+					auto  bucket   = std::find_if(buckets.begin(), buckets.end(),
+					                              [&](auto const& existing) { return existing.first == length; });
+					if (bucket == buckets.end()) {
+						buckets.push_back({length, {}});
+						bucket = buckets.end() - 1;
 					}
+					bucket->second.push_back({strConst->getAggregateElement(0u), i});
 				}
-			} else {
 				matchResult.push_back(CaseResult(None, false));
 			}
-			SHOW("Creating case true block")
-			auto* caseTrueBlock = ir::Block::create(ctx->get_fn(), curr);
-			SHOW("Creating case false block")
-			auto* checkFalseBlock = ir::Block::create(ctx->get_fn(), curr);
-			SHOW("Setting thisCaseFalseBlock")
-			ir::Block* thisCaseFalseBlock;
-			for (usize j = 0; j < section.first.size(); j++) {
-				if (irStrVals.at(j)->is_prerun_value() && isMatchStrConstant) {
-					continue;
+			auto* noMatchBlock = ir::Block::create(ctx->get_fn(), curr);
+			auto* lengthSwitch = ctx->irCtx->builder.CreateSwitch(strCount, noMatchBlock->get_bb(), buckets.size());
+			for (auto& bucket : buckets) {
+				auto* bucketBlock = ir::Block::create(ctx->get_fn(), curr);
+				lengthSwitch->addCase(llvm::ConstantInt::get(Ty64Int, bucket.first), bucketBlock->get_bb());
+				bucketBlock->set_active(ctx->irCtx->builder);
+				for (auto& literal : bucket.second) {
+					auto* nextBlock = ir::Block::create(ctx->get_fn(), curr);
+					ctx->irCtx->builder.CreateCondBr(
+					    ir::Logic::compare_text_bytes(strBuff, literal.first,
+					                                  llvm::ConstantInt::get(Ty64Int, bucket.first), ctx, fileRange),
+					    caseBlocks[literal.second]->get_bb(), nextBlock->get_bb());
+					nextBlock->set_active(ctx->irCtx->builder);
 				}
-				if (j == section.first.size() - 1) {
-					thisCaseFalseBlock = checkFalseBlock;
-				} else {
-					thisCaseFalseBlock = ir::Block::create(ctx->get_fn(), curr);
+				(void)ir::add_branch(ctx->irCtx->builder, noMatchBlock->get_bb());
+			}
+			for (usize i = 0; i < chain.size(); i++) {
+				caseBlocks[i]->set_active(ctx->irCtx->builder);
+				emit_sentences(chain[i].second, ctx);
+				caseBlocks[i]->destroy_locals(ctx);
+				(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
+			}
+			noMatchBlock->set_active(ctx->irCtx->builder);
+		} else {
+			for (auto& section : chain) {
+				SHOW("Number of match values for this case: " << section.first.size())
+				Vec<ir::Value*> irStrVals;
+				bool            hasConstantVals   = false;
+				bool            areAllConstValues = true;
+				for (auto* strExp : section.first) {
+					if (strExp->getType() != MatchType::Exp) {
+						ctx->Error(
+						    "Invalid match type. Expected an expression in this match case since the candidate expression to match is a text",
+						    strExp->getMainRange());
+					}
+					auto* strEmit = strExp->asExp()->getExpression()->emit(ctx);
+					irStrVals.push_back(strEmit);
+					if (strEmit->is_prerun_value()) {
+						hasConstantVals = true;
+					} else {
+						areAllConstValues = false;
+					}
 				}
-				ir::Value*   caseIR       = irStrVals.at(j);
-				llvm::Value* caseStrBuff  = nullptr;
-				llvm::Value* caseStrCount = nullptr;
-				// FIXME - Add optimisation for constant strings
-				if (caseIR->get_ir_type()->is_text() ||
-				    (caseIR->is_ref() && caseIR->get_ir_type()->as_ref()->get_subtype()->is_text())) {
-					auto* elemIter = ctx->get_fn()->get_str_comparison_index();
-					if (caseIR->is_prerun_value()) {
-						caseStrBuff  = caseIR->get_llvm_constant()->getAggregateElement(0u);
-						caseStrCount = caseIR->get_llvm_constant()->getAggregateElement(1u);
+				if (hasConstantVals && isMatchStrConstant) {
+					bool caseRes = false;
+					for (auto* irStr : irStrVals) {
+						if (irStr->is_prerun_value()) {
+							auto* irStrConst = irStr->get_llvm_constant();
+							SHOW("Comparing constant string in match block")
+							if (ir::Logic::compare_prerun_text(
+							        llvm::cast<llvm::Constant>(strBuff), llvm::cast<llvm::Constant>(strCount),
+							        irStrConst->getAggregateElement(0u), irStrConst->getAggregateElement(1u),
+							        ctx->irCtx->llctx)) {
+								caseRes = true;
+								break;
+							}
+						}
+					}
+					matchResult.push_back(CaseResult(caseRes, areAllConstValues));
+					SHOW("Case constant result: " << (caseRes ? "true" : "false"))
+					if (caseRes) {
+						auto* trueBlock = ir::Block::create(ctx->get_fn(), curr);
+						(void)ir::add_branch(ctx->irCtx->builder, trueBlock->get_bb());
+						trueBlock->set_active(ctx->irCtx->builder);
+						emit_sentences(section.second, ctx);
+						trueBlock->destroy_locals(ctx);
+						(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
+						break;
 					} else {
-						if (caseIR->is_ref()) {
-							caseIR->load_ghost_ref(ctx->irCtx->builder);
+						if (areAllConstValues) {
+							continue;
 						}
-						caseStrBuff  = caseIR->is_value()
-						                   ? ctx->irCtx->builder.CreateExtractValue(caseIR->get_llvm(), {0u})
-						                   : ctx->irCtx->builder.CreateLoad(
-                                                llvm::Type::getInt8Ty(ctx->irCtx->llctx)
-                                                    ->getPointerTo(ctx->irCtx->dataLayout.getProgramAddressSpace()),
-                                                ctx->irCtx->builder.CreateStructGEP(strTy->get_llvm_type(),
-						                                                             caseIR->get_llvm(), 0u));
-						caseStrCount = ctx->irCtx->builder.CreateLoad(
-						    llvm::Type::getInt64Ty(ctx->irCtx->llctx),
-						    caseIR->is_value()
-						        ? ctx->irCtx->builder.CreateExtractValue(caseIR->get_llvm(), {1u})
-						        : ctx->irCtx->builder.CreateStructGEP(strTy->get_llvm_type(), caseIR->get_llvm(), 1u));
 					}
-					auto* Ty64Int = llvm::Type::getInt64Ty(ctx->irCtx->llctx);
-					SHOW("Creating lenCheckTrueBlock")
-					auto* lenCheckTrueBlock = ir::Block::create(ctx->get_fn(), curr);
-					ctx->irCtx->builder.CreateCondBr(ctx->irCtx->builder.CreateICmpEQ(strCount, caseStrCount),
-					                                 lenCheckTrueBlock->get_bb(), thisCaseFalseBlock->get_bb());
-					lenCheckTrueBlock->set_active(ctx->irCtx->builder);
-					ctx->irCtx->builder.CreateStore(llvm::ConstantInt::get(Ty64Int, 0u), elemIter->get_llvm());
-					SHOW("Creating iter cond block")
-					auto* iterCondBlock = ir::Block::create(ctx->get_fn(), lenCheckTrueBlock);
-					SHOW("Creating iter true block")
-					auto* iterTrueBlock = ir::Block::create(ctx->get_fn(), lenCheckTrueBlock);
-					SHOW("Creating iter false block")
-					auto* iterFalseBlock = ir::Block::create(ctx->get_fn(), lenCheckTrueBlock);
-					(void)ir::add_branch(ctx->irCtx->builder, iterCondBlock->get_bb());
-					iterCondBlock->set_active(ctx->irCtx->builder);
-					ctx->irCtx->builder.CreateCondBr(
-					    ctx->irCtx->builder.CreateICmpULT(ctx->irCtx->builder.CreateLoad(Ty64Int, elemIter->get_llvm()),
-					                                      caseStrCount),
-					    iterTrueBlock->get_bb(), iterFalseBlock->get_bb());
-					iterTrueBlock->set_active(ctx->irCtx->builder);
-					auto* Ty8Int = llvm::Type::getInt8Ty(ctx->irCtx->llctx);
-					SHOW("Creating iter incr block")
-					auto* iterIncrBlock = ir::Block::create(ctx->get_fn(), lenCheckTrueBlock);
-					ctx->irCtx->builder.CreateCondBr(
-					    ctx->irCtx->builder.CreateICmpEQ(
-					        ctx->irCtx->builder.CreateLoad(
-					            Ty8Int,
-					            ctx->irCtx->builder.CreateInBoundsGEP(
-					                Ty8Int, strBuff, {ctx->irCtx->builder.CreateLoad(Ty64Int, elemIter->get_llvm())})),
-					        ctx->irCtx->builder.CreateLoad(
-					            Ty8Int, ctx->irCtx->builder.CreateInBoundsGEP(
-					                        Ty8Int, caseStrBuff,
-					                        {ctx->irCtx->builder.CreateLoad(Ty64Int, elemIter->get_llvm())}))),
-					    iterIncrBlock->get_bb(), iterFalseBlock->get_bb());
-					iterIncrBlock->set_active(ctx->irCtx->builder);
-					ctx->irCtx->builder.CreateStore(
-					    ctx->irCtx->builder.CreateAdd(ctx->irCtx->builder.CreateLoad(Ty64Int, elemIter->get_llvm()),
-					                                  llvm::ConstantInt::get(Ty64Int, 1u)),
-					    elemIter->get_llvm());
-					(void)ir::add_branch(ctx->irCtx->builder, iterCondBlock->get_bb());
-					iterFalseBlock->set_active(ctx->irCtx->builder);
-					ctx->irCtx->builder.CreateCondBr(
-					    ctx->irCtx->builder.CreateICmpEQ(strCount,
-					                                     ctx->irCtx->builder.CreateLoad(Ty64Int, elemIter->get_llvm())),
-					    caseTrueBlock->get_bb(), thisCaseFalseBlock->get_bb());
 				} else {
-					ctx->Error("Expected a text to be the expression for this match case",
-					           section.first.at(j)->getMainRange());
+					matchResult.push_back(CaseResult(None, false));
 				}
-				SHOW("Setting thisCaseFalseBlock active")
-				thisCaseFalseBlock->set_active(ctx->irCtx->builder);
+				SHOW("Creating case true block")
+				auto* caseTrueBlock = ir::Block::create(ctx->get_fn(), curr);
+				SHOW("Creating case false block")
+				auto* checkFalseBlock = ir::Block::create(ctx->get_fn(), curr);
+				SHOW("Setting thisCaseFalseBlock")
+				ir::Block* thisCaseFalseBlock;
+				for (usize j = 0; j < section.first.size(); j++) {
+					if (irStrVals.at(j)->is_prerun_value() && isMatchStrConstant) {
+						continue;
+					}
+					if (j == section.first.size() - 1) {
+						thisCaseFalseBlock = checkFalseBlock;
+					} else {
+						thisCaseFalseBlock = ir::Block::create(ctx->get_fn(), curr);
+					}
+					ir::Value*   caseIR       = irStrVals.at(j);
+					llvm::Value* caseStrBuff  = nullptr;
+					llvm::Value* caseStrCount = nullptr;
+					if (caseIR->get_ir_type()->is_text() ||
+					    (caseIR->is_ref() && caseIR->get_ir_type()->as_ref()->get_subtype()->is_text())) {
+						if (caseIR->is_prerun_value()) {
+							caseStrBuff  = caseIR->get_llvm_constant()->getAggregateElement(0u);
+							caseStrCount = caseIR->get_llvm_constant()->getAggregateElement(1u);
+						} else {
+							if (caseIR->is_ref()) {
+								caseIR->load_ghost_ref(ctx->irCtx->builder);
+							}
+							caseStrBuff  = caseIR->is_value()
+							                   ? ctx->irCtx->builder.CreateExtractValue(caseIR->get_llvm(), {0u})
+							                   : ctx->irCtx->builder.CreateLoad(
+							                         llvm::Type::getInt8Ty(ctx->irCtx->llctx)
+							                             ->getPointerTo(ctx->irCtx->dataLayout.getProgramAddressSpace()),
+							                         ctx->irCtx->builder.CreateStructGEP(strTy->get_llvm_type(),
+							                                                             caseIR->get_llvm(), 0u));
+							caseStrCount = caseIR->is_value()
+							                   ? ctx->irCtx->builder.CreateExtractValue(caseIR->get_llvm(), {1u})
+							                   : ctx->irCtx->builder.CreateLoad(
+							                         llvm::Type::getInt64Ty(ctx->irCtx->llctx),
+							                         ctx->irCtx->builder.CreateStructGEP(strTy->get_llvm_type(),
+							                                                             caseIR->get_llvm(), 1u));
+						}
+						SHOW("Creating lenCheckTrueBlock")
+						auto* lenCheckTrueBlock = ir::Block::create(ctx->get_fn(), curr);
+						ctx->irCtx->builder.CreateCondBr(ctx->irCtx->builder.CreateICmpEQ(strCount, caseStrCount),
+						                                 lenCheckTrueBlock->get_bb(), thisCaseFalseBlock->get_bb());
+						lenCheckTrueBlock->set_active(ctx->irCtx->builder);
+						ctx->irCtx->builder.CreateCondBr(
+						    ir::Logic::compare_text_bytes(strBuff, caseStrBuff,
+						                                  caseIR->is_prerun_value() ? caseStrCount : strCount, ctx,
+						                                  section.first.at(j)->getMainRange()),
+						    caseTrueBlock->get_bb(), thisCaseFalseBlock->get_bb());
+					} else {
+						ctx->Error("Expected a text to be the expression for this match case",
+						           section.first.at(j)->getMainRange());
+					}
+					SHOW("Setting thisCaseFalseBlock active")
+					thisCaseFalseBlock->set_active(ctx->irCtx->builder);
+				}
+				caseTrueBlock->set_active(ctx->irCtx->builder);
+				emit_sentences(section.second, ctx);
+				caseTrueBlock->destroy_locals(ctx);
+				(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
+				checkFalseBlock->set_active(ctx->irCtx->builder);
 			}
-			caseTrueBlock->set_active(ctx->irCtx->builder);
-			emit_sentences(section.second, ctx);
-			caseTrueBlock->destroy_locals(ctx);
-			(void)ir::add_branch(ctx->irCtx->builder, restBlock->get_bb());
-			checkFalseBlock->set_active(ctx->irCtx->builder);
 		}
 	}
 	if (elseCase.has_value()) {
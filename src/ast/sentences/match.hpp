@@ -35,7 +35,7 @@ class MixOrChoiceMatchValue final : public MatchValue {
   public:
 	MixOrChoiceMatchValue(Identifier name, Maybe<Identifier> valueName, bool isVar);
 	useit static MixOrChoiceMatchValue* create(Identifier name, Maybe<Identifier> valueName, bool isVar) {
-		return std::construct_at(OwnNormal(MixOrChoiceMatchValue), name, valueName, isVar);
+		return std::construct_at(OwnAST(MixOrChoiceMatchValue), name, valueName, isVar);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -58,7 +58,7 @@ class ExpressionMatchValue final : public MatchValue {
 	explicit ExpressionMatchValue(Expression* _exp) : exp(_exp) {}
 
 	useit static ExpressionMatchValue* create(Expression* exp) {
-		return std::construct_at(OwnNormal(ExpressionMatchValue), exp);
+		return std::construct_at(OwnAST(ExpressionMatchValue), exp);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -94,7 +94,7 @@ class Match final : public Sentence {
 	useit static Match* create(bool _isTypeMatch, Expression* _candidate,
 	                           Vec<Pair<Vec<MatchValue*>, Vec<Sentence*>>> _chain,
 	                           Maybe<Pair<Vec<Sentence*>, FileRange>> _elseCase, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(Match), _isTypeMatch, _candidate, _chain, _elseCase, _fileRange);
+		return std::construct_at(OwnAST(Match), _isTypeMatch, _candidate, _chain, _elseCase, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
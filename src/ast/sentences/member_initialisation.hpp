@@ -23,7 +23,7 @@ class MemberInit final : public Sentence {
 
 	useit static MemberInit* create(Identifier _memName, Expression* _value, bool _isInitOfMixVariantWithoutValue,
 	                                FileRange _fileRange) {
-		return std::construct_at(OwnNormal(MemberInit), _memName, _value, _isInitOfMixVariantWithoutValue, _fileRange);
+		return std::construct_at(OwnAST(MemberInit), _memName, _value, _isInitOfMixVariantWithoutValue, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
@@ -1,5 +1,6 @@
 #include "./say_sentence.hpp"
 #include "../../IR/logic.hpp"
+#include "../../IR/say_runtime.hpp"
 #include "../../cli/config.hpp"
 
 namespace qat::ast {
@@ -9,8 +10,6 @@ ir::Value* SayLike::emit(EmitCtx* ctx) {
 	if ((sayType == SayType::dbg) ? cfg->is_build_mode_debug() : true) {
 		SHOW("Say sentence emitting..")
 		SHOW("Current block is: " << ctx->get_fn()->get_block()->get_name())
-		auto  printfName = ctx->mod->link_internal_dependency(ir::InternalDependency::printf, ctx->irCtx, fileRange);
-		auto* printfFn   = ctx->mod->get_llvm_module()->getFunction(printfName);
 		Vec<ir::Value*> valuesIR;
 		Vec<FileRange>  valuesRange;
 		for (usize i = 0; i < expressions.size(); i++) {
@@ -21,8 +20,21 @@ ir::Value* SayLike::emit(EmitCtx* ctx) {
 		if (sayType != SayType::only) {
 			fmtRes.first += "\n";
 		}
+		if (ir::SayRuntime::is_supported(ctx->irCtx)) {
+			ir::Logic::write_formatted(ctx, fmtRes.first, fmtRes.second, fileRange);
+			if (sayType != SayType::only) {
+				auto  lineEndName =
+				    ctx->mod->link_internal_dependency(ir::InternalDependency::sayLineEnd, ctx->irCtx, fileRange);
+				auto* lineEndFn = ctx->mod->get_llvm_module()->getFunction(lineEndName);
+				ctx->irCtx->builder.CreateCall(lineEndFn->getFunctionType(), lineEndFn, {});
+			}
+			return nullptr;
+		}
+		auto  printfName = ctx->mod->link_internal_dependency(ir::InternalDependency::printf, ctx->irCtx, fileRange);
+		auto* printfFn   = ctx->mod->get_llvm_module()->getFunction(printfName);
 		Vec<llvm::Value*> values;
-		values.push_back(ctx->irCtx->builder.CreateGlobalStringPtr(fmtRes.first, ctx->irCtx->get_global_string_name()));
+		values.push_back(
+		    ctx->irCtx->get_text_constant(fmtRes.first, ctx->irCtx->builder.GetInsertBlock()->getModule()));
 		for (auto* val : fmtRes.second) {
 			values.push_back(val);
 		}
@@ -18,7 +18,7 @@ class SayLike final : public Sentence {
 	    : Sentence(_fileRange), expressions(_expressions), sayType(_sayTy) {}
 
 	useit static SayLike* create(SayType _sayTy, Vec<Expression*> _expressions, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(SayLike), _sayTy, _expressions, _fileRange);
+		return std::construct_at(OwnAST(SayLike), _sayTy, _expressions, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> dep, ir::EntityState* ent, EmitCtx* ctx) final {
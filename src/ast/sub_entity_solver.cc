@@ -4,6 +4,7 @@
 #include "../IR/types/expanded_type.hpp"
 #include "../IR/types/integer.hpp"
 #include "../IR/types/maybe.hpp"
+#include "../IR/types/region.hpp"
 #include "../IR/types/result.hpp"
 #include "../IR/types/struct_type.hpp"
 #include "../IR/types/unsigned.hpp"
@@ -215,6 +216,37 @@ SubEntityResult sub_entity_solver(EmitCtx* ctx, bool isStrictlyPrerun, SubEntity
 						           name.range);
 					}
 				}
+			} else if (type->is_region()) {
+				if (not isLast()) {
+					ctx->Error("Found an expression before this. Expressions do not have children entities",
+					           rangeAfter());
+				}
+				auto* region = type->as_region();
+				if (not ir::Region::has_operation(name.value)) {
+					ctx->Error("Unsupported property " + ctx->color(name.value) + " for type " +
+					               ctx->color(type->to_string()),
+					           name.range);
+				}
+				if (isStrictlyPrerun) {
+					ctx->Error("Found the operation " + ctx->color(name.value) + " of the region " +
+					               ctx->color(region->get_full_name()) +
+					               " here. It cannot be used in prerun expressions",
+					           name.range);
+				}
+				auto isStat = ir::region_stat_from_string(name.value).has_value();
+				if (isStat && not region->has_stats()) {
+					ctx->Error("The statistics of the region " + ctx->color(region->get_full_name()) +
+					               " are only available when the " + ctx->color("--region-stats") +
+					               " flag is provided",
+					           name.range);
+				}
+				if (not isStat && (region->get_threading() == ir::RegionThreading::concurrent)) {
+					ctx->Error("The region " + ctx->color(region->get_full_name()) +
+					               " is concurrent, and other threads could be using the data that " +
+					               ctx->color(name.value) + " would destroy",
+					           name.range);
+				}
+				return SubEntityResult::get_expression(region->get_operation(name.value, ctx->mod, ctx->irCtx));
 			} else if (type->is_maybe()) {
 				if (name.value == "sub_type") {
 					if (isLast()) {
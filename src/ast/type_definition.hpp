@@ -34,7 +34,7 @@ class TypeDefinition : public IsEntity {
 	useit static TypeDefinition* create(Identifier _name, PrerunExpression* _checker,
 	                                    Vec<ast::GenericAbstractType*> _generics, PrerunExpression* _constraint,
 	                                    Type* _subType, FileRange _fileRange, Maybe<VisibilitySpec> _visibSpec) {
-		return std::construct_at(OwnNormal(TypeDefinition), _name, _checker, _generics, _constraint, _subType,
+		return std::construct_at(OwnAST(TypeDefinition), _name, _checker, _generics, _constraint, _subType,
 		                         _fileRange, _visibSpec);
 	}
 
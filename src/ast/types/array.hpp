@@ -24,7 +24,7 @@ class ArrayType final : public Type {
 	    : Type(_fileRange), elementType(_element_type), lengthExp(_length) {}
 
 	useit static ArrayType* create(Type* _element_type, PrerunExpression* _length, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(ArrayType), _element_type, _length, _fileRange);
+		return std::construct_at(OwnAST(ArrayType), _element_type, _length, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
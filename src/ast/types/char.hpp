@@ -11,7 +11,7 @@ class CharType final : public Type {
 	explicit CharType(FileRange _fileRange) : Type(std::move(_fileRange)) {}
 
 	useit static CharType* create(FileRange fileRange) {
-		return std::construct_at(OwnNormal(CharType), std::move(fileRange));
+		return std::construct_at(OwnAST(CharType), std::move(fileRange));
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
@@ -13,7 +13,7 @@ class FloatType final : public Type {
 	FloatType(ir::FloatTypeKind _kind, FileRange _fileRange) : Type(_fileRange), kind(_kind) {}
 
 	useit static FloatType* create(ir::FloatTypeKind _kind, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(FloatType), _kind, _fileRange);
+		return std::construct_at(OwnAST(FloatType), _kind, _fileRange);
 	}
 
 	useit static String kindToString(ir::FloatTypeKind kind);
@@ -16,7 +16,7 @@ class FunctionType final : public Type {
 	    : Type(_fileRange), returnType(_retType), argTypes(_argTypes), isVariadic(_isVariadic) {}
 
 	useit static FunctionType* create(Type* _retType, Vec<Type*> _argTypes, bool _isVariadic, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(FunctionType), _retType, _argTypes, _isVariadic, _fileRange);
+		return std::construct_at(OwnAST(FunctionType), _retType, _argTypes, _isVariadic, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
@@ -15,7 +15,7 @@ class FutureType final : public Type {
 	    : Type(_fileRange), subType(_subType), isPacked(_isPacked) {}
 
 	useit static FutureType* create(bool isPacked, ast::Type* subType, FileRange fileRange) {
-		return std::construct_at(OwnNormal(FutureType), isPacked, subType, fileRange);
+		return std::construct_at(OwnAST(FutureType), isPacked, subType, fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
@@ -17,12 +17,12 @@ class GenericIntegerType : public Type {
 	    : Type(_fileRange), bitValue(_bitValue), isUnsigned(_isUnsigned), isUnsignedExp(_isUnsignedExp) {}
 
 	useit static GenericIntegerType* create_specific(PrerunExpression* bitValue, bool isUnsigned, FileRange fileRange) {
-		return std::construct_at(OwnNormal(GenericIntegerType), bitValue, isUnsigned, nullptr, fileRange);
+		return std::construct_at(OwnAST(GenericIntegerType), bitValue, isUnsigned, nullptr, fileRange);
 	}
 
 	useit static GenericIntegerType* create(PrerunExpression* bitValue, PrerunExpression* isUnsigned,
 	                                        FileRange fileRange) {
-		return std::construct_at(OwnNormal(GenericIntegerType), bitValue, None, isUnsigned, fileRange);
+		return std::construct_at(OwnAST(GenericIntegerType), bitValue, None, isUnsigned, fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
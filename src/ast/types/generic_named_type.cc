@@ -1,4 +1,5 @@
 #include "./generic_named_type.hpp"
+#include "../../IR/prerun_cache.hpp"
 #include "../../IR/stdlib.hpp"
 #include "../../show.hpp"
 #include "../prerun/default.hpp"
@@ -166,6 +167,7 @@ Maybe<ir::Type*> handle_generic_named_type(ir::Mod* mod, ir::Block* curr, Identi
 
 ir::Type* GenericNamedType::emit(EmitCtx* ctx) {
 	SHOW("Generic named type START")
+	ir::PrerunCache::record_outside_read();
 	auto* mod     = ctx->mod;
 	auto  reqInfo = ctx->get_access_info();
 	if (relative != 0) {
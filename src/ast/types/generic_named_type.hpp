@@ -20,7 +20,7 @@ class GenericNamedType final : public Type {
 
 	useit static GenericNamedType* create(u32 _relative, Vec<Identifier> _names, Vec<FillGeneric*> _genericTypes,
 	                                      FileRange _fileRange) {
-		return std::construct_at(OwnNormal(GenericNamedType), _relative, _names, _genericTypes, _fileRange);
+		return std::construct_at(OwnAST(GenericNamedType), _relative, _names, _genericTypes, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
@@ -19,7 +19,7 @@ class IntegerType final : public Type {
 	IntegerType(u32 _bitWidth, FileRange _fileRange) : Type(_fileRange), bitWidth(_bitWidth) {}
 
 	useit static IntegerType* create(u32 _bitWidth, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(IntegerType), _bitWidth, _fileRange);
+		return std::construct_at(OwnAST(IntegerType), _bitWidth, _fileRange);
 	}
 
 	useit Maybe<usize> get_type_bitsize(EmitCtx* ctx) const final;
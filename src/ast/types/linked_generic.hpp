@@ -12,7 +12,7 @@ class LinkedGeneric final : public Type {
 	LinkedGeneric(ast::GenericAbstractType* _genAbs, FileRange _range) : Type(_range), genAbs(_genAbs) {}
 
 	useit static LinkedGeneric* create(ast::GenericAbstractType* _genAbs, FileRange _range) {
-		return std::construct_at(OwnNormal(LinkedGeneric), _genAbs, _range);
+		return std::construct_at(OwnAST(LinkedGeneric), _genAbs, _range);
 	}
 
 	useit ir::Type*   emit(EmitCtx* ctx) final;
@@ -14,7 +14,7 @@ class MaybeType final : public Type {
 	    : Type(_fileRange), subTyp(_subType), isPacked(_isPacked) {}
 
 	useit static MaybeType* create(bool _isPacked, Type* _subType, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(MaybeType), _isPacked, _subType, _fileRange);
+		return std::construct_at(OwnAST(MaybeType), _isPacked, _subType, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
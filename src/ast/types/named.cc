@@ -1,4 +1,5 @@
 #include "./named.hpp"
+#include "../../IR/prerun_cache.hpp"
 #include "../../IR/stdlib.hpp"
 #include "../../IR/types/choice.hpp"
 #include "../../IR/types/region.hpp"
@@ -62,6 +63,7 @@ void NamedType::update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> e
 }
 
 ir::Type* NamedType::emit(EmitCtx* ctx) {
+	ir::PrerunCache::record_outside_read();
 	auto* mod        = ctx->mod;
 	auto* currentMod = mod;
 	SHOW("Getting access info")
@@ -18,7 +18,7 @@ class NamedType final : public Type {
 	    : Type(_fileRange), relative(_relative), names(_names) {}
 
 	useit static NamedType* create(u32 _relative, Vec<Identifier> _names, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(NamedType), _relative, _names, _fileRange);
+		return std::construct_at(OwnAST(NamedType), _relative, _names, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
@@ -13,7 +13,7 @@ class NativeType final : public Type {
 	NativeType(ir::NativeTypeKind _cTypeKind, FileRange _fileRange) : Type(_fileRange), nativeKind(_cTypeKind) {}
 
 	useit static NativeType* create(ir::NativeTypeKind _cTypeKind, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(NativeType), _cTypeKind, _fileRange);
+		return std::construct_at(OwnAST(NativeType), _cTypeKind, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent, EmitCtx* ctx) {}
@@ -22,7 +22,7 @@ class PtrType final : public Type {
 
 	useit static PtrType* create(Type* _type, bool _isSubtypeVar, PtrOwnType _ownTy, bool _isNonNullable,
 	                             Maybe<Type*> _ownerTyTy, bool _isMulti, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(PtrType), _type, _isSubtypeVar, _ownTy, _isNonNullable, _ownerTyTy, _isMulti,
+		return std::construct_at(OwnAST(PtrType), _type, _isSubtypeVar, _ownTy, _isNonNullable, _ownerTyTy, _isMulti,
 		                         _fileRange);
 	}
 
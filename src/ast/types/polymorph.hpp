@@ -27,7 +27,7 @@ class PolymorphType final : public Type {
 
 	useit static PolymorphType* create(bool isTyped, Vec<SkillEntity> skills, PtrOwnType ownType,
 	                                   Maybe<FileRange> ownRange, FileRange range) {
-		return std::construct_at(OwnNormal(PolymorphType), isTyped, std::move(skills), ownType, std::move(ownRange),
+		return std::construct_at(OwnAST(PolymorphType), isTyped, std::move(skills), ownType, std::move(ownRange),
 		                         std::move(range));
 	}
 
@@ -23,7 +23,7 @@ class PrerunGenericAbstract final : public GenericAbstractType {
 
 	useit static PrerunGenericAbstract* get(usize _index, Identifier _name, Type* _expTy,
 	                                        Maybe<ast::PrerunExpression*> _defaultVal, FileRange _range) {
-		return std::construct_at(OwnNormal(PrerunGenericAbstract), _index, std::move(_name), _expTy, _defaultVal,
+		return std::construct_at(OwnAST(PrerunGenericAbstract), _index, std::move(_name), _expTy, _defaultVal,
 		                         std::move(_range));
 	}
 
@@ -15,7 +15,7 @@ class ReferenceType final : public Type {
 	    : Type(std::move(_fileRange)), type(_type), isSubtypeVar(_isSubtypeVar) {}
 
 	useit static ReferenceType* create(Type* type, bool isSubtypeVar, FileRange fileRange) {
-		return std::construct_at(OwnNormal(ReferenceType), type, isSubtypeVar, std::move(fileRange));
+		return std::construct_at(OwnAST(ReferenceType), type, isSubtypeVar, std::move(fileRange));
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
@@ -15,7 +15,7 @@ class ResultType final : public Type {
 
 	useit static ResultType* create(ast::Type* _validType, ast::Type* _errorType, bool _isPacked,
 	                                FileRange _fileRange) {
-		return std::construct_at(OwnNormal(ResultType), _validType, _errorType, _isPacked, _fileRange);
+		return std::construct_at(OwnAST(ResultType), _validType, _errorType, _isPacked, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
@@ -19,7 +19,7 @@ class SelfType final : public Type {
 	SelfType(bool _isJustType, FileRange _fileRange) : Type(_fileRange), isJustType(_isJustType) {}
 
 	useit static SelfType* create(bool _isJustType, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(SelfType), _isJustType, _fileRange);
+		return std::construct_at(OwnAST(SelfType), _isJustType, _fileRange);
 	}
 
 	useit ir::Type*   emit(EmitCtx* ctx);
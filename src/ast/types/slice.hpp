@@ -14,7 +14,7 @@ class SliceType final : public Type {
 	    : Type(std::move(_fileRange)), isVar(_isVar), subType(_subType) {}
 
 	useit static SliceType* create(bool isVar, Type* subType, FileRange fileRange) {
-		return std::construct_at(OwnNormal(SliceType), isVar, subType, std::move(fileRange));
+		return std::construct_at(OwnAST(SliceType), isVar, subType, std::move(fileRange));
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent, EmitCtx* ctx) {
@@ -26,7 +26,7 @@ class SubType final : public Type {
 
 	useit static SubType* create(Maybe<FileRange> skill, Maybe<FileRange> doneSkill, Vec<Identifier> names,
 	                             Type* parent, FileRange fileRange) {
-		return std::construct_at(OwnNormal(SubType), std::move(skill), std::move(doneSkill), std::move(names), parent,
+		return std::construct_at(OwnAST(SubType), std::move(skill), std::move(doneSkill), std::move(names), parent,
 		                         std::move(fileRange));
 	}
 
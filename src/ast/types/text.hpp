@@ -10,7 +10,7 @@ class TextType final : public Type {
   public:
 	explicit TextType(FileRange _fileRange) : Type(_fileRange) {}
 
-	useit static TextType* create(FileRange _fileRange) { return std::construct_at(OwnNormal(TextType), _fileRange); }
+	useit static TextType* create(FileRange _fileRange) { return std::construct_at(OwnAST(TextType), _fileRange); }
 
 	useit Maybe<usize> get_type_bitsize(EmitCtx* ctx) const final;
 	useit ir::Type*   emit(EmitCtx* ctx) final;
@@ -18,7 +18,7 @@ class TupleType final : public Type {
 	    : Type(_fileRange), types(_types), isPacked(_isPacked) {}
 
 	useit static TupleType* create(Vec<Type*> _types, bool _isPacked, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(TupleType), _types, _isPacked, _fileRange);
+		return std::construct_at(OwnAST(TupleType), _types, _isPacked, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
@@ -19,7 +19,7 @@ class TypedGenericAbstract final : public GenericAbstractType {
 
 	useit static TypedGenericAbstract* create(usize _index, Identifier _name, Maybe<ast::Type*> _defaultTy,
 	                                          FileRange _fileRange) {
-		return std::construct_at(OwnNormal(TypedGenericAbstract), _index, std::move(_name), _defaultTy,
+		return std::construct_at(OwnAST(TypedGenericAbstract), _index, std::move(_name), _defaultTy,
 		                         std::move(_fileRange));
 	}
 
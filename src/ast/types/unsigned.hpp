@@ -21,7 +21,7 @@ class UnsignedType final : public Type {
 	    : Type(_fileRange), bitWidth(_bitWidth), is_bool(_isBool) {}
 
 	useit static UnsignedType* create(u64 _bitWidth, bool _isBool, FileRange _fileRange) {
-		return std::construct_at(OwnNormal(UnsignedType), _bitWidth, _isBool, _fileRange);
+		return std::construct_at(OwnAST(UnsignedType), _bitWidth, _isBool, _fileRange);
 	}
 
 	useit Maybe<usize> get_type_bitsize(EmitCtx* ctx) const final;
@@ -17,7 +17,7 @@ class VectorType final : public Type {
 
 	useit static VectorType* create(Type* _subType, PrerunExpression* _count, Maybe<FileRange> _scalable,
 	                                FileRange _fileRange) {
-		return std::construct_at(OwnNormal(VectorType), _subType, _count, _scalable, _fileRange);
+		return std::construct_at(OwnAST(VectorType), _subType, _count, _scalable, _fileRange);
 	}
 
 	void update_dependencies(ir::EmitPhase phase, Maybe<ir::DependType> expect, ir::EntityState* ent,
@@ -7,6 +7,8 @@
 #include "./error.hpp"
 #include "./version.hpp"
 
+#include <algorithm>
+#include <charconv>
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
@@ -377,6 +379,11 @@ Config::Config(u64 count, const char** args)
 			if (count == 2) {
 				paths.push_back(fs::current_path());
 			}
+		} else if (command == "check") {
+			checkWorkflow = true;
+			if (count == 2) {
+				paths.push_back(fs::current_path());
+			}
 		} else if (command == "run") {
 			buildWorkflow = true;
 			runWorkflow   = true;
@@ -564,6 +571,38 @@ Config::Config(u64 count, const char** args)
 				exportAST = true;
 			} else if (arg == "--stats") {
 				diagnostic = true;
+			} else if (arg == "--prerun-profile") {
+				prerunProfile = true;
+			} else if (arg == "--no-prerun-cache") {
+				noPrerunCache = true;
+			} else if (arg == "--prerun-jit") {
+				prerunJit = true;
+			} else if (arg == "--prerun-jit=verify") {
+				prerunJit       = true;
+				verifyPrerunJit = true;
+			} else if (arg == "--region-stats") {
+				regionStats = true;
+			} else if (arg == "--region-stats=json") {
+				regionStats     = true;
+				regionStatsJson = true;
+			} else if (arg.starts_with("--heap-allocator=")) {
+				auto allocatorVal = filter_quotes(arg.substr(String::traits_type::length("--heap-allocator=")));
+				if ((allocatorVal != "pool") && (allocatorVal != "system")) {
+					log->fatalError("Invalid value for the argument " + log->color("--heap-allocator") + ". Expected " +
+					                    log->color("pool") + " or " + log->color("system"),
+					                None);
+				}
+				poolAllocator = (allocatorVal == "pool");
+			} else if (arg.starts_with("--prerun-step-limit=")) {
+				auto limitVal    = filter_quotes(arg.substr(String::traits_type::length("--prerun-step-limit=")));
+				auto limitResult = std::from_chars(limitVal.data(), limitVal.data() + limitVal.size(), prerunStepLimit);
+				if (limitVal.empty() || (limitResult.ec != std::errc()) ||
+				    (limitResult.ptr != limitVal.data() + limitVal.size())) {
+					log->fatalError("Invalid value for the argument " + log->color("--prerun-step-limit") +
+					                    ". Expected the maximum number of steps as an unsigned integer, or " +
+					                    log->color("0") + " to remove the limit",
+					                None);
+				}
 			} else if (arg == "--export-code-info") {
 				exportCodeInfo = true;
 			} else if (arg == "-o" || arg == "--output") {
@@ -682,7 +721,8 @@ Config::Config(u64 count, const char** args)
 			    None);
 		}
 		if ((not outputPath.has_value()) && (not exitAfter)) {
-			if ((is_workflow_build() || is_workflow_bundle() || is_workflow_analyse() || is_workflow_run()) &&
+			if ((is_workflow_build() || is_workflow_bundle() || is_workflow_analyse() || is_workflow_check() ||
+			     is_workflow_run()) &&
 			    (paths.size() == 1)) {
 				if ((fs::is_regular_file(paths[0]) && (paths[0].extension() == ".qat")) || fs::is_directory(paths[0])) {
 					auto candParent =
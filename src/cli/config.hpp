@@ -44,11 +44,21 @@ class Config {
 	bool runWorkflow     = false;
 	bool bundleWorkflow  = false;
 	bool analyseWorkflow = false;
+	bool checkWorkflow   = false;
 	bool clearLLVMFiles  = false;
 	bool exportCodeInfo  = false;
 	bool isFreestanding  = false;
 	bool isNoStd         = false;
 	bool diagnostic      = false;
+	bool prerunProfile   = false;
+	bool noPrerunCache   = false;
+	bool prerunJit       = false;
+	bool verifyPrerunJit = false;
+	bool regionStats     = false;
+	bool regionStatsJson = false;
+	bool poolAllocator   = false;
+
+	u64 prerunStepLimit = 100000000u;
 
 	ColorMode colorMode = ColorMode::color256;
 	BuildMode buildMode = BuildMode::debug;
@@ -78,6 +88,7 @@ class Config {
 	useit bool is_workflow_run() const { return runWorkflow; }
 	useit bool is_workflow_analyse() const { return analyseWorkflow; }
 	useit bool is_workflow_bundle() const { return bundleWorkflow; }
+	useit bool is_workflow_check() const { return checkWorkflow; }
 
 	useit bool should_show_report() const { return showReport; }
 	useit bool is_verbose() const { return verbose; }
@@ -112,6 +123,14 @@ class Config {
 	useit bool should_build_shared() const { return buildShared.value_or(false); }
 	useit bool should_exit() const { return exitAfter; }
 	useit bool should_do_diagnostics() const { return diagnostic; }
+	useit bool should_profile_prerun() const { return prerunProfile; }
+	useit u64  get_prerun_step_limit() const { return prerunStepLimit; }
+	useit bool is_prerun_cache_disabled() const { return noPrerunCache; }
+	useit bool should_jit_prerun() const { return prerunJit; }
+	useit bool should_verify_prerun_jit() const { return verifyPrerunJit; }
+	useit bool has_region_stats() const { return regionStats; }
+	useit bool has_region_stats_as_json() const { return regionStatsJson; }
+	useit bool has_pool_allocator() const { return poolAllocator; }
 
 	useit String get_target_triple() const { return targetTriple.value_or(LLVM_HOST_TRIPLE); }
 	useit String get_sysroot() const { return sysRoot.value(); }
@@ -19,7 +19,7 @@ using ErrorLocation = std::variant<FileRange, fs::path>;
 
 useit inline fs::path getPathFromErrorLocation(ErrorLocation& loc) {
 	if (loc.index() == 0) {
-		return std::get<FileRange>(loc).file;
+		return std::get<FileRange>(loc).get_path();
 	} else {
 		return std::get<fs::path>(loc);
 	}
@@ -83,7 +83,7 @@ FileRange Lexer::get_position(u64 length) {
 			end = {lineNumber - 1, previousLineEnd.value()};
 		}
 	}
-	return {fs::path(filePath), {end.line, end.character - length}, end};
+	return {fileID, {end.line, end.byteOffset - length}, end};
 }
 
 void Lexer::analyse() {
@@ -107,6 +107,7 @@ void Lexer::analyse() {
 void Lexer::change_file(fs::path newFilePath) {
 	tokens          = new Vec<Token>();
 	filePath        = std::move(newFilePath);
+	fileID          = SourceFiles::get_id(filePath);
 	prev            = -1;
 	current         = -1;
 	lineNumber      = 1;
@@ -733,7 +734,7 @@ Maybe<Token> Lexer::word_to_token(const String& wordValue, Lexer* lexInst) {
 
 void Lexer::throw_error(const String& message, Maybe<usize> offset) {
 	irCtx->Error(message, offset.has_value() ? get_position(offset.value())
-	                                         : FileRange{filePath, FilePos{lineNumber, characterNumber},
+	                                         : FileRange{fileID, FilePos{lineNumber, characterNumber},
 	                                                     FilePos{lineNumber, characterNumber + 1}});
 }
 
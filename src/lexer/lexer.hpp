@@ -15,6 +15,7 @@ namespace qat::lexer {
 class Lexer {
   private:
 	fs::path      filePath;
+	u32           fileID = 0;
 	std::ifstream file;
 	char          prev;
 	char          current;
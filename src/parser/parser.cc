@@ -458,10 +458,10 @@ ast::BringPaths* Parser::parse_bring_paths(bool isMember, usize from, usize upto
 					names.push_back(None);
 					i++;
 				}
-				SHOW("Pushing brought path: " << token.fileRange.file.parent_path() / token.value)
-				broughtPaths.push_back(token.fileRange.file.parent_path() / token.value);
+				SHOW("Pushing brought path: " << token.fileRange.get_path().parent_path() / token.value)
+				broughtPaths.push_back(token.fileRange.get_path().parent_path() / token.value);
 				if (isMember) {
-					memberPaths.push_back(token.fileRange.file.parent_path() / token.value);
+					memberPaths.push_back(token.fileRange.get_path().parent_path() / token.value);
 				}
 				paths.push_back(ast::StringLiteral::create(token.value, token.fileRange));
 				break;
@@ -795,7 +795,7 @@ Pair<ast::PrerunExpression*, usize> Parser::do_prerun_expression(ParserContext&
 					Maybe<Identifier> suffix;
 					if (not utils::is_integer(bitStr) && (lastUnderscorePos + 1 < token.value.length())) {
 						suffix = {token.value.substr(lastUnderscorePos + 1),
-						          FileRange(token.fileRange.file,
+						          FileRange(token.fileRange.fileID,
 						                    FilePos{token.fileRange.start.line,
 						                            token.fileRange.start.character + lastUnderscorePos + 1},
 						                    token.fileRange.end)};
@@ -830,7 +830,7 @@ Pair<ast::PrerunExpression*, usize> Parser::do_prerun_expression(ParserContext&
 						              token.value.substr(0, lastUnderscorePos),
 						              bits.has_value()
 						                  ? Maybe<Pair<u64, FileRange>>(
-						                        {bits.value(), FileRange(token.fileRange.file,
+						                        {bits.value(), FileRange(token.fileRange.fileID,
 						                                                 FilePos{token.fileRange.start.line,
 						                                                         token.fileRange.start.character +
 						                                                             lastUnderscorePos + 1},
@@ -841,7 +841,7 @@ Pair<ast::PrerunExpression*, usize> Parser::do_prerun_expression(ParserContext&
 						              token.value.substr(0, lastUnderscorePos),
 						              bits.has_value()
 						                  ? Maybe<Pair<u64, FileRange>>(
-						                        {bits.value(), FileRange(token.fileRange.file,
+						                        {bits.value(), FileRange(token.fileRange.fileID,
 						                                                 FilePos{token.fileRange.start.line,
 						                                                         token.fileRange.start.character +
 						                                                             lastUnderscorePos + 1},
@@ -2593,34 +2593,62 @@ Vec<ast::Node*> Parser::parse(ParserContext preCtx, // NOLINT(misc-no-recursion)
 				}
 				auto                   name      = IdentifierAt(i + 1);
 				ast::PrerunExpression* blockSize = nullptr;
+				ast::PrerunExpression* growth    = nullptr;
+				ast::PrerunExpression* threading = nullptr;
+				ast::PrerunExpression* mapping   = nullptr;
 				i++;
 				if (is_next(TokenType::curlybraceOpen, i)) {
-					i++;
-					if (is_next(TokenType::identifier, i)) {
-						auto preCtx = ParserContext();
-						if (tokens->at(i + 1).value != "blockSize") {
-							add_error("Only supported attribute for region is " + color_error("blockSize"),
-							          RangeAt(i + 1));
-						}
-						i++;
-						if (not is_next(TokenType::associatedAssignment, i)) {
-							add_error("Expected := after this", RangeAt(i));
-						}
-						i++;
-						auto expRes = do_prerun_expression(preCtx, i, None);
-						i           = expRes.second;
-						blockSize   = expRes.first;
-					}
-					if (not is_next(TokenType::curlybraceClose, i)) {
-						add_error("Expected } to end the body of this region declaration", RangeSpan(start, i));
-					}
-					i++;
+					auto bClose = get_pair_end(TokenType::curlybraceOpen, TokenType::curlybraceClose, i + 1);
+					if (not bClose.has_value()) {
+						add_error("Expected } to end the body of this region declaration", RangeSpan(start, i + 1));
+					}
+					for (usize j = i + 2; j < bClose.value(); j++) {
+						if (tokens->at(j).type != TokenType::identifier) {
+							add_error("Expected the name of an attribute of the region", RangeAt(j));
+						}
+						auto                    attrName  = ValueAt(j);
+						ast::PrerunExpression** attrValue = nullptr;
+						if (attrName == "blockSize") {
+							attrValue = &blockSize;
+						} else if (attrName == "growth") {
+							attrValue = &growth;
+						} else if (attrName == "threading") {
+							attrValue = &threading;
+						} else if (attrName == "mapping") {
+							attrValue = &mapping;
+						} else {
+							add_error("Only supported attributes for region are " + color_error("blockSize") + ", " +
+							              color_error("growth") + ", " + color_error("threading") + " and " +
+							              color_error("mapping"),
+							          RangeAt(j));
+						}
+						if (*attrValue != nullptr) {
+							add_error("The attribute " + color_error(attrName) + " is already provided for this region",
+							          RangeAt(j));
+						}
+						if (not is_next(TokenType::associatedAssignment, j)) {
+							add_error("Expected := after this", RangeAt(j));
+						}
+						auto preCtx  = ParserContext();
+						auto sepPos  = first_primary_position(TokenType::separator, j + 1);
+						auto attrEnd = (sepPos.has_value() && (sepPos.value() < bClose.value())) ? sepPos.value()
+						                                                                          : bClose.value();
+						auto expRes  = do_prerun_expression(preCtx, j + 1, attrEnd);
+						if (expRes.second + 1 != attrEnd) {
+							add_error("Expression does not span until " + String((attrEnd == bClose.value()) ? "}" : ","),
+							          RangeSpan(expRes.second, attrEnd));
+						}
+						*attrValue = expRes.first;
+						j          = attrEnd;
+					}
+					i = bClose.value();
 				} else if (not is_next(TokenType::stop, i + 1)) {
 					add_error("Expected either {} or . to end the region declaration after this", RangeSpan(i, i + 1));
 				} else {
 					i++;
 				}
-				addNode(ast::DefineRegion::create(std::move(name), blockSize, get_visibility(), RangeSpan(start, i)));
+				addNode(ast::DefineRegion::create(std::move(name), blockSize, growth, threading, mapping,
+				                                  get_visibility(), RangeSpan(start, i)));
 				break;
 			}
 			case TokenType::define: {
@@ -6541,9 +6569,9 @@ String Parser::color_error(const String& message) {
 void Parser::add_warning(const String& message, const FileRange& fileRange) {
 	std::cout << cli::get_bg_color(cli::Color::orange) << " PARSER WARNING " << cli::get_color(cli::Color::reset)
 	          << "▌ " << cli::get_color(cli::Color::yellow) << message << cli::get_color(cli::Color::reset) << " | "
-	          << cli::get_color(cli::Color::green) << fileRange.file.string() << ":" << fileRange.start.line << ":"
+	          << cli::get_color(cli::Color::green) << fileRange.get_path().string() << ":" << fileRange.start.line << ":"
 	          << fileRange.start.character << cli::get_color(cli::Color::reset) << " >> "
-	          << cli::get_color(cli::Color::green) << fileRange.file.string() << ":" << fileRange.end.line << ":"
+	          << cli::get_color(cli::Color::green) << fileRange.get_path().string() << ":" << fileRange.end.line << ":"
 	          << fileRange.end.character << cli::get_color(cli::Color::reset) << "\n";
 }
 
@@ -10,7 +10,8 @@ int main(int count, const char** args) {
 		delete cli;
 		return 0;
 	}
-	if (cli->is_workflow_analyse() || cli->is_workflow_build() || cli->is_workflow_bundle() || cli->is_workflow_run()) {
+	if (cli->is_workflow_analyse() || cli->is_workflow_check() || cli->is_workflow_build() || cli->is_workflow_bundle() ||
+	    cli->is_workflow_run()) {
 		cli->find_stdlib_and_toolchain();
 	}
 	auto* sitter = QatSitter::get();
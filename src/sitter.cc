@@ -1,4 +1,6 @@
 #include "./sitter.hpp"
+#include "./IR/prerun_cache.hpp"
+#include "./IR/prerun_jit.hpp"
 #include "./IR/stdlib.hpp"
 #include "./IR/type_id.hpp"
 #include "./show.hpp"
@@ -87,6 +89,45 @@ void QatSitter::display_stats() {
 		log->diagnostic("Compile time  -> " + timeToString(ctx->qatCompileTimeInMs.value()));
 		log->diagnostic("clang & lld   -> " + timeToString(ctx->clangAndLinkTimeInMs.value()));
 	}
+	log->diagnostic("Link names    -> " + std::to_string(LinkNames::builtCount) + " mangled, " +
+	                std::to_string(LinkNames::reusedCount) + " reused");
+	log->diagnostic("Type infos    -> " + std::to_string(ir::TypeInfo::emittedCount) + " entries in " +
+	                std::to_string(ir::TypeInfo::tableSize) + " bytes, " + std::to_string(ir::TypeInfo::strippedCount) +
+	                " stripped");
+	log->diagnostic("Text data     -> " + std::to_string(ctx->get_text_constant_count()) + " constants, " +
+	                std::to_string(ctx->get_merged_text_count()) + " duplicates merged");
+	log->diagnostic("Prerun cache  -> " + std::to_string(ir::PrerunCache::get_loaded_count()) +
+	                " results reused, " + std::to_string(ir::PrerunCache::get_stored_count()) + " stored");
+	if (ir::PrerunJit::is_enabled()) {
+		log->diagnostic("Prerun JIT    -> " + std::to_string(ir::PrerunJit::get_compiled_count()) +
+		                " functions compiled, " + std::to_string(ir::PrerunJit::get_native_call_count()) +
+		                " native calls");
+	}
+	auto runtimeGlobals = ir::Mod::get_runtime_globals();
+	log->diagnostic("Globals       -> " + std::to_string(ir::Mod::get_folded_global_count()) +
+	                " folded at compile time, " + std::to_string(runtimeGlobals.size()) +
+	                " initialised when the program starts");
+	for (auto& runtimeGlobal : runtimeGlobals) {
+		log->diagnostic("  " + runtimeGlobal.first + " at " + runtimeGlobal.second.start_to_string());
+	}
+	auto sizeToString = [](usize size) {
+		if (size > 1048576) {
+			return std::to_string(((double)size) / 1048576) + " MiB";
+		} else if (size > 1024) {
+			return std::to_string(((double)size) / 1024) + " KiB";
+		} else {
+			return std::to_string(size) + " B";
+		}
+	};
+	for (usize i = 0; i < ARENA_KIND_COUNT; i++) {
+		auto kindName = arena_kind_to_string((ArenaKind)i);
+		auto stats    = QatRegion::get_stats((ArenaKind)i);
+		log->diagnostic("Arena " + kindName + String(8 - kindName.length(), ' ') + "-> " +
+		                sizeToString(stats.requestedBytes) + " used, " + sizeToString(stats.reservedBytes) +
+		                " reserved in " + std::to_string(stats.blockCount) + " blocks (" +
+		                std::to_string(stats.largeAllocations) + " large), " + sizeToString(stats.paddingBytes) +
+		                " alignment padding");
+	}
 }
 
 void QatSitter::initialise() {
@@ -109,7 +150,7 @@ void QatSitter::initialise() {
 		}
 	}
 	SHOW("Module count: " << ir::Mod::allModules.size())
-	if (config->is_workflow_build() || config->is_workflow_analyse()) {
+	if (config->is_workflow_build() || config->is_workflow_analyse() || config->is_workflow_check()) {
 		auto qatStartTime = std::chrono::high_resolution_clock::now();
 		SHOW("Module count: " << ir::Mod::allModules.size())
 		for (auto* entity : fileEntities) {
@@ -210,9 +251,16 @@ void QatSitter::initialise() {
 			}
 			ctx->Errors(errors);
 		}
-		ir::TypeInfo::finalise_type_infos(ctx);
-		for (auto* entity : fileEntities) {
-			entity->setup_llvm_file(ctx);
+		// Type information tables and the LLVM files are only useful for the later stages of compilation
+		if (not config->is_workflow_check()) {
+			ir::TypeInfo::finalise_type_infos(ctx);
+			// All initialisers are folded before any file is written, as folding removes the calls to the initialisers
+			for (auto* entity : fileEntities) {
+				entity->finalise_initialiser(ctx);
+			}
+			for (auto* entity : fileEntities) {
+				entity->setup_llvm_file(ctx);
+			}
 		}
 		auto qatCompileTime = std::chrono::duration_cast<std::chrono::microseconds>(
 		                          std::chrono::high_resolution_clock::now() - qatStartTime)
@@ -568,6 +616,9 @@ void QatSitter::destroy() {
 	SHOW("ir::Value complete")
 	ir::Type::clear_all();
 	SHOW("ir::Type complete")
+	QatRegion::destroy(ArenaKind::prerun);
+	QatRegion::destroy(ArenaKind::ast);
+	SHOW("Released prerun and AST arenas")
 }
 
 QatSitter::~QatSitter() { destroy(); }
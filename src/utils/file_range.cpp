@@ -4,6 +4,27 @@
 
 namespace qat {
 
+std::mutex                      SourceFiles::mutex;
+std::deque<fs::path>            SourceFiles::paths;
+std::unordered_map<String, u32> SourceFiles::ids;
+
+u32 SourceFiles::get_id(fs::path const& path) {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto                        idRes = ids.find(path.string());
+	if (idRes != ids.end()) {
+		return idRes->second;
+	}
+	auto newID = (u32)paths.size();
+	paths.push_back(path);
+	ids.insert({path.string(), newID});
+	return newID;
+}
+
+fs::path const& SourceFiles::get_path(u32 id) {
+	std::lock_guard<std::mutex> lock(mutex);
+	return paths.at(id);
+}
+
 FilePos::FilePos(u64 _line, u64 _byte) : line(_line), byteOffset(_byte) {}
 
 FilePos::operator JsonValue() const { return (Json)(*this); }
@@ -12,36 +33,43 @@ FilePos::operator Json() const { return Json()._("line", line)._("byteOffset", b
 
 std::ostream& operator<<(std::ostream& os, FilePos const& pos) { return os << pos.line << ":" << pos.byteOffset; }
 
-FileRange::FileRange(fs::path _filePath) : file(std::move(_filePath)), start({0u, 0u}), end({0u, 0u}) {}
+FileRange::FileRange(fs::path _filePath) : fileID(SourceFiles::get_id(_filePath)), start({0u, 0u}), end({0u, 0u}) {}
+
+FileRange::FileRange(fs::path _file, FilePos _start, FilePos _end)
+    : fileID(SourceFiles::get_id(_file)), start(_start), end(_end) {}
 
-FileRange::FileRange(fs::path _file, FilePos _start, FilePos _end) : file(std::move(_file)), start(_start), end(_end) {}
+FileRange::FileRange(u32 _fileID, FilePos _start, FilePos _end) : fileID(_fileID), start(_start), end(_end) {}
 
 FileRange::FileRange(const FileRange& first, const FileRange& second)
-    : file(first.file), start(first.start), end((first.file == second.file) ? second.end : first.end) {}
+    : fileID(first.fileID), start(first.start), end((first.fileID == second.fileID) ? second.end : first.end) {}
 
 FileRange::FileRange(Json json)
-    : file(json["file"].asString()), start(json["start"].asJson()), end(json["end"].asJson()) {}
+    : fileID(SourceFiles::get_id(json["file"].asString())), start(json["start"].asJson()), end(json["end"].asJson()) {}
 
 FileRange FileRange::spanTo(FileRange const& other) const { return FileRange{*this, other}; }
 
-FileRange FileRange::trimTo(FilePos othStart) const { return FileRange(file, start, othStart); }
+FileRange FileRange::trimTo(FilePos othStart) const {
+	auto result = *this;
+	result.end  = othStart;
+	return result;
+}
 
 String FileRange::start_to_string() const {
-	return file.string() + ":" + std::to_string(start.line) + ":" + std::to_string(start.byteOffset);
+	return get_path().string() + ":" + std::to_string(start.line) + ":" + std::to_string(start.byteOffset);
 }
 
 bool FileRange::is_before(FileRange another) const {
-	return std::filesystem::equivalent(file, another.file) &&
+	return ((fileID == another.fileID) || std::filesystem::equivalent(get_path(), another.get_path())) &&
 	       ((end.line < another.start.line) ||
 	        ((end.line == another.start.line) && (end.byteOffset < another.start.byteOffset)));
 }
 
-FileRange::operator Json() const { return Json()._("path", file.string())._("start", start)._("end", end); }
+FileRange::operator Json() const { return Json()._("path", get_path().string())._("start", start)._("end", end); }
 
 FileRange::operator JsonValue() const { return (Json)(*this); }
 
 std::ostream& operator<<(std::ostream& os, FileRange const& range) {
-	return os << range.file.string() << ":" << range.start << " - " << range.end;
+	return os << range.get_path().string() << ":" << range.start << " - " << range.end;
 }
 
 } // namespace qat
@@ -3,17 +3,32 @@
 
 #include "./json.hpp"
 #include <cstdint>
+#include <deque>
 #include <filesystem>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
 
 namespace qat {
 
+/** Table of all source files known to the compiler. FileRange refers to files using the ID assigned here */
+class SourceFiles {
+	static std::mutex                      mutex;
+	static std::deque<fs::path>            paths;
+	static std::unordered_map<String, u32> ids;
+
+  public:
+	useit static u32             get_id(fs::path const& path);
+	useit static fs::path const& get_path(u32 id);
+};
+
 struct FilePos {
 	FilePos(Json);
 
 	FilePos(u64 line, u64 byteOffset);
 
-	u64 line;
-	u64 byteOffset;
+	u32 line;
+	u32 byteOffset;
 
 	operator JsonValue() const;
 
@@ -36,6 +51,8 @@ class FileRange {
 	 */
 	FileRange(fs::path _file, FilePos _start, FilePos _end);
 
+	FileRange(u32 _fileID, FilePos _start, FilePos _end);
+
 	FileRange(Json json);
 
 	/**
@@ -54,8 +71,8 @@ class FileRange {
 	 */
 	FileRange(const FileRange& first, const FileRange& second);
 
-	/** Path to the corresponding file */
-	fs::path file;
+	/** ID of the corresponding file in SourceFiles */
+	u32 fileID;
 
 	/** Starting position of the range */
 	FilePos start;
@@ -63,6 +80,9 @@ class FileRange {
 	/** Ending position of the range */
 	FilePos end;
 
+	useit fs::path const& get_path() const { return SourceFiles::get_path(fileID); }
+	useit bool            is_same_file(FileRange const& other) const { return fileID == other.fileID; }
+
 	useit FileRange spanTo(FileRange const& other) const;
 	useit FileRange trimTo(FilePos othStart) const;
 	useit String    start_to_string() const;
@@ -73,6 +93,8 @@ class FileRange {
 	operator JsonValue() const;
 };
 
+static_assert(std::is_trivially_copyable_v<FileRange>);
+
 std::ostream& operator<<(std::ostream& os, FileRange const& range);
 
 } // namespace qat
@@ -1,6 +1,8 @@
 #include "./json_parser.hpp"
 #include "./json.hpp"
 #include "helpers.hpp"
+#include <charconv>
+#include <cstdlib>
 #include <optional>
 #include <vector>
 
@@ -29,7 +31,7 @@ bool JsonParser::lex(String val) {
 			String str;
 			bool   isEscape = false;
 			usize  j        = i + 1; // NOLINT(readability-identifier-length)
-			for (; (isEscape ? true : val.at(j) != '"') && (j < val.size()); j++) {
+			for (; (j < val.size()) && (isEscape || (val.at(j) != '"')); j++) {
 				if (isEscape) {
 					if (val.at(j) == '"') {
 						str += '"';
@@ -55,16 +57,19 @@ bool JsonParser::lex(String val) {
 					}
 				}
 			}
+			if (j >= val.size()) {
+				return false;
+			}
 			i = j;
-			toks.emplace_back(Token(TokenType::string));
+			toks.emplace_back(Token(TokenType::string, str));
 		} else if ((digits.find(val.at(i)) != String::npos) || (val.at(i) == '-')) {
 			bool   is_float = false;
 			String num(val.substr(i, 1));
 			String decimal;
 			usize  jInd = i + 1;
-			for (; ((is_float ? (digits.find(val.at(jInd)) != String::npos)
-			                  : ((digits.find(val.at(jInd)) != String::npos) || (val.at(jInd) == '.'))) &&
-			        (jInd < val.size()));
+			for (; ((jInd < val.size()) &&
+			        (is_float ? (digits.find(val.at(jInd)) != String::npos)
+			                  : ((digits.find(val.at(jInd)) != String::npos) || (val.at(jInd) == '.'))));
 			     jInd++) {
 				if (is_float) {
 					decimal += val.at(jInd);
@@ -96,7 +101,7 @@ bool JsonParser::lex(String val) {
 		} else if (alpha.find(val.at(i)) != String::npos) {
 			String idt(val.substr(i, 1));
 			usize  j = i + 1; // NOLINT(readability-identifier-length)
-			for (; ((alpha.find(val.at(j)) != String::npos) && (j < val.size())); j++) {
+			for (; ((j < val.size()) && (alpha.find(val.at(j)) != String::npos)); j++) {
 				idt += val.at(j);
 			}
 			if (idt == "true") {
@@ -117,7 +122,7 @@ bool JsonParser::lex(String val) {
 }
 
 bool JsonParser::isNext(TokenType type, usize pos = 0) const {
-	return (pos < toks.size()) ? (toks.at(pos + 1).type == type) : false;
+	return ((pos + 1) < toks.size()) ? (toks.at(pos + 1).type == type) : false;
 }
 
 std::optional<usize> JsonParser::getPairEnd(bool isList, usize from, std::optional<usize> upto) const {
@@ -224,10 +229,16 @@ Maybe<JsonValue> JsonParser::parseValue(usize from, usize upto) const {
 				return JsonValue(tok.value);
 			}
 			case TokenType::integer: {
-				return JsonValue(std::stoi(tok.value));
+				// Numbers that do not fit are rejected instead of throwing, as the input can be any file on disk
+				i64  number = 0;
+				auto end    = tok.value.data() + tok.value.size();
+				if (std::from_chars(tok.value.data(), end, number).ptr != end) {
+					return None;
+				}
+				return JsonValue(number);
 			}
 			case TokenType::floating: {
-				return JsonValue(std::stod(tok.value));
+				return JsonValue(std::strtod(tok.value.c_str(), nullptr));
 			}
 			case TokenType::curlyBraceClose:
 			case TokenType::comma:
@@ -252,7 +263,7 @@ Maybe<JsonValue> JsonParser::parseValue(usize from, usize upto) const {
 									vals.push_back(firstVal.value());
 									for (usize j = 0; j < (sepPos->size() - 1); j++) {
 										auto midVal = parseValue(sepPos->at(j), sepPos->at(j + 1));
-										if (midVal.value()) {
+										if (midVal) {
 											vals.push_back(midVal.value());
 										} else {
 											return None;
@@ -298,7 +309,7 @@ Maybe<Vec<Pair<String, JsonValue>>> JsonParser::parsePairs(usize from, usize upt
 	for (usize i = from + 1; i < upto; i++) {
 		auto tok = toks.at(i);
 		if (tok.type == TokenType::string) {
-			if (isNext(TokenType::colon, i)) {
+			if (isNext(TokenType::colon, i) && ((i + 2) < upto)) {
 				switch (toks.at(i + 2).type) {
 					case TokenType::True:
 					case TokenType::False: {
@@ -1,83 +1,122 @@
 #include "./qat_region.hpp"
 #include "helpers.hpp"
 
+#include <cstdlib>
+
 namespace qat {
 
-thread_local void* QatRegion::blockTail = nullptr;
+String arena_kind_to_string(ArenaKind kind) {
+	switch (kind) {
+		case ArenaKind::ast:
+			return "ast";
+		case ArenaKind::ir:
+			return "ir";
+		case ArenaKind::prerun:
+			return "prerun";
+		case ArenaKind::generics:
+			return "generics";
+	}
+}
+
+thread_local QatRegion::Cursor QatRegion::cursors[ARENA_KIND_COUNT] = {};
 
-std::mutex QatRegion::regionMutex = std::mutex();
-Vec<void*> QatRegion::allBlockTails{};
-usize      QatRegion::totalSize = 0;
+QatRegion::Arena QatRegion::arenas[ARENA_KIND_COUNT] = {};
 
-void QatRegion::destroyAllBlocks() {
-	while (not regionMutex.try_lock()) {
+static inline u8* align_pointer(u8* ptr, usize alignment) {
+	return (u8*)((((uintptr_t)ptr) + (alignment - 1)) & ~(uintptr_t)(alignment - 1));
+}
+
+QatRegion::Block* QatRegion::new_block(Arena& arena, usize minimumSize, bool isLarge) {
+	std::lock_guard<std::mutex> lock(arena.mutex);
+	auto  blockSize = isLarge ? (sizeof(Block) + minimumSize) : minimumSize;
+	auto* block     = (Block*)std::malloc(blockSize);
+	if (block == nullptr) {
+		exit(1);
+	}
+	block->next  = arena.blocks;
+	block->size  = blockSize;
+	arena.blocks = block;
+	arena.reservedBytes.fetch_add(blockSize, std::memory_order_relaxed);
+	arena.blockCount.fetch_add(1, std::memory_order_relaxed);
+	if (isLarge) {
+		arena.largeAllocations.fetch_add(1, std::memory_order_relaxed);
 	}
-	for (auto currBlockTail : allBlockTails) {
-		auto candidatePtr = currBlockTail;
-		while (candidatePtr != nullptr) {
-			auto nextBlockPtr = *(void**)candidatePtr;
-			free(candidatePtr);
-			candidatePtr = nextBlockPtr;
-		}
+	return block;
+}
+
+void QatRegion::free_block_chain(Block* block) {
+	while (block != nullptr) {
+		auto* next = block->next;
+		std::free(block);
+		block = next;
 	}
-	allBlockTails.clear();
-	regionMutex.unlock();
 }
 
-void* QatRegion::getMemory(usize typeSize) {
-	static constexpr auto defaultBlockSize = 65536;
-	static constexpr auto usizeSize        = sizeof(usize);
-	static constexpr auto u8PtrSize        = sizeof(u8*);
-	totalSize += typeSize;
-	void** nextBlockPtr   = nullptr;
-	usize* blockSizePtr   = nullptr;
-	usize* blockOffsetPtr = nullptr;
-	auto   unitSize       = typeSize;
-	if (blockTail == nullptr) {
-		auto blockSize =
-		    (unitSize < (defaultBlockSize - (2 * usizeSize) - u8PtrSize)) ? defaultBlockSize : (2 * unitSize);
-		blockTail = malloc(blockSize);
-		if (blockTail == nullptr) {
-			exit(1);
-		} else {
-			// Updating blockTails for each new thread requesting for memory
-			while (not regionMutex.try_lock()) {
-			}
-			allBlockTails.push_back(blockTail);
-			regionMutex.unlock();
-			//
-			nextBlockPtr    = (void**)blockTail;
-			blockSizePtr    = (usize*)(nextBlockPtr + 1);
-			blockOffsetPtr  = blockSizePtr + 1;
-			*nextBlockPtr   = nullptr;
-			*blockSizePtr   = blockSize;
-			*blockOffsetPtr = (2 * usizeSize) + u8PtrSize;
-		}
-	} else {
-		nextBlockPtr   = (void**)blockTail;
-		blockSizePtr   = (usize*)(nextBlockPtr + 1);
-		blockOffsetPtr = blockSizePtr + 1;
+void* QatRegion::getMemory(usize size, usize alignment, ArenaKind kind) {
+	auto& arena  = arenas[(u8)kind];
+	auto& cursor = cursors[(u8)kind];
+	arena.requestedBytes.fetch_add(size, std::memory_order_relaxed);
+	auto epoch = arena.epoch.load(std::memory_order_acquire);
+	if (cursor.epoch != epoch) {
+		// The arena was destroyed after this thread last allocated from it
+		cursor = Cursor{nullptr, nullptr, epoch};
+	}
+	if (size > largeAllocationLimit) {
+		auto* block = new_block(arena, size + alignment, true);
+		auto* data  = align_pointer((u8*)(block + 1), alignment);
+		arena.paddingBytes.fetch_add(data - (u8*)(block + 1), std::memory_order_relaxed);
+		return data;
+	}
+	u8* result = cursor.current ? align_pointer(cursor.current, alignment) : nullptr;
+	if ((result == nullptr) || ((usize)(cursor.end - result) < size)) {
+		auto* block    = new_block(arena, defaultBlockSize, false);
+		cursor.current = (u8*)(block + 1);
+		cursor.end     = ((u8*)block) + block->size;
+		result         = align_pointer(cursor.current, alignment);
 	}
-	if ((*blockSizePtr - (2 * usizeSize) - u8PtrSize - *blockOffsetPtr) < unitSize) {
-		auto blockSize =
-		    (unitSize < (defaultBlockSize - (2 * usizeSize) - u8PtrSize)) ? defaultBlockSize : (2 * unitSize);
-		auto newBlockTail = malloc(blockSize);
-		if (newBlockTail == nullptr) {
-			exit(1);
-		} else {
-			*nextBlockPtr   = (void*)newBlockTail;
-			nextBlockPtr    = (void**)newBlockTail;
-			blockSizePtr    = (usize*)(nextBlockPtr + 1);
-			blockOffsetPtr  = blockSizePtr + 1;
-			*nextBlockPtr   = nullptr;
-			*blockSizePtr   = blockSize;
-			*blockOffsetPtr = (2 * usizeSize) + u8PtrSize;
-			blockTail       = newBlockTail;
-		}
+	if (result != cursor.current) {
+		arena.paddingBytes.fetch_add(result - cursor.current, std::memory_order_relaxed);
+	}
+	cursor.current = result + size;
+	return (void*)result;
+}
+
+void QatRegion::destroy(ArenaKind kind) {
+	auto&                       arena = arenas[(u8)kind];
+	std::lock_guard<std::mutex> lock(arena.mutex);
+	free_block_chain(arena.blocks);
+	arena.blocks = nullptr;
+	arena.requestedBytes.store(0, std::memory_order_relaxed);
+	arena.reservedBytes.store(0, std::memory_order_relaxed);
+	arena.paddingBytes.store(0, std::memory_order_relaxed);
+	arena.blockCount.store(0, std::memory_order_relaxed);
+	arena.largeAllocations.store(0, std::memory_order_relaxed);
+	arena.epoch.fetch_add(1, std::memory_order_release);
+}
+
+void QatRegion::destroyAllBlocks() {
+	for (usize i = 0; i < ARENA_KIND_COUNT; i++) {
+		destroy((ArenaKind)i);
+	}
+}
+
+ArenaStats QatRegion::get_stats(ArenaKind kind) {
+	auto& arena = arenas[(u8)kind];
+	return ArenaStats{
+	    .requestedBytes   = arena.requestedBytes.load(std::memory_order_relaxed),
+	    .reservedBytes    = arena.reservedBytes.load(std::memory_order_relaxed),
+	    .paddingBytes     = arena.paddingBytes.load(std::memory_order_relaxed),
+	    .blockCount       = arena.blockCount.load(std::memory_order_relaxed),
+	    .largeAllocations = arena.largeAllocations.load(std::memory_order_relaxed),
+	};
+}
+
+usize QatRegion::get_total_size() {
+	usize result = 0;
+	for (usize i = 0; i < ARENA_KIND_COUNT; i++) {
+		result += arenas[i].requestedBytes.load(std::memory_order_relaxed);
 	}
-	auto unitDataPtr = (u8*)(((u8*)blockTail) + (*blockOffsetPtr));
-	*blockOffsetPtr += unitSize;
-	return (void*)unitDataPtr;
+	return result;
 }
 
 } // namespace qat
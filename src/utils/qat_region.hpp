@@ -2,22 +2,82 @@
 #define QAT_REGION_HPP
 
 #include "helpers.hpp"
+#include "macros.hpp"
+#include <atomic>
 #include <mutex>
 
-#define OwnNormal(TYPE_NAME) (TYPE_NAME*)QatRegion::getMemory(sizeof(TYPE_NAME))
+#define OwnNormal(TYPE_NAME)  (TYPE_NAME*)QatRegion::getMemory(sizeof(TYPE_NAME), alignof(TYPE_NAME))
+#define OwnAST(TYPE_NAME)     (TYPE_NAME*)QatRegion::getMemory(sizeof(TYPE_NAME), alignof(TYPE_NAME), ArenaKind::ast)
+#define OwnPrerun(TYPE_NAME)  (TYPE_NAME*)QatRegion::getMemory(sizeof(TYPE_NAME), alignof(TYPE_NAME), ArenaKind::prerun)
+#define OwnGeneric(TYPE_NAME)                                                                                          \
+	(TYPE_NAME*)QatRegion::getMemory(sizeof(TYPE_NAME), alignof(TYPE_NAME), ArenaKind::generics)
 
 namespace qat {
 
+/// The sub-arenas of the compiler's memory. Each of these has its own chain of blocks, so that the memory of one
+/// phase of the compiler can be freed without touching the others
+enum class ArenaKind : u8 {
+	ast,
+	ir,
+	prerun,
+	generics,
+};
+
+constexpr usize ARENA_KIND_COUNT = 4;
+
+useit String arena_kind_to_string(ArenaKind kind);
+
+struct ArenaStats {
+	usize requestedBytes;
+	usize reservedBytes;
+	usize paddingBytes;
+	usize blockCount;
+	usize largeAllocations;
+};
+
 class QatRegion {
-	thread_local static void* blockTail;
-	static Vec<void*>         allBlockTails;
-	static std::mutex         regionMutex;
-	static usize              totalSize;
+	struct Block {
+		Block* next;
+		usize  size;
+	};
+
+	struct Arena {
+		std::mutex         mutex;
+		Block*             blocks = nullptr;
+		std::atomic<u64>   epoch{0};
+		std::atomic<usize> requestedBytes{0};
+		std::atomic<usize> reservedBytes{0};
+		std::atomic<usize> paddingBytes{0};
+		std::atomic<usize> blockCount{0};
+		std::atomic<usize> largeAllocations{0};
+	};
+
+	struct Cursor {
+		u8* current = nullptr;
+		u8* end     = nullptr;
+		u64 epoch   = 0;
+	};
+
+	static constexpr usize defaultBlockSize = 65536;
+	// Allocations bigger than this get a block of their own, so that they do not waste the tail of the active block
+	static constexpr usize largeAllocationLimit = defaultBlockSize / 4;
+
+	thread_local static Cursor cursors[ARENA_KIND_COUNT];
+	static Arena               arenas[ARENA_KIND_COUNT];
+
+	static Block* new_block(Arena& arena, usize minimumSize, bool isLarge);
+	static void   free_block_chain(Block* block);
 
   public:
-	static void* getMemory(usize size);
-	static void  destroyAllBlocks();
-	static usize get_total_size() { return totalSize; }
+	static void* getMemory(usize size, usize alignment, ArenaKind kind = ArenaKind::ir);
+
+	/// Frees all blocks of the provided arena
+	static void destroy(ArenaKind kind);
+
+	static void destroyAllBlocks();
+
+	useit static ArenaStats get_stats(ArenaKind kind);
+	useit static usize      get_total_size();
 };
 
 } // namespace qat